@@ -0,0 +1,265 @@
+'''
+
+compact_detailed_output.py
+
+Reader for COMPAS compact detailed output files (--detailed-output-compact).
+
+With --detailed-output-compact COMPAS writes the BSE detailed output for all binaries to a single
+file (Detailed_Output/BSE_Detailed_Output.cdo in the output container) rather than one file per
+binary.  The records for each binary are written as a block of run-length encoded columns when the
+binary has finished evolving:
+
+    - integer columns (including booleans and enumerations) are encoded as differences from the
+      previous row
+    - floating point columns are encoded as the bit pattern XORed with the bit pattern of the
+      previous row
+    - string columns are encoded as the strings
+
+and each column is written as a sequence of (value, run length) pairs.  All integers are LEB128
+varints (signed values zigzag encoded).  See src/Timeline.h for the file layout.
+
+This module reconstructs the full detailed output records, either for use from Python:
+
+    from compas_python_utils import compact_detailed_output as cdo
+
+    with open('COMPAS_Output/Detailed_Output/BSE_Detailed_Output.cdo', 'rb') as f:
+        columns = cdo.read_header(f)
+        for binary in cdo.read_binaries(f, columns):
+            print(binary.id, binary.n_rows, binary.data['Mass(1)'][-1])
+
+or from the command line, to expand the file to one CSV file per binary, in the same format as
+the standard COMPAS CSV detailed output files:
+
+    compact_detailed_output.py [-h] [-i ID [ID ...]] [-o OUTPUT_DIRECTORY] [-l] input
+
+Floating point values are reconstructed at full (double) precision, so CSV values are written
+with repr() rather than with the COMPAS column format.
+
+Only the Python standard library is used.
+
+'''
+
+import argparse
+import os
+import struct
+import sys
+
+
+MAGIC   = b'COMPASTL'
+VERSION = 1
+
+# COMPAS datatypes - enum class TYPENAME in constants.h
+TYPENAMES = [
+    'NONE', 'BOOL', 'SHORT_INT', 'INT', 'LONG_INT', 'LONG_LONG_INT', 'UNSIGNED_SHORT_INT', 'UNSIGNED_INT',
+    'UNSIGNED_LONG_INT', 'UNSIGNED_LONG_LONG_INT', 'FLOAT', 'DOUBLE', 'LONG_DOUBLE', 'STRING', 'OBJECT_ID',
+    'ERROR', 'STELLAR_TYPE', 'MT_CASE', 'MT_TRACKING', 'SN_EVENT', 'SN_STATE', 'STRING_VECTOR'
+]
+
+UNSIGNED_TYPES = {'UNSIGNED_SHORT_INT', 'UNSIGNED_INT', 'UNSIGNED_LONG_INT', 'UNSIGNED_LONG_LONG_INT', 'OBJECT_ID'}
+
+# short type strings written to the COMPAS CSV type header row
+SHORT_TYPES = {'BOOL': 'BOOL', 'FLOAT': 'FLOAT', 'DOUBLE': 'FLOAT', 'LONG_DOUBLE': 'FLOAT', 'STRING': 'STRING', 'STRING_VECTOR': 'STRING'}
+
+MASK64 = (1 << 64) - 1
+
+
+class Column:
+    ''' Column specification: kind ('i', 'f' or 's'), COMPAS datatype, header and units '''
+    def __init__(self, kind, datatype, header, units):
+        self.kind     = kind
+        self.datatype = datatype
+        self.header   = header
+        self.units    = units
+
+    @property
+    def short_type(self):
+        return SHORT_TYPES.get(self.datatype, 'INT')
+
+
+class Binary:
+    ''' Detailed output for a single binary: id, number of rows, and column data (dict of lists, in column order) '''
+    def __init__(self, id, n_rows, data):
+        self.id     = id
+        self.n_rows = n_rows
+        self.data   = data
+
+    def rows(self):
+        ''' The detailed output records, as tuples of column values '''
+        return list(zip(*self.data.values()))
+
+
+def _varint(buf, pos):
+    ''' Decode an unsigned LEB128 varint from buf at pos - returns (value, new pos) '''
+    result = 0
+    shift  = 0
+    while True:
+        byte = buf[pos]
+        pos += 1
+        result |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return result, pos
+        shift += 7
+
+
+def _unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def _string(buf, pos):
+    length, pos = _varint(buf, pos)
+    return buf[pos:pos + length].decode('utf-8'), pos + length
+
+
+def _read_varint(f):
+    ''' Read an unsigned LEB128 varint from file f - returns None at end of file '''
+    result = 0
+    shift  = 0
+    while True:
+        byte = f.read(1)
+        if not byte:
+            if shift == 0: return None
+            raise ValueError('Truncated compact detailed output file')
+        result |= (byte[0] & 0x7F) << shift
+        if byte[0] < 0x80:
+            return result
+        shift += 7
+
+
+def read_header(f):
+    ''' Read the file header from (binary) file f - returns the list of column specifications '''
+    if f.read(len(MAGIC)) != MAGIC:
+        raise ValueError('Not a COMPAS compact detailed output file')
+
+    version = _read_varint(f)
+    if version != VERSION:
+        raise ValueError('Unsupported compact detailed output file version: {}'.format(version))
+
+    columns = []
+    for _ in range(_read_varint(f)):
+        kind     = f.read(1).decode('ascii')
+        datatype = _read_varint(f)
+        datatype = TYPENAMES[datatype] if datatype < len(TYPENAMES) else 'NONE'
+        header   = f.read(_read_varint(f)).decode('utf-8')
+        units    = f.read(_read_varint(f)).decode('utf-8')
+        columns.append(Column(kind, datatype, header, units))
+
+    return columns
+
+
+def decode_block(payload, n_rows, columns):
+    ''' Decode a binary's block payload - returns a dict of column lists (in column order) '''
+    data = {}
+    pos  = 0
+    for column in columns:
+        n_runs, pos = _varint(payload, pos)
+        values = []
+
+        if column.kind == 's':
+            for _ in range(n_runs):
+                value,  pos = _string(payload, pos)
+                length, pos = _varint(payload, pos)
+                values.extend([value] * length)
+
+        else:
+            previous = 0
+            for _ in range(n_runs):
+                value,  pos = _varint(payload, pos)
+                length, pos = _varint(payload, pos)
+                if column.kind == 'i':
+                    delta = _unzigzag(value)
+                    for _ in range(length):
+                        previous = (previous + delta) & MASK64
+                        values.append(previous)
+                else:
+                    for _ in range(length):
+                        previous ^= value
+                        values.append(previous)
+
+            if column.kind == 'i':
+                if column.datatype == 'BOOL':
+                    values = [v != 0 for v in values]
+                elif column.datatype not in UNSIGNED_TYPES:
+                    values = [v - (1 << 64) if v >> 63 else v for v in values]
+            else:
+                values = list(struct.unpack('<{}d'.format(len(values)), struct.pack('<{}Q'.format(len(values)), *values)))
+
+        if len(values) != n_rows:
+            raise ValueError('Corrupt compact detailed output block (column {})'.format(column.header))
+
+        data[column.header] = values
+
+    return data
+
+
+def read_binaries(f, columns, ids = None):
+    ''' Generator: read the binaries from file f (positioned after the header), optionally only those with ids in ids '''
+    while True:
+        id = _read_varint(f)
+        if id is None:
+            return
+        id     = _unzigzag(id)
+        n_rows = _read_varint(f)
+        length = _read_varint(f)
+
+        if ids is not None and id not in ids:
+            f.seek(length, os.SEEK_CUR)                                         # skip this binary
+            continue
+
+        payload = f.read(length)
+        if len(payload) != length:
+            raise ValueError('Truncated compact detailed output file')
+
+        yield Binary(id, n_rows, decode_block(payload, n_rows, columns))
+
+
+def _format(value, column):
+    if column.datatype == 'BOOL': return '1' if value else '0'
+    if column.kind == 'f': return repr(value)
+    return str(value)
+
+
+def write_csv(binary, columns, filename):
+    ''' Write the detailed output for a binary to a CSV file in the COMPAS CSV logfile format '''
+    with open(filename, 'w') as out:
+        out.write(','.join(column.short_type for column in columns) + '\n')
+        out.write(','.join(column.units for column in columns) + '\n')
+        out.write(','.join(column.header for column in columns) + '\n')
+        for row in binary.rows():
+            out.write(','.join(_format(value, column) for value, column in zip(row, columns)) + '\n')
+
+
+def main():
+
+    formatter = lambda prog: argparse.HelpFormatter(prog, max_help_position = 4, width = 90)
+    parser = argparse.ArgumentParser(description = 'COMPAS compact detailed output reader.', formatter_class = formatter)
+
+    parser.add_argument('input', help = 'compact detailed output file name')
+    parser.add_argument('-i', '--ids', dest = 'ids', type = int, nargs = '+', default = None, help = 'ids of binaries to expand (default = all)')
+    parser.add_argument('-o', '--output', dest = 'outputDirectory', default = '.', help = 'output directory for CSV files (default = .)')
+    parser.add_argument('-l', '--list', dest = 'listOnly', action = 'store_true', help = 'list the binaries in the file (id and number of records) - no CSV files written')
+
+    args = parser.parse_args()
+
+    ids = set(args.ids) if args.ids is not None else None
+
+    basename = os.path.splitext(os.path.basename(args.input))[0]
+
+    with open(args.input, 'rb') as f:
+        columns = read_header(f)
+        if not args.listOnly and not os.path.isdir(args.outputDirectory):
+            os.makedirs(args.outputDirectory)
+
+        nBinaries = 0
+        for binary in read_binaries(f, columns, ids):
+            nBinaries += 1
+            if args.listOnly:
+                print('{}: {} records'.format(binary.id, binary.n_rows))
+            else:
+                write_csv(binary, columns, os.path.join(args.outputDirectory, '{}_{}.csv'.format(basename, abs(binary.id))))
+
+    if not args.listOnly:
+        print('{} binaries expanded to {}'.format(nBinaries, args.outputDirectory))
+
+
+if __name__ == "__main__":
+    main()
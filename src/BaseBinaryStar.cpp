@@ -1,4 +1,5 @@
 #include "BaseBinaryStar.h"
+#include "Summary.h"
 #include "vector3d.h"
 
 // gsl includes
@@ -85,9 +86,13 @@ BaseBinaryStar::BaseBinaryStar(const unsigned long int p_Seed, const long int p_
     int tries = 0;
     do {
 
+        if (IMPORTANCE_SAMPLER->Enabled()) m_ImportanceSample = IMPORTANCE_SAMPLER->Sample();                                           // importance sampling - draw primary mass, mass ratio and semi-major axis from the proposal
+
         double mass1 = OPTIONS->OptionSpecified("initial-mass-1") == 1                                                                  // user specified primary mass?
                         ? OPTIONS->InitialMass1()                                                                                       // yes, use it
-                        : utils::SampleInitialMass(OPTIONS->InitialMassFunction(), 
+                        : IMPORTANCE_SAMPLER->Enabled()                                                                                 // no - importance sampling?
+                            ? m_ImportanceSample.mass1                                                                                  // yes - use the importance sample
+                            : utils::SampleInitialMass(OPTIONS->InitialMassFunction(), 
                                                    OPTIONS->InitialMassFunctionMax(), 
                                                    OPTIONS->InitialMassFunctionMin(), 
                                                    OPTIONS->InitialMassFunctionPower());                                                // no - asmple it
@@ -100,7 +105,9 @@ BaseBinaryStar::BaseBinaryStar(const unsigned long int p_Seed, const long int p_
             // first, determine mass ratio q    
             double q = OPTIONS->OptionSpecified("mass-ratio") == 1                                                                      // user specified mass ratio?
                         ? OPTIONS->MassRatio()                                                                                          // yes, use it
-                        : utils::SampleMassRatio(OPTIONS->MassRatioDistribution(),
+                        : IMPORTANCE_SAMPLER->Enabled()                                                                                 // no - importance sampling?
+                            ? m_ImportanceSample.massRatio                                                                              // yes - use the importance sample
+                            : utils::SampleMassRatio(OPTIONS->MassRatioDistribution(),
                                                  OPTIONS->MassRatioDistributionMax(), 
                                                  OPTIONS->MassRatioDistributionMin());                                                  // no - sample it
 
@@ -121,8 +128,11 @@ BaseBinaryStar::BaseBinaryStar(const unsigned long int p_Seed, const long int p_
                 m_SemiMajorAxis = utils::ConvertPeriodInDaysToSemiMajorAxisInAU(mass1, mass2, OPTIONS->OrbitalPeriod());                // yes - calculate semi-major axis from period
             }
             else {                                                                                                                      // no
-                if (OPTIONS->OptionSpecified("semi-major-axis-distribution") == 1 ||                                                    // user specified semi-major axis distribution, or
-                    OPTIONS->OptionSpecified("orbital-period-distribution" ) == 0) {                                                    // user did not specify oprbital period distribution
+                if (IMPORTANCE_SAMPLER->Enabled()) {                                                                                    // importance sampling?
+                    m_SemiMajorAxis = m_ImportanceSample.semiMajorAxis;                                                                 // yes - use the importance sample
+                }
+                else if (OPTIONS->OptionSpecified("semi-major-axis-distribution") == 1 ||                                               // user specified semi-major axis distribution, or
+                         OPTIONS->OptionSpecified("orbital-period-distribution" ) == 0) {                                               // user did not specify oprbital period distribution
                     m_SemiMajorAxis = utils::SampleSemiMajorAxis(OPTIONS->SemiMajorAxisDistribution(),                              
                                                                  OPTIONS->SemiMajorAxisDistributionMax(), 
                                                                  OPTIONS->SemiMajorAxisDistributionMin(),
@@ -218,6 +228,9 @@ BaseBinaryStar::BaseBinaryStar(const unsigned long int p_Seed, const long int p_
     if (!done) m_Error = ERROR::INVALID_INITIAL_ATTRIBUTES;                                                                             // too many iterations - bad initial conditions
 
     SetRemainingValues();                                                                                                               // complete the construction of the binary
+
+    m_Star1->SetObserver(this);                                                                                                         // observe the constituent stars (after construction:
+    m_Star2->SetObserver(this);                                                                                                         // switches during construction are not reported)
 }
 
 
@@ -239,6 +252,11 @@ void BaseBinaryStar::SetInitialValues(const unsigned long int p_Seed, const long
     m_RandomSeed  = p_Seed;
     m_Id          = p_Id;
 
+    m_ForkDt      = DEFAULT_INITIAL_DOUBLE_VALUE;
+    m_ForkStepNum = 0;
+
+    m_ImportanceSample = { DEFAULT_INITIAL_DOUBLE_VALUE, DEFAULT_INITIAL_DOUBLE_VALUE, DEFAULT_INITIAL_DOUBLE_VALUE, 1.0 };   // not importance sampled - weight 1
+
     if (OPTIONS->PopulationDataPrinting()) {                                                            // user wants to see details of binary?
         SAY("Using supplied random seed " << m_RandomSeed << " for Binary Star id = " << m_ObjectId);   // yes - show them
     }
@@ -585,6 +603,7 @@ COMPAS_VARIABLE BaseBinaryStar::BinaryPropertyValue(const T_ANY_PROPERTY p_Prope
         case BINARY_PROPERTY::ERROR:                                                value = Error();                                                            break;
         case BINARY_PROPERTY::ID:                                                   value = ObjectId();                                                         break;
         case BINARY_PROPERTY::IMMEDIATE_RLOF_POST_COMMON_ENVELOPE:                  value = ImmediateRLOFPostCEE();                                             break;
+        case BINARY_PROPERTY::IMPORTANCE_WEIGHT:                                    value = ImportanceWeight();                                                 break;
         case BINARY_PROPERTY::MASS_1_POST_COMMON_ENVELOPE:                          value = Mass1PostCEE();                                                     break;
         case BINARY_PROPERTY::MASS_1_PRE_COMMON_ENVELOPE:                           value = Mass1PreCEE();                                                      break;
         case BINARY_PROPERTY::MASS_2_POST_COMMON_ENVELOPE:                          value = Mass2PostCEE();                                                     break;
@@ -826,7 +845,7 @@ bool BaseBinaryStar::HasTwoOf(STELLAR_TYPE_LIST p_List) const {
  *
  */
 bool BaseBinaryStar::IsHMXRBinary() const {
-    if (HasOnlyOneOf({STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE})){
+    if (HasOnlyOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE))){
         if (m_Star1->StellarType() < STELLAR_TYPE::NEUTRON_STAR && utils::Compare(StarToRocheLobeRadiusRatio1(), MIN_HMXRB_STAR_TO_ROCHE_LOBE_RADIUS_RATIO) > 0) return true;
         if (m_Star2->StellarType() < STELLAR_TYPE::NEUTRON_STAR && utils::Compare(StarToRocheLobeRadiusRatio2(), MIN_HMXRB_STAR_TO_ROCHE_LOBE_RADIUS_RATIO) > 0) return true;
     }
@@ -887,6 +906,31 @@ bool BaseBinaryStar::PrintBeBinary(const BE_BINARY_RECORD_TYPE p_RecordType) {
 }
 
 
+/*
+ * Handle a stellar type switch of one of the constituent stars
+ *
+ * StarObserver interface: called by Star::SwitchTo() when one of the constituent stars (which
+ * are observed by this binary - see the constructor and CopyMemberVariables()) switches stellar
+ * type.  Writes the BSE Switch Log record if required.
+ *
+ *
+ * void StellarTypeSwitched(const Star* p_Star, const STELLAR_TYPE p_From, const STELLAR_TYPE p_To)
+ *
+ * @param   [IN]    p_Star                      The star switching stellar type
+ * @param   [IN]    p_From                      The stellar type from which the star is switching
+ * @param   [IN]    p_To                        The stellar type to which the star is switching
+ */
+void BaseBinaryStar::StellarTypeSwitched(const Star* p_Star, const STELLAR_TYPE p_From, const STELLAR_TYPE p_To) {
+
+    if (!OPTIONS->SwitchLog()) return;                                                      // nothing to do
+
+    bool primarySwitching = p_Star == static_cast<const Star*>(m_Star1);                    // primary or secondary switching?
+
+    LOGGING->SetSwitchParameters(p_Star->ObjectId(), p_From, p_To);                         // store switch details to LOGGING service
+    (void)PrintSwitchLog(primarySwitching);                                                 // write switch log record
+}
+
+
 
 /*
  * Squirrel RLOF properties away
@@ -957,8 +1001,8 @@ void BaseBinaryStar::StashBeBinaryProperties() {
     m_BeBinaryDetails.currentProps->semiMajorAxis = m_SemiMajorAxis * AU_TO_RSOL;                                    // semi-major axis - change units to Rsol
     m_BeBinaryDetails.currentProps->eccentricity  = m_Eccentricity;                                                  // eccentricity
 
-    BinaryConstituentStar* neutronStar   = m_Star1->IsOneOf({ STELLAR_TYPE::NEUTRON_STAR }) ? m_Star1 : m_Star2;    // pointer to neutron star
-    BinaryConstituentStar* companionStar = m_Star1->IsOneOf({ STELLAR_TYPE::NEUTRON_STAR }) ? m_Star2 : m_Star1;    // pointer to companion
+    BinaryConstituentStar* neutronStar   = m_Star1->IsOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR)) ? m_Star1 : m_Star2;    // pointer to neutron star
+    BinaryConstituentStar* companionStar = m_Star1->IsOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR)) ? m_Star2 : m_Star1;    // pointer to companion
 
     m_BeBinaryDetails.currentProps->massNS              = neutronStar->Mass();                                      // neutron star mass
     m_BeBinaryDetails.currentProps->companionMass       = companionStar->Mass();                                    // companion mass
@@ -1879,7 +1923,7 @@ void BaseBinaryStar::CalculateMassTransfer(const double p_Dt) {
     
     if (!m_Star1->IsRLOF() && !m_Star2->IsRLOF()) return;                                                                       // neither star is overflowing its Roche Lobe - no mass transfer - nothing to do
     
-    if (OPTIONS->CHEMode() != CHE_MODE::NONE && HasTwoOf({STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS}) && HasStarsTouching()) {       // CHE enabled and both stars CH?
+    if (OPTIONS->CHEMode() != CHE_MODE::NONE && HasTwoOf(StellarTypeMask(STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS)) && HasStarsTouching()) {       // CHE enabled and both stars CH?
         m_Flags.stellarMerger = true;
         return;
     }
@@ -1918,8 +1962,8 @@ void BaseBinaryStar::CalculateMassTransfer(const double p_Dt) {
     bool caseBBAlwaysStable           = OPTIONS->CaseBBStabilityPrescription() == CASE_BB_STABILITY_PRESCRIPTION::ALWAYS_STABLE;
     bool caseBBAlwaysUnstable         = OPTIONS->CaseBBStabilityPrescription() == CASE_BB_STABILITY_PRESCRIPTION::ALWAYS_UNSTABLE;
     bool caseBBAlwaysUnstableOntoNSBH = OPTIONS->CaseBBStabilityPrescription() == CASE_BB_STABILITY_PRESCRIPTION::ALWAYS_STABLE_ONTO_NSBH;
-    bool donorIsHeHGorHeGB            = m_Donor->IsOneOf({ STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP, STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH });
-    bool accretorIsNSorBH             = m_Accretor->IsOneOf({ STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE });
+    bool donorIsHeHGorHeGB            = m_Donor->IsOneOf(StellarTypeMask(STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP, STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH));
+    bool accretorIsNSorBH             = m_Accretor->IsOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE));
     bool accretorIsWD                 = m_Accretor->IsOneOf(WHITE_DWARFS); 
 
     // Determine stability
@@ -1991,7 +2035,7 @@ void BaseBinaryStar::CalculateMassTransfer(const double p_Dt) {
     }
     
 	// Check for recycled pulsars. Not considering CEE as a way of recycling NSs.
-	if (!m_CEDetails.CEEnow && m_Accretor->IsOneOf({ STELLAR_TYPE::NEUTRON_STAR })) {                                           // accretor is a neutron star
+	if (!m_CEDetails.CEEnow && m_Accretor->IsOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR))) {                                           // accretor is a neutron star
         m_Donor->SetRLOFOntoNS();                                                                                               // donor donated mass to a neutron star
         m_Accretor->SetRecycledNS();                                                                                            // accretor is (was) a recycled NS
 	}
@@ -2013,7 +2057,7 @@ void BaseBinaryStar::InitialiseMassTransfer() {
     
     if (m_Star1->IsRLOF() || m_Star2->IsRLOF()) {                                                                               // either star overflowing its Roche Lobe?
                                                                                                                                 // yes - mass transfer if not both CH
-        if (OPTIONS->CHEMode() != CHE_MODE::NONE && HasTwoOf({STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS})) {                         // CHE enabled and both stars CH?
+        if (OPTIONS->CHEMode() != CHE_MODE::NONE && HasTwoOf(StellarTypeMask(STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS))) {                         // CHE enabled and both stars CH?
                                                                                                                                 // yes
             // equilibrate masses and circularise (check for merger is done later)
 
@@ -2202,12 +2246,18 @@ double BaseBinaryStar::CalculateAngularMomentum(const double p_SemiMajorAxis,
  * Calls CalculateTotalEnergy() and CalculateAngularMomentum()
  * Updates class member variables
  *
+ * The values calculated here are used only for logging (BINARY_PROPERTY::TOTAL_ENERGY and
+ * BINARY_PROPERTY::TOTAL_ANGULAR_MOMENTUM), so the calculation is skipped if neither property
+ * is written to any of the logfiles active in this run (see Log::UpdateLoggedProperties())
+ *
  *
  * void CalculateEnergyAndAngularMomentum()
  */
 void BaseBinaryStar::CalculateEnergyAndAngularMomentum() {
 
-    if (m_Star1->IsOneOf({ STELLAR_TYPE::MASSLESS_REMNANT }) || m_Star2->IsOneOf({ STELLAR_TYPE::MASSLESS_REMNANT })) return;
+    if (!LOGGING->PropertyLogged(BINARY_PROPERTY::TOTAL_ENERGY) && !LOGGING->PropertyLogged(BINARY_PROPERTY::TOTAL_ANGULAR_MOMENTUM)) return;  // values not logged - nothing to do
+
+    if (m_Star1->IsOneOf(StellarTypeMask(STELLAR_TYPE::MASSLESS_REMNANT)) || m_Star2->IsOneOf(StellarTypeMask(STELLAR_TYPE::MASSLESS_REMNANT))) return;
 
     // Calculate orbital energy and angular momentum
     m_OrbitalEnergyPrev                = m_OrbitalEnergy;
@@ -2302,7 +2352,7 @@ void BaseBinaryStar::EvaluateBinary(const double p_Dt) {
     (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::POST_WINDS);                                              // print (log) detailed output
 
     if ((m_CEDetails.CEEnow || StellarMerger()) &&                                                                      // CEE or merger?
-        !(OPTIONS->CHEMode() != CHE_MODE::NONE && HasTwoOf({STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS}))) {                  // yes - avoid CEE if CH+CH
+        !(OPTIONS->CHEMode() != CHE_MODE::NONE && HasTwoOf(StellarTypeMask(STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS)))) {                  // yes - avoid CEE if CH+CH
 
         ResolveCommonEnvelopeEvent();                                                                                   // resolve CEE - immediate event
         (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::POST_CEE);                                            // print (log) detailed output
@@ -2385,14 +2435,23 @@ void BaseBinaryStar::EvolveOneTimestep(const double p_Dt) {
  *
  * The functional return is the status of the evolution (will indicate why the evolution stopped, and if an error occurred)
  *
+ * If p_ForkPoint is not nullptr a snapshot of the binary (and of the random number generator - see
+ * Rand::SaveState()) is taken at the start of each timestep until the fork point has been passed (see
+ * ForkPointPassed()), so that on return *p_ForkPoint holds the binary as it was at the start of the
+ * timestep in which its first common envelope or supernova event occurred (or at the start of its last
+ * timestep if there was no such event).  The caller owns the snapshot.  The snapshot can be evolved to
+ * completion from that point by EvolveFromForkPoint() - this is used by --fork-variations to evolve
+ * the remaining command-line variations of a binary without repeating its shared early evolution.
+ *
  * JR: todo: flesh-out this documentation
  *
  *
- * EVOLUTION_STATUS Evolve()
+ * EVOLUTION_STATUS Evolve(BaseBinaryStar** p_ForkPoint)
  *
+ * @param   [IN/OUT]    p_ForkPoint             Address of the fork point snapshot pointer (nullptr = no snapshot)
  * @return                                      Status of the evolution (EVOLUTION_STATUS)
  */
-EVOLUTION_STATUS BaseBinaryStar::Evolve() {
+EVOLUTION_STATUS BaseBinaryStar::Evolve(BaseBinaryStar** p_ForkPoint) {
 
     EVOLUTION_STATUS evolutionStatus = EVOLUTION_STATUS::CONTINUE;
 
@@ -2418,109 +2477,280 @@ EVOLUTION_STATUS BaseBinaryStar::Evolve() {
 
     if (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                                    // continue evolution
         // evolve the current binary up to the maximum evolution time (and number of steps)
-        double dt      = std::min(m_Star1->CalculateTimestep(), m_Star2->CalculateTimestep()) / 1000.0;                                     // initialise the timestep
-        int    stepNum = 1;                                                                                                                 // initialise step number
-        while (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                             // perform binary evolution - iterate over timesteps until told to stop
+        double dt       = std::min(m_Star1->CalculateTimestep(), m_Star2->CalculateTimestep()) / 1000.0;                                    // initialise the timestep
+        evolutionStatus = EvolveTimesteps(dt, 1, p_ForkPoint);                                                                              // evolve from the first timestep
+    }
 
-            EvolveOneTimestep(dt);                                                                                                          // evolve the binary system one timestep
+    ResolveEndOfEvolution(evolutionStatus);                                                                                                 // record the final state of the binary
 
-            // check for problems
-            if (m_Error != ERROR::NONE) {                                                                                                   // SSE error for either constituent star?
-                evolutionStatus = EVOLUTION_STATUS::SSE_ERROR;                                                                              // yes - stop evolution
-            }
-            else if (HasOneOf({ STELLAR_TYPE::MASSLESS_REMNANT })) {                                                                        // at least one massless remnant?
-                evolutionStatus = EVOLUTION_STATUS::MASSLESS_REMNANT;                                                                       // yes - stop evolution
+    return evolutionStatus;
+}
+
+
+/*
+ * Resume the evolution of a binary from its fork point
+ *
+ * The binary must be a copy of a fork point snapshot taken by Evolve() - it is evolved from the
+ * start of the timestep at which the snapshot was taken to the maximum evolution time (and number of
+ * steps), under the option values current at the time of the call.  The caller is responsible for
+ * restoring the random number generator to its state at the fork point (see Rand::RestoreState()).
+ *
+ * Records written before the fork point (e.g. the initial state in the detailed output) are not
+ * written again.
+ *
+ *
+ * EVOLUTION_STATUS EvolveFromForkPoint(const long int p_Id)
+ *
+ * @param   [IN]    p_Id                        Id of the binary (the evolved binary is a new binary)
+ * @return                                      Status of the evolution (EVOLUTION_STATUS)
+ */
+EVOLUTION_STATUS BaseBinaryStar::EvolveFromForkPoint(const long int p_Id) {
+
+    m_Id = p_Id;
+
+    EVOLUTION_STATUS evolutionStatus = EvolveTimesteps(m_ForkDt, m_ForkStepNum, nullptr);                                                   // evolve from the fork point
+
+    ResolveEndOfEvolution(evolutionStatus);                                                                                                 // record the final state of the binary
+
+    return evolutionStatus;
+}
+
+
+/*
+ * Determine whether the binary can no longer reach the evolution target
+ *
+ * Checked at the end of each timestep - if the target can no longer be reached evolution is stopped
+ * with status EVOLUTION_STATUS::TARGET_UNREACHABLE.  The target is unreachable if:
+ *
+ *    - the evolution target minimum mass is set (--evolution-target-minimum-mass > 0), and each star
+ *      is either a white dwarf or less massive than the minimum mass, or
+ *
+ *    - the evolution target is a double compact object (--evolution-target DCO), and the stars that
+ *      are not yet neutron stars or black holes do not have enough mass between them to each become
+ *      one.  Every route to a neutron star or black hole (core collapse, electron capture, ultra-stripped
+ *      and accretion-induced collapse supernovae) requires the star to be more massive than MECS, and
+ *      the mass of the stars that are not yet compact objects can only decrease (compact objects do not
+ *      donate mass), so once that mass is below MECS per star the target can no longer be reached.
+ *
+ *
+ * bool EvolutionTargetUnreachable()
+ *
+ * @return                                      Boolean flag indicating whether the evolution target can no longer be reached
+ */
+bool BaseBinaryStar::EvolutionTargetUnreachable() const {
+
+    double minimumMass = OPTIONS->EvolutionTargetMinimumMass();
+    if (minimumMass > 0.0                                                                     &&
+        (m_Star1->IsOneOf(WHITE_DWARFS) || utils::Compare(m_Star1->Mass(), minimumMass) < 0) &&
+        (m_Star2->IsOneOf(WHITE_DWARFS) || utils::Compare(m_Star2->Mass(), minimumMass) < 0)) return true;    // both stars WDs or below the minimum mass
+
+    bool unreachable = false;
+
+    switch (OPTIONS->EvolutionTarget()) {                                                                                   // which target?
+
+        case EVOLUTION_TARGET::DCO: {                                                                                       // double compact object
+            double mass   = 0.0;                                                                                            // mass of stars not yet NS or BH
+            int    nStars = 0;                                                                                              // number of stars not yet NS or BH
+            for (auto star : { m_Star1, m_Star2 }) {
+                if (!star->IsOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE))) {
+                    mass += star->Mass();
+                    nStars++;
+                }
             }
-            else if (StellarMerger()) {                                                                                                     // have stars merged?
-                evolutionStatus = EVOLUTION_STATUS::STELLAR_MERGER;                                                                         // for now, stop evolution
+            unreachable = utils::Compare(mass, nStars * MECS) < 0;
+        } break;
+
+        default: break;                                                                                                     // no target
+    }
+
+    return unreachable;
+}
+
+
+/*
+ * Determine whether the binary has reached the evolution target (--evolution-target)
+ *
+ * Used by the importance sampler to identify its hits once evolution has stopped.
+ *
+ *
+ * bool EvolutionTargetReached()
+ *
+ * @return                                      Boolean flag indicating whether the binary reached the evolution target
+ */
+bool BaseBinaryStar::EvolutionTargetReached() const {
+
+    bool reached = false;
+
+    switch (OPTIONS->EvolutionTarget()) {                                                                                   // which target?
+        case EVOLUTION_TARGET::DCO: reached = IsDCO(); break;                                                               // double compact object
+        default:                    reached = true;    break;                                                               // no target - every binary reaches it
+    }
+
+    return reached;
+}
+
+
+/*
+ * Determine whether the binary has passed its fork point
+ *
+ * The fork point is the start of the timestep in which the first common envelope or supernova
+ * event occurs - the options that may be varied with --fork-variations (see m_ForkVariationsAllowed
+ * in Options.h) are not consulted before that point.
+ *
+ *
+ * bool ForkPointPassed()
+ *
+ * @return                                      Boolean flag indicating whether the fork point has been passed
+ */
+bool BaseBinaryStar::ForkPointPassed() const {
+    return m_CEDetails.CEEcount > 0                                                                       ||
+           HasOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE, STELLAR_TYPE::MASSLESS_REMNANT)) ||
+           m_Star1->IsSNevent() || m_Star2->IsSNevent();
+}
+
+
+/*
+ * Evolve the binary timestep by timestep up to the maximum evolution time (and number of steps)
+ *
+ * See Evolve() for p_ForkPoint.
+ *
+ *
+ * EVOLUTION_STATUS EvolveTimesteps(double p_Dt, int p_StepNum, BaseBinaryStar** p_ForkPoint)
+ *
+ * @param   [IN]        p_Dt                    The timestep for the first step
+ * @param   [IN]        p_StepNum               The step number of the first step
+ * @param   [IN/OUT]    p_ForkPoint             Address of the fork point snapshot pointer (nullptr = no snapshot)
+ * @return                                      Status of the evolution (EVOLUTION_STATUS)
+ */
+EVOLUTION_STATUS BaseBinaryStar::EvolveTimesteps(double p_Dt, int p_StepNum, BaseBinaryStar** p_ForkPoint) {
+
+    EVOLUTION_STATUS evolutionStatus = EVOLUTION_STATUS::CONTINUE;
+
+    while (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                             // perform binary evolution - iterate over timesteps until told to stop
+
+        if (p_ForkPoint && !ForkPointPassed()) {                                                                                        // taking fork point snapshots, and fork point not yet passed?
+            if (*p_ForkPoint) **p_ForkPoint = *this;                                                                                    // yes - snapshot the binary at the start of this timestep
+            else *p_ForkPoint = new BaseBinaryStar(*this);
+            (*p_ForkPoint)->m_ForkDt      = p_Dt;                                                                                       // record where to resume
+            (*p_ForkPoint)->m_ForkStepNum = p_StepNum;
+            RAND->SaveState();                                                                                                          // snapshot the random number generator
+        }
+
+        EvolveOneTimestep(p_Dt);                                                                                                        // evolve the binary system one timestep
+
+        // check for problems
+        if (m_Error != ERROR::NONE) {                                                                                                   // SSE error for either constituent star?
+            evolutionStatus = EVOLUTION_STATUS::SSE_ERROR;                                                                              // yes - stop evolution
+        }
+        else if (HasOneOf(StellarTypeMask(STELLAR_TYPE::MASSLESS_REMNANT))) {                                                                        // at least one massless remnant?
+            evolutionStatus = EVOLUTION_STATUS::MASSLESS_REMNANT;                                                                       // yes - stop evolution
+        }
+        else if (StellarMerger()) {                                                                                                     // have stars merged?
+            evolutionStatus = EVOLUTION_STATUS::STELLAR_MERGER;                                                                         // for now, stop evolution
+        }
+        else if (HasStarsTouching()) {                                                                                                  // binary components touching? (should usually be avoided as MT or CE or merger should happen prior to this)
+            evolutionStatus = EVOLUTION_STATUS::STARS_TOUCHING;                                                                         // yes - stop evolution
+        }
+        else if (IsUnbound() && !OPTIONS->EvolveUnboundSystems()) {                                                                     // binary is unbound and we don't want unbound systems?
+            m_Unbound       = true;                                                                                                     // yes - set the unbound flag (should already be set)
+            evolutionStatus = EVOLUTION_STATUS::UNBOUND;                                                                                // stop evolution
+        }
+        else {                                                                                                                          // continue evolution
+
+            (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::POST_STELLAR_TIMESTEP);                                           // print (log) detailed output
+
+            if (OPTIONS->RLOFPrinting()) StashRLOFProperties(MASS_TRANSFER_TIMING::PRE_MT);                                             // stash properties immediately pre-Mass Transfer 
+
+            EvaluateBinary(p_Dt);                                                                                                       // evaluate the binary at this timestep
+
+            (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::POST_BINARY_TIMESTEP);                                            // print (log) detailed output
+            
+            (void)PrintRLOFParameters();                                                                                                // print (log) RLOF parameters
+            
+            // check for problems
+            if (StellarMerger()) {                                                                                                      // have stars merged?
+                evolutionStatus = EVOLUTION_STATUS::STELLAR_MERGER;                                                                     // for now, stop evolution
             }
-            else if (HasStarsTouching()) {                                                                                                  // binary components touching? (should usually be avoided as MT or CE or merger should happen prior to this)
-                evolutionStatus = EVOLUTION_STATUS::STARS_TOUCHING;                                                                         // yes - stop evolution
+            else if (HasStarsTouching()) {                                                                                              // binary components touching? (should usually be avoided as MT or CE or merger should happen prior to this)
+                evolutionStatus = EVOLUTION_STATUS::STARS_TOUCHING;                                                                     // yes - stop evolution
             }
-            else if (IsUnbound() && !OPTIONS->EvolveUnboundSystems()) {                                                                     // binary is unbound and we don't want unbound systems?
-                m_Unbound       = true;                                                                                                     // yes - set the unbound flag (should already be set)
-                evolutionStatus = EVOLUTION_STATUS::UNBOUND;                                                                                // stop evolution
+            else if (IsUnbound() && !OPTIONS->EvolveUnboundSystems()) {                                                                 // binary is unbound and we don't want unbound systems?
+                evolutionStatus = EVOLUTION_STATUS::UNBOUND;                                                                            // stop evolution
             }
-            else {                                                                                                                          // continue evolution
-
-                (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::POST_STELLAR_TIMESTEP);                                           // print (log) detailed output
-
-                if (OPTIONS->RLOFPrinting()) StashRLOFProperties(MASS_TRANSFER_TIMING::PRE_MT);                                             // stash properties immediately pre-Mass Transfer 
+            
+            if (m_Error != ERROR::NONE) evolutionStatus = EVOLUTION_STATUS::BINARY_ERROR;                                               // error in binary evolution
 
-                EvaluateBinary(dt);                                                                                                         // evaluate the binary at this timestep
+            if (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                        // continue evolution?
 
-                (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::POST_BINARY_TIMESTEP);                                            // print (log) detailed output
-                
-                (void)PrintRLOFParameters();                                                                                                // print (log) RLOF parameters
-                
-                // check for problems
-                if (StellarMerger()) {                                                                                                      // have stars merged?
-                    evolutionStatus = EVOLUTION_STATUS::STELLAR_MERGER;                                                                     // for now, stop evolution
-                }
-                else if (HasStarsTouching()) {                                                                                              // binary components touching? (should usually be avoided as MT or CE or merger should happen prior to this)
-                    evolutionStatus = EVOLUTION_STATUS::STARS_TOUCHING;                                                                     // yes - stop evolution
-                }
-                else if (IsUnbound() && !OPTIONS->EvolveUnboundSystems()) {                                                                 // binary is unbound and we don't want unbound systems?
-                    evolutionStatus = EVOLUTION_STATUS::UNBOUND;                                                                            // stop evolution
+                if (HasOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR))) {
+                    (void)PrintPulsarEvolutionParameters();                                                                             // print (log) pulsar evolution parameters 
                 }
-                
-                if (m_Error != ERROR::NONE) evolutionStatus = EVOLUTION_STATUS::BINARY_ERROR;                                               // error in binary evolution
-
-                if (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                        // continue evolution?
 
-                    if (HasOneOf({ STELLAR_TYPE::NEUTRON_STAR })) {
-                        (void)PrintPulsarEvolutionParameters();                                                                             // print (log) pulsar evolution parameters 
+                //(void)PrintBeBinary();                                                                                                  // print (log) BeBinary properties
+                    
+                if (IsDCO() && !IsUnbound()) {                                                                                          // bound double compact object?
+                    if (m_DCOFormationTime == DEFAULT_INITIAL_DOUBLE_VALUE) {                                                           // DCO not yet evaluated -- to ensure that the coalescence is only resolved once
+                        ResolveCoalescence();                                                                                           // yes - resolve coalescence
+                        m_DCOFormationTime = m_Time;                                                                                    // set the DCO formation time
                     }
 
-                    //(void)PrintBeBinary();                                                                                                  // print (log) BeBinary properties
-                        
-                    if (IsDCO() && !IsUnbound()) {                                                                                          // bound double compact object?
-                        if (m_DCOFormationTime == DEFAULT_INITIAL_DOUBLE_VALUE) {                                                           // DCO not yet evaluated -- to ensure that the coalescence is only resolved once
-                            ResolveCoalescence();                                                                                           // yes - resolve coalescence
-                            m_DCOFormationTime = m_Time;                                                                                    // set the DCO formation time
-                        }
-
-                        if (!(OPTIONS->EvolvePulsars() && HasOneOf({ STELLAR_TYPE::NEUTRON_STAR }))) {
-                            if (!OPTIONS->Quiet()) SAY(ERR_MSG(ERROR::BINARY_EVOLUTION_STOPPED) << ": Double compact object");              // announce that we're stopping evolution
-                            evolutionStatus = EVOLUTION_STATUS::STOPPED;                                                                    // stop evolving
-                        }
+                    if (!(OPTIONS->EvolvePulsars() && HasOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR)))) {
+                        if (!OPTIONS->Quiet()) SAY(ERR_MSG(ERROR::BINARY_EVOLUTION_STOPPED) << ": Double compact object");              // announce that we're stopping evolution
+                        evolutionStatus = EVOLUTION_STATUS::STOPPED;                                                                    // stop evolving
                     }
+                }
 
-                    // check for problems
-                    if (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                    // continue evolution?
-                             if (m_Error != ERROR::NONE)                                       evolutionStatus = EVOLUTION_STATUS::BINARY_ERROR; // error in binary evolution
-                        else if (IsWDandWD())                                                  evolutionStatus = EVOLUTION_STATUS::WD_WD;   // do not evolve double WD systems for now
-                        else if (IsDCO() && m_Time>(m_DCOFormationTime + m_TimeToCoalescence) && !IsUnbound()){
-                            evolutionStatus = EVOLUTION_STATUS::STOPPED; // evolution time exceeds DCO merger time
-                        } 
-                        else if (m_Time > OPTIONS->MaxEvolutionTime())                         evolutionStatus = EVOLUTION_STATUS::TIMES_UP;// evolution time exceeds maximum
-                    }
+                // check for problems
+                if (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                    // continue evolution?
+                         if (m_Error != ERROR::NONE)                                       evolutionStatus = EVOLUTION_STATUS::BINARY_ERROR; // error in binary evolution
+                    else if (IsWDandWD())                                                  evolutionStatus = EVOLUTION_STATUS::WD_WD;   // do not evolve double WD systems for now
+                    else if (EvolutionTargetUnreachable())                                 evolutionStatus = EVOLUTION_STATUS::TARGET_UNREACHABLE; // evolution target can no longer be reached
+                    else if (IsDCO() && m_Time>(m_DCOFormationTime + m_TimeToCoalescence) && !IsUnbound()){
+                        evolutionStatus = EVOLUTION_STATUS::STOPPED; // evolution time exceeds DCO merger time
+                    } 
+                    else if (m_Time > OPTIONS->MaxEvolutionTime())                         evolutionStatus = EVOLUTION_STATUS::TIMES_UP;// evolution time exceeds maximum
                 }
             }
+        }
 
-            (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::TIMESTEP_COMPLETED);                                                  // print (log) detailed output: this is after all changes made in the timestep
+        (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::TIMESTEP_COMPLETED);                                                  // print (log) detailed output: this is after all changes made in the timestep
 
-            if (stepNum >= OPTIONS->MaxNumberOfTimestepIterations()) evolutionStatus = EVOLUTION_STATUS::STEPS_UP;                          // number of timesteps for evolution exceeds maximum
+        if (p_StepNum >= OPTIONS->MaxNumberOfTimestepIterations()) evolutionStatus = EVOLUTION_STATUS::STEPS_UP;                        // number of timesteps for evolution exceeds maximum
 
-            if (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                            // continue evolution?
+        if (evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                                                            // continue evolution?
 
-                dt = std::min(m_Star1->CalculateTimestep(), m_Star2->CalculateTimestep()) * OPTIONS->TimestepMultiplier();                  // new timestep
-                if ((m_Star1->IsOneOf({ STELLAR_TYPE::MASSLESS_REMNANT }) || m_Star2->IsOneOf({ STELLAR_TYPE::MASSLESS_REMNANT })) || dt < NUCLEAR_MINIMUM_TIMESTEP) {
-                    dt = NUCLEAR_MINIMUM_TIMESTEP;                                                                                          // but not less than minimum
+            p_Dt = std::min(m_Star1->CalculateTimestep(), m_Star2->CalculateTimestep()) * OPTIONS->TimestepMultiplier();                // new timestep
+            if ((m_Star1->IsOneOf(StellarTypeMask(STELLAR_TYPE::MASSLESS_REMNANT)) || m_Star2->IsOneOf(StellarTypeMask(STELLAR_TYPE::MASSLESS_REMNANT))) || p_Dt < NUCLEAR_MINIMUM_TIMESTEP) {
+                p_Dt = NUCLEAR_MINIMUM_TIMESTEP;                                                                                        // but not less than minimum
 		        }
-                stepNum++;                                                                                                                  // increment stepNum
-            }
+            p_StepNum++;                                                                                                                // increment step number
         }
+    }
 
-        if (evolutionStatus == EVOLUTION_STATUS::STEPS_UP) {                                                                                // stopped because max timesteps reached?
-            SHOW_ERROR(ERROR::BINARY_EVOLUTION_STOPPED);                                                                                    // show error
-        }
+    if (evolutionStatus == EVOLUTION_STATUS::STEPS_UP) {                                                                                    // stopped because max timesteps reached?
+        SHOW_ERROR(ERROR::BINARY_EVOLUTION_STOPPED);                                                                                        // show error
     }
 
+    return evolutionStatus;
+}
+
+
+/*
+ * Record the final state of the binary once evolution has stopped
+ *
+ *
+ * void ResolveEndOfEvolution(const EVOLUTION_STATUS p_EvolutionStatus)
+ *
+ * @param   [IN]    p_EvolutionStatus           Status of the evolution
+ */
+void BaseBinaryStar::ResolveEndOfEvolution(const EVOLUTION_STATUS p_EvolutionStatus) {
+
     (void)PrintDetailedOutput(m_Id, BSE_DETAILED_RECORD_TYPE::FINAL_STATE);                                                                 // print (log) detailed output: this is the final state of the binary
 
     (void)PrintBinarySystemParameters();                                                                                                    // print (log) binary system parameters
 
-    return evolutionStatus;
+    if (IMPORTANCE_SAMPLER->Enabled()) IMPORTANCE_SAMPLER->Record(m_ImportanceSample, EvolutionTargetReached());                            // feed the outcome back to the importance sampler
+
+    if (SUMMARY->Enabled()) SUMMARY->Accumulate(*this, p_EvolutionStatus, ImportanceWeight());                                              // accumulate population summary
 }
 
@@ -6,8 +6,10 @@
 #include "profiling.h"
 #include "utils.h"
 #include "vector3d.h"
+#include "ObjectPool.h"
 
 #include "Log.h"
+#include "ImportanceSampler.h"
 #include "Star.h"
 #include "BinaryConstituentStar.h"
 
@@ -24,7 +26,7 @@ class Star;
 class BinaryConstituentStar;
 
 
-class BaseBinaryStar {
+class BaseBinaryStar: public StarObserver {
 
 public:
 
@@ -60,9 +62,14 @@ public:
         m_EccentricityPrev                 = p_Star.m_EccentricityPrev;
 
         m_Flags                            = p_Star.m_Flags;
+
+        m_ForkDt                           = p_Star.m_ForkDt;
+        m_ForkStepNum                      = p_Star.m_ForkStepNum;
         
         m_FractionAccreted                 = p_Star.m_FractionAccreted;
 
+        m_ImportanceSample                 = p_Star.m_ImportanceSample;
+
         m_CosIPrime                        = p_Star.m_CosIPrime;
         m_IPrime                           = p_Star.m_IPrime;
 
@@ -133,6 +140,14 @@ public:
         m_Supernova = p_Star.m_Supernova ? (p_Star.m_Supernova == p_Star.m_Star1 ? m_Star1 : m_Star2) : nullptr;
         m_Companion = p_Star.m_Companion ? (p_Star.m_Companion == p_Star.m_Star1 ? m_Star1 : m_Star2) : nullptr;
 
+        if (m_Star1 && m_Star2) {                                   // the copied constituent stars don't point at their companions
+            m_Star1->SetCompanion(m_Star2);
+            m_Star2->SetCompanion(m_Star1);
+        }
+
+        if (m_Star1) m_Star1->SetObserver(this);                    // observe the copied stars (stellar events of the copies are reported to this binary)
+        if (m_Star2) m_Star2->SetObserver(this);
+
     }
 
     // Copy constructor
@@ -155,6 +170,9 @@ public:
             m_ObjectType  = OBJECT_TYPE::BASE_BINARY_STAR;          // can only copy from BASE_BINARY_STAR
             m_StellarType = STELLAR_TYPE::BINARY_STAR;              // always
 
+            delete m_Star1;                                         // delete existing constituent stars
+            delete m_Star2;
+
             CopyMemberVariables(p_Star);                            // copy member variables
         }
         return *this;
@@ -163,6 +181,9 @@ public:
 
     virtual ~BaseBinaryStar() { delete m_Star1; delete m_Star2; }
 
+    // objects are allocated from a pool rather than the heap - see ObjectPool.h
+    POOLED_ALLOCATION(BaseBinaryStar)
+
 
     // object identifiers - all classes have these
     OBJECT_ID           ObjectId() const                            { return m_ObjectId; }
@@ -177,6 +198,7 @@ public:
     unsigned int        CEEventCount() const                        { return m_CEDetails.CEEcount; }
     double              CircularizationTimescale() const            { return m_CircularizationTimescale; }
     unsigned int        CommonEnvelopeEventCount() const            { return m_CEDetails.CEEcount; }
+    double              DCOFormationTime() const                    { return m_DCOFormationTime; }
     bool                Unbound() const                             { return m_Unbound; }
     bool                DoubleCoreCE() const                        { return m_CEDetails.doubleCoreCE; }
     double              Dt() const                                  { return m_Dt; }
@@ -187,24 +209,28 @@ public:
     double              EccentricityPreSN() const                   { return m_EccentricityPreSN; }
     double              EccentricityPreCEE() const                  { return m_CEDetails.preCEE.eccentricity; }
     ERROR               Error() const                               { return m_Error; }
+    bool                ExperiencedRLOF() const                     { return m_Star1->ExperiencedRLOF() || m_Star2->ExperiencedRLOF(); }
     double              FractionAccreted() const                    { return m_FractionAccreted; }
     bool                HasOnlyOneOf(STELLAR_TYPE_LIST p_List) const;
     bool                HasOneOf(STELLAR_TYPE_LIST p_List) const;
     bool                HasStarsTouching() const                    { return (utils::Compare(m_SemiMajorAxis, 0.0) > 0) && (m_SemiMajorAxis <= RSOL_TO_AU * (m_Star1->Radius() + m_Star2->Radius())); }
     bool                HasTwoOf(STELLAR_TYPE_LIST p_List) const;
     bool                ImmediateRLOFPostCEE() const                { return m_RLOFDetails.immediateRLOFPostCEE; }
+    double              ImportanceWeight() const                    { return m_ImportanceSample.weight; }
     STELLAR_TYPE        InitialStellarType1() const                 { return m_Star1->InitialStellarType(); }
     STELLAR_TYPE        InitialStellarType2() const                 { return m_Star2->InitialStellarType(); }
-    bool                IsBeBinary() const                          { return HasOneOf({STELLAR_TYPE::NEUTRON_STAR}) && HasOneOf({STELLAR_TYPE::MS_LTE_07, STELLAR_TYPE::MS_GT_07}); }
+    bool                IsBeBinary() const                          { return HasOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR)) && HasOneOf(StellarTypeMask(STELLAR_TYPE::MS_LTE_07, STELLAR_TYPE::MS_GT_07)); }
     bool                IsHMXRBinary() const;
-    bool                IsBHandBH() const                           { return HasTwoOf({STELLAR_TYPE::BLACK_HOLE}); }
-    bool                IsDCO() const                               { return HasTwoOf({STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE}); }
-    bool                IsNSandBH() const                           { return HasOneOf({STELLAR_TYPE::NEUTRON_STAR}) && HasOneOf({STELLAR_TYPE::BLACK_HOLE}); }
-    bool                IsNSandNS() const                           { return HasTwoOf({STELLAR_TYPE::NEUTRON_STAR}); }
+    bool                IsBHandBH() const                           { return HasTwoOf(StellarTypeMask(STELLAR_TYPE::BLACK_HOLE)); }
+    bool                IsDCO() const                               { return HasTwoOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE)); }
+    bool                IsNSandBH() const                           { return HasOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR)) && HasOneOf(StellarTypeMask(STELLAR_TYPE::BLACK_HOLE)); }
+    bool                IsNSandNS() const                           { return HasTwoOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR)); }
     bool                IsUnbound() const                           { return (utils::Compare(m_SemiMajorAxis, 0.0) <= 0 || (utils::Compare(m_Eccentricity, 1.0) > 0)); }         // semi major axis <= 0.0 means unbound, presumably by SN)
-    bool                IsWDandWD() const                           { return HasTwoOf({STELLAR_TYPE::HELIUM_WHITE_DWARF, STELLAR_TYPE::CARBON_OXYGEN_WHITE_DWARF, STELLAR_TYPE::OXYGEN_NEON_WHITE_DWARF}); }
+    bool                IsWDandWD() const                           { return HasTwoOf(StellarTypeMask(STELLAR_TYPE::HELIUM_WHITE_DWARF, STELLAR_TYPE::CARBON_OXYGEN_WHITE_DWARF, STELLAR_TYPE::OXYGEN_NEON_WHITE_DWARF)); }
+    double              Mass1() const                               { return m_Star1->Mass(); }
     double              Mass1PostCEE() const                        { return m_Star1->MassPostCEE(); }
     double              Mass1PreCEE() const                         { return m_Star1->MassPreCEE(); }
+    double              Mass2() const                               { return m_Star2->Mass(); }
     double              Mass2PostCEE() const                        { return m_Star2->MassPostCEE(); }
     double              Mass2PreCEE() const                         { return m_Star2->MassPreCEE(); }
     double              MassEnv1() const                            { return m_MassEnv1; }
@@ -271,14 +297,15 @@ public:
 
     static  double              CalculateRocheLobeRadius_Static(const double p_MassPrimary, const double p_MassSecondary);
 
-            EVOLUTION_STATUS    Evolve();
+            EVOLUTION_STATUS    Evolve(BaseBinaryStar** p_ForkPoint = nullptr);
+            EVOLUTION_STATUS    EvolveFromForkPoint(const long int p_Id);
 
             bool                PrintSwitchLog(const bool p_PrimarySwitching) { return OPTIONS->SwitchLog() ? LOGGING->LogBSESwitchLog(this, p_PrimarySwitching) : true; }
 
             COMPAS_VARIABLE     PropertyValue(const T_ANY_PROPERTY p_Property) const;
 
-            BinaryConstituentStar* Star1() { return m_Star1; }                              // Returns a pointer to the primary - here mainly to support the BSE Switch Log. Be careful!
-            BinaryConstituentStar* Star2() { return m_Star2; }                              // Returns a pointer to the secondary - here mainly to support the BSE Switch Log. Be careful!
+            // StarObserver - stellar events of the constituent stars
+            void                StellarTypeSwitched(const Star* p_Star, const STELLAR_TYPE p_From, const STELLAR_TYPE p_To);
 
 private:
 
@@ -323,8 +350,13 @@ private:
 
     }                   m_Flags;
 
+    double              m_ForkDt;                                                           // Timestep at the fork point - see Evolve()
+    int                 m_ForkStepNum;                                                      // Timestep number at the fork point - see Evolve()
+
     double	            m_FractionAccreted;	                                                // Fraction of mass accreted from the donor during mass transfer
 
+    ImportanceSampleT   m_ImportanceSample;                                                 // Initial conditions drawn by the importance sampler, and their weight (weight 1 if not importance sampling)
+
     double              m_CosIPrime;
     double              m_IPrime;
 
@@ -484,8 +516,16 @@ private:
     void    EvolveOneTimestep(const double p_Dt);
     void    EvolveOneTimestepPreamble(const double p_Dt);
 
+    EVOLUTION_STATUS EvolveTimesteps(double p_Dt, int p_StepNum, BaseBinaryStar** p_ForkPoint);
+
+    bool    EvolutionTargetReached() const;
+    bool    EvolutionTargetUnreachable() const;
+
+    bool    ForkPointPassed() const;
+
     void    ResolveCoalescence();
     void    ResolveCommonEnvelopeEvent();
+    void    ResolveEndOfEvolution(const EVOLUTION_STATUS p_EvolutionStatus);
     void    ResolveMassChanges();
     bool    ResolveSupernova();
 
@@ -65,6 +65,13 @@ BaseStar::BaseStar(const unsigned long int p_RandomSeed,
         m_GBParams.push_back(DEFAULT_INITIAL_DOUBLE_VALUE);
     }
 
+    // nothing memoised yet - see CalculateGBParamsAndTimescales()
+    m_GBParamsAndTimescalesValid       = false;
+    m_GBParamsAndTimescalesStellarType = STELLAR_TYPE::NONE;
+    m_GBParamsAndTimescalesMass0       = DEFAULT_INITIAL_DOUBLE_VALUE;
+    m_GBParamsAndTimescalesMetallicity = DEFAULT_INITIAL_DOUBLE_VALUE;
+    m_GBParamsAndTimescalesCoreMass    = DEFAULT_INITIAL_DOUBLE_VALUE;
+
     // initialise m_MassCutoffs vector - so we have the right number of entries
     for (int i = 0; i < static_cast<int>(MASS_CUTOFF::COUNT); i++) {
         m_MassCutoffs.push_back(DEFAULT_INITIAL_DOUBLE_VALUE);
@@ -1171,7 +1178,7 @@ double BaseStar::CalculateMassAndZInterpolatedLambdaNanjing(const double p_Mass,
 double BaseStar::CalculateMassInterpolatedLambdaNanjing(const double p_Mass, const int p_Zind) const {
 
     double lambda = 0.0;
-    std::vector<int> ind = utils::binarySearch(NANJING_MASSES, p_Mass);
+    std::array<int, 2> ind = utils::binarySearch(NANJING_MASSES, p_Mass);
     int low = ind[0];
     int up = ind[1];
     if ( (low < 0)  && (up >= 0) ) {                                                            // Mass below range calculated by Xu & Li (2010)
@@ -1238,7 +1245,7 @@ double BaseStar::FindLambdaNanjingNearestMassIndex(const double p_Mass) const {
         return NANJING_MASSES.size() - 1;
     }
     else {                                                                                                       // Search for upper and lower mass bin edges
-        std::vector<int> ind = utils::binarySearch(NANJING_MASSES_MIDPOINTS, p_Mass);
+        std::array<int, 2> ind = utils::binarySearch(NANJING_MASSES_MIDPOINTS, p_Mass);
         return ind[1];
     }
 }
@@ -1362,7 +1369,7 @@ double BaseStar::InterpolateGe20QCrit( const QCRIT_PRESCRIPTION p_qCritPrescript
     std::vector< std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>>> 
         radiiQCritsZetasFromGe20 = std::get<1>(GE20_QCRIT_AND_ZETA);
 
-    std::vector<int> ind = utils::binarySearch(massesFromGe20, m_Mass);
+    std::array<int, 2> ind = utils::binarySearch(massesFromGe20, m_Mass);
     int lowerMassInd = ind[0];
     int upperMassInd = ind[1];
 
@@ -1394,7 +1401,7 @@ double BaseStar::InterpolateGe20QCrit( const QCRIT_PRESCRIPTION p_qCritPrescript
     }
 
     // Get vector of radii from GE20_QCRIT_AND_ZETA for both lower and upper masses
-    std::vector<int> indR0 = utils::binarySearch(logRadiusVectorLowerMass, log10(m_Radius));
+    std::array<int, 2> indR0 = utils::binarySearch(logRadiusVectorLowerMass, log10(m_Radius));
     double lowerRadiusLowerMassInd = indR0[0];
     double upperRadiusLowerMassInd = indR0[1];
 
@@ -1407,7 +1414,7 @@ double BaseStar::InterpolateGe20QCrit( const QCRIT_PRESCRIPTION p_qCritPrescript
         upperRadiusLowerMassInd = logRadiusVectorLowerMass.size(); 
     }
 
-    std::vector<int> indR1 = utils::binarySearch(logRadiusVectorUpperMass, log10(m_Radius));
+    std::array<int, 2> indR1 = utils::binarySearch(logRadiusVectorUpperMass, log10(m_Radius));
     double lowerRadiusUpperMassInd = indR1[0];
     double upperRadiusUpperMassInd = indR1[1];
 
@@ -3139,23 +3146,6 @@ double BaseStar::CalculateConvectiveEnvelopeBindingEnergy(const double p_CoreMas
 ///////////////////////////////////////////////////////////////////////////////////////
 
 
-/*
- * Determines if the star is one of a list of stellar types passed
- *
- *
- * bool IsOneOf(const STELLAR_TYPE_LIST p_List)
- *
- * @param   [IN]    p_List                      List of stellar types
- * @return                                      Boolean - true if star is in list, false if not
- */
-bool BaseStar::IsOneOf(const STELLAR_TYPE_LIST p_List) const {
-    for (auto elem: p_List) {
-        if (m_StellarType == elem) return true;
-    }
-	return false;
-}
-
-
 /*
  * Limit timestep to 1% mass change
  *
@@ -3183,6 +3173,50 @@ double BaseStar::LimitTimestep(const double p_Dt) {
 }
 
 
+/*
+ * Calculate giant branch parameters and timescales - memoised
+ *
+ * The giant branch parameters (m_GBParams) and timescales (m_Timescales) for the current stellar type
+ * depend only on the star's effective initial mass (m_Mass0) and metallicity (the remaining inputs -
+ * mass cutoffs, a(n) and b(n) coefficients etc. - are fixed at birth) and, for low-mass CHeB stars
+ * and the stellar types derived from CHeB, the core mass (see GBParamsAndTimescalesDependOnCoreMass()),
+ * but are recalculated before every timestep.  m_Mass0 is often unchanged from one timestep to the
+ * next (e.g. no winds, or the non-donor star in a binary), and the calculations are expensive (lots
+ * of calls to pow()), so the values are recalculated here only if the stellar type, m_Mass0 or
+ * metallicity (or, if required, the core mass) have changed since they were last calculated.
+ *
+ * Code that writes m_GBParams or m_Timescales using other inputs (e.g. EAGB::ResolveEnvelopeLoss())
+ * must call InvalidateGBParamsAndTimescales() so the values are recalculated the next time this
+ * function is called.
+ *
+ * Hits and misses are reported by the profiling code (see profiling.h).
+ *
+ *
+ * void CalculateGBParamsAndTimescales()
+ */
+void BaseStar::CalculateGBParamsAndTimescales() {
+
+    bool hit = m_GBParamsAndTimescalesValid                                     &&
+               m_GBParamsAndTimescalesStellarType  == m_StellarType             &&
+               m_GBParamsAndTimescalesMass0        == m_Mass0                   &&      // exact comparison - don't use utils::Compare() here
+               m_GBParamsAndTimescalesMetallicity  == m_Metallicity             &&
+               (!GBParamsAndTimescalesDependOnCoreMass() || m_GBParamsAndTimescalesCoreMass == m_CoreMass);
+
+    PMEMO(hit);
+
+    if (hit) return;                                                                    // nothing to do
+
+    CalculateGBParams();                                                                // calculate giant branch parameters
+    CalculateTimescales();                                                              // calculate timescales
+
+    m_GBParamsAndTimescalesValid       = true;
+    m_GBParamsAndTimescalesStellarType = m_StellarType;
+    m_GBParamsAndTimescalesMass0       = m_Mass0;
+    m_GBParamsAndTimescalesMetallicity = m_Metallicity;
+    m_GBParamsAndTimescalesCoreMass    = m_CoreMass;
+}
+
+
 /*
  * Calculate next timestep for stellar evolution
  *
@@ -3200,8 +3234,7 @@ double BaseStar::CalculateTimestep() {
     // calls this functiom, the GBParams and Timescale functions
     // are called here
 
-    CalculateGBParams();                                                                // calculate giant branch parameters
-    CalculateTimescales();                                                              // calculate timescales
+    CalculateGBParamsAndTimescales();                                                   // calculate giant branch parameters and timescales (memoised)
 
     double dt = ChooseTimestep(m_Age);
 
@@ -3248,8 +3281,7 @@ void BaseStar::UpdateAttributesAndAgeOneTimestepPreamble(const double p_DeltaMas
     // always abvious where we need to do this...  A project for another
     // time.
 
-    CalculateGBParams();                                                                            // calculate giant branch parameters
-    CalculateTimescales();                                                                          // calculate timescales
+    CalculateGBParamsAndTimescales();                                                               // calculate giant branch parameters and timescales (memoised)
 }
 
 
@@ -69,7 +69,7 @@ public:
             bool                IsHeSD() const                                                  { return (m_SupernovaDetails.events.current & SN_EVENT::HeSD) == SN_EVENT::HeSD; }
     virtual bool                IsDegenerate() const                                            { return false; }   // default is not degenerate - White Dwarfs, NS and BH are degenerate
             bool                IsECSN() const                                                  { return (m_SupernovaDetails.events.current & SN_EVENT::ECSN) == SN_EVENT::ECSN; }
-            bool                IsOneOf(const STELLAR_TYPE_LIST p_List) const;
+            bool                IsOneOf(const STELLAR_TYPE_LIST p_List) const                   { return utils::IsOneOf(m_StellarType, p_List); }
             bool                IsPISN() const                                                  { return (m_SupernovaDetails.events.current & SN_EVENT::PISN) == SN_EVENT::PISN; }
             bool                IsPPISN() const                                                 { return (m_SupernovaDetails.events.current & SN_EVENT::PPISN) == SN_EVENT::PPISN; }
             bool                IsSNIA() const                                                  { return (m_SupernovaDetails.events.current & SN_EVENT::SNIA) == SN_EVENT::SNIA; }
@@ -362,6 +362,13 @@ protected:
     DBL_VECTOR              m_MassCutoffs;                              // Mass cutoffs
     DBL_VECTOR              m_Timescales;                               // Timescales
 
+    // Memoisation of m_GBParams and m_Timescales - see CalculateGBParamsAndTimescales()
+    bool                    m_GBParamsAndTimescalesValid;               // m_GBParams and m_Timescales are valid for the key below
+    STELLAR_TYPE            m_GBParamsAndTimescalesStellarType;         // Stellar type for which m_GBParams and m_Timescales were calculated
+    double                  m_GBParamsAndTimescalesMass0;               // Mass0 for which m_GBParams and m_Timescales were calculated
+    double                  m_GBParamsAndTimescalesMetallicity;         // Metallicity for which m_GBParams and m_Timescales were calculated
+    double                  m_GBParamsAndTimescalesCoreMass;            // Core mass for which m_GBParams and m_Timescales were calculated (only checked if GBParamsAndTimescalesDependOnCoreMass())
+
     // Luminosity, Radius, a(n) and b(n) coefficients
     DBL_VECTOR              m_AnCoefficients;                           // a(n) coefficients
     DBL_VECTOR              m_BnCoefficients;                           // b(n) coefficients
@@ -423,6 +430,8 @@ protected:
 
     virtual double              CalculateEddingtonCriticalRate() const                                                  { return 2.08E-3 / 1.7 * m_Radius * MYR_TO_YEAR * OPTIONS->EddingtonAccretionFactor() ; }                          // Hurley+, 2002, Eq. (67)
 
+            void                CalculateGBParamsAndTimescales();
+
             double              CalculateGBRadiusXExponent() const;
 
     virtual double              CalculateHeCoreMassAtPhaseEnd() const                                                   { return m_HeCoreMass; }                                                    // Default is NO-OP
@@ -553,7 +562,22 @@ protected:
                                                     const double p_RemnantMass) const;
 
             double              CalculateLambdaNanjing() const;
-    virtual void                EvolveOneTimestepPreamble() { };                                                                                                                                    // Default is NO-OP
+
+    // Nanjing lambda fits: evaluate the 5th order polynomials (coefficients p_A and p_B) at p_X - powers of p_X shared by both polynomials
+    static  void                EvaluateLambdaNanjingPolynomials(const NANJING_COEFFS &p_A,
+                                                                 const NANJING_COEFFS &p_B,
+                                                                 const double          p_X,
+                                                                       double         &p_Y1,
+                                                                       double         &p_Y2) {
+                                    double x2 = p_X * p_X;
+                                    double x3 = x2 * p_X;
+                                    double x4 = x2 * x2;
+                                    double x5 = x3 * x2;
+                                    p_Y1 = p_A[0] + (p_A[1] * p_X) + (p_A[2] * x2) + (p_A[3] * x3) + (p_A[4] * x4) + (p_A[5] * x5);
+                                    p_Y2 = p_B[0] + (p_B[1] * p_X) + (p_B[2] * x2) + (p_B[3] * x3) + (p_B[4] * x4) + (p_B[5] * x5);
+                                }
+
+    virtual void                EvolveOneTimestepPreamble() { };                                                                                                                                  // Default is NO-OP
 
             STELLAR_TYPE        EvolveOnPhase();
 
@@ -588,6 +612,10 @@ protected:
     virtual void                PerturbLuminosityAndRadiusAtPhaseEnd()                                                  { PerturbLuminosityAndRadiusOnPhase(); }                                    // Same as on phase
     virtual void                PerturbLuminosityAndRadiusOnPhase()                                                     { PerturbLuminosityAndRadius(); }
 
+    virtual bool                GBParamsAndTimescalesDependOnCoreMass() const                                           { return false; }                                                           // Default is no - see CalculateGBParamsAndTimescales()
+
+            void                InvalidateGBParamsAndTimescales()                                                       { m_GBParamsAndTimescalesValid = false; }                                   // Force recalculation at next CalculateGBParamsAndTimescales()
+
             STELLAR_TYPE        ResolveEndOfPhase();
     virtual void                ResolveHeliumFlash() { }
     virtual STELLAR_TYPE        ResolveSkippedPhase()                                                                   { return EvolveToNextPhase(); }                                             // Default is evolve to next phase
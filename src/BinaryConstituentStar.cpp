@@ -307,7 +307,7 @@ void BinaryConstituentStar::ResolveCommonEnvelopeAccretion(double p_FinalMass) {
     double deltaMass;
     
     // LvS: todo: more consisten super eddington accretion during CE should also affect e.g. MS stars
-    if (IsOneOf({ STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE})) {                          
+    if (IsOneOf(StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE))) {                          
         deltaMass = CalculateMassAccretedForCO(Mass(), m_Companion->Mass(), m_Companion->Radius());
         m_MassTransferDiff = deltaMass;
     }
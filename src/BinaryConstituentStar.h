@@ -5,6 +5,7 @@
 #include "typedefs.h"
 #include "profiling.h"
 #include "utils.h"
+#include "ObjectPool.h"
 
 #include "Star.h"
 
@@ -134,6 +135,9 @@ public:
 
     ~BinaryConstituentStar() { }
 
+    // objects are allocated from a pool rather than the heap - see ObjectPool.h
+    POOLED_ALLOCATION(BinaryConstituentStar)
+
 
     // object identifiers - all classes have these
     OBJECT_ID       ObjectId() const                                                    { return m_ObjectId; }
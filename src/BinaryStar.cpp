@@ -12,6 +12,17 @@ BinaryStar::BinaryStar(const unsigned long int p_Seed, const long int p_Id) : m_
 }
 
 
+// binary is a copy of a fork point snapshot
+BinaryStar::BinaryStar(const BaseBinaryStar& p_ForkPoint) : m_BinaryStar(new BaseBinaryStar(p_ForkPoint)) {
+
+    m_ObjectId       = globalObjectId++;
+    m_ObjectType     = OBJECT_TYPE::BINARY_STAR;
+    m_StellarType    = STELLAR_TYPE::BINARY_STAR;
+
+    m_SaveBinaryStar = nullptr;
+}
+
+
 /*
  * Save current state of binary star
  *
@@ -54,33 +65,3 @@ bool BinaryStar::RevertState() {
     return result;
 }
 
-
-/*
- * Print BSE Switch Log record
- * 
- * Called from main() when SIGUSR1 received - raised by Star::SwitchTo() to indicate a stellar type switch.
- * Here we use the switch parameters stored in the LOGGING service singleton by Star:SwitchTo() to determine
- * whether it is the primary or the secondary switching, then call BinaryStar::PrintSwitchLog() with the
- * appropriate parameters to print the log file record.
- * 
- * BinaryStar::PrintSwitchLog()
- *
- * @return                                      Boolean flag indicating success/failure (true = success)
- */
-bool BinaryStar::PrintSwitchLog() { 
-    
-    bool result = true;
-
-    OBJECT_ID primaryObjectId   = m_BinaryStar->Star1()->StarObjectId();
-    OBJECT_ID secondaryObjectId = m_BinaryStar->Star2()->StarObjectId();
-    OBJECT_ID objectIdSwitching = LOGGING->ObjectIdSwitching();
-
-         if (objectIdSwitching == primaryObjectId  ) result = m_BinaryStar->PrintSwitchLog(true);   // primary
-    else if (objectIdSwitching == secondaryObjectId) result = m_BinaryStar->PrintSwitchLog(false);  // secondary
-    else {                                                                                          // otherwise...
-        SHOW_ERROR(ERROR::OUT_OF_BOUNDS, "Expected primary or secondary for BSE Switch Log");       // announce error
-        result = false;
-    }
-
-    return result;
-}
@@ -3,6 +3,7 @@
 
 #include "constants.h"
 #include "typedefs.h"
+#include "ObjectPool.h"
 
 #include "BaseBinaryStar.h"
 
@@ -26,6 +27,9 @@ public:
 
     BinaryStar(const unsigned long int p_Seed, const long int p_Id);
 
+    // Resume from a fork point snapshot taken by BaseBinaryStar::Evolve() - see EvolveFromForkPoint()
+    explicit BinaryStar(const BaseBinaryStar& p_ForkPoint);
+
     // Copy constructor
     BinaryStar(const BinaryStar& p_Star) {
 
@@ -56,6 +60,9 @@ public:
 
     virtual ~BinaryStar() { delete m_BinaryStar; delete m_SaveBinaryStar; }
 
+    // objects are allocated from a pool rather than the heap - see ObjectPool.h
+    POOLED_ALLOCATION(BinaryStar)
+
 
     // object identifiers - all classes have these
     OBJECT_ID           ObjectId() const            { return m_ObjectId; }
@@ -65,7 +72,8 @@ public:
 
     // member functions
     long int            Id()                        { return m_BinaryStar->Id(); }
-    EVOLUTION_STATUS    Evolve()                    { return m_BinaryStar->Evolve(); }
+    EVOLUTION_STATUS    Evolve(BaseBinaryStar** p_ForkPoint = nullptr)  { return m_BinaryStar->Evolve(p_ForkPoint); }
+    EVOLUTION_STATUS    EvolveFromForkPoint(const long int p_Id)        { return m_BinaryStar->EvolveFromForkPoint(p_Id); }
     bool                RevertState();
     void                SaveState();
     STELLAR_TYPE        Star1InitialType()          { return m_BinaryStar->InitialStellarType1(); }
@@ -73,8 +81,6 @@ public:
     STELLAR_TYPE        Star2InitialType()          { return m_BinaryStar->InitialStellarType2(); }
     STELLAR_TYPE        Star2Type()                 { return m_BinaryStar->StellarType2(); }
 
-    bool                PrintSwitchLog();
-
 private:
 
     BinaryStar() { }
@@ -127,10 +127,10 @@ double CHeB::CalculateLambdaDewi() const {
  */
 double CHeB::CalculateLambdaNanjingEnhanced(const int p_MassInd, const int p_Zind) const {
 
-	DBL_VECTOR maxBG    = {};                                                       // [0] = maxB, [1] = maxG
-	DBL_VECTOR lambdaBG = {};                                                       // [0] = lambdaB, [1] = lambdaG
-	DBL_VECTOR a        = {};                                                       // 0..5 a_coefficients
-	DBL_VECTOR b        = {};                                                       // 0..5 b_coefficients
+	NANJING_BG maxBG    = {};                                                       // [0] = maxB, [1] = maxG
+	NANJING_BG lambdaBG = NANJING_BG_NONE;                                          // [0] = lambdaB, [1] = lambdaG (NaN = not yet calculated)
+	NANJING_COEFFS a    = {};                                                       // 0..5 a_coefficients
+	NANJING_COEFFS b    = {};                                                       // 0..5 b_coefficients
     double     Rmax     = std::numeric_limits<double>::max();                       // Upper R limit to applicability of Nanjing polynomials.
 
     switch(p_Zind) {
@@ -413,29 +413,15 @@ double CHeB::CalculateLambdaNanjingEnhanced(const int p_MassInd, const int p_Zin
             break;
         }
 
-    if (lambdaBG.empty()) {
+    if (std::isnan(lambdaBG[0])) {
         if ( (p_Zind == 1) && (p_MassInd == 0) ) {                        // Pop. I metallicity and M = 1 Msun
-            double x  = (m_Mass - m_CoreMass) / m_Mass;
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, (m_Mass - m_CoreMass) / m_Mass, y1, y2);
             lambdaBG = { 1.0 / y1, 1.0 / y2 };
         }
         else {
-            double x  = std::min(m_Radius, Rmax);                           // Evaluate lambda with maximum allowed radius to prevent exceeding domain of the polynomial fits
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, std::min(m_Radius, Rmax), y1, y2);  // Evaluate lambda with maximum allowed radius to prevent exceeding domain of the polynomial fits
             lambdaBG = { y1, y2 };
         }
     }
@@ -474,10 +460,10 @@ double CHeB::CalculateLambdaNanjingEnhanced(const int p_MassInd, const int p_Zin
  */
 double CHeB::CalculateLambdaNanjingStarTrack(const double p_Mass, const double p_Metallicity) const {
 
-	DBL_VECTOR maxBG    = {};                                                       // [0] = maxB, [1] = maxG
-	DBL_VECTOR lambdaBG = {};                                                       // [0] = lambdaB, [1] = lambdaG
-	DBL_VECTOR a        = {};                                                       // 0..5 a_coefficients
-	DBL_VECTOR b        = {};                                                       // 0..5 b_coefficients
+	NANJING_BG maxBG    = {};                                                       // [0] = maxB, [1] = maxG
+	NANJING_BG lambdaBG = NANJING_BG_NONE;                                          // [0] = lambdaB, [1] = lambdaG (NaN = not yet calculated)
+	NANJING_COEFFS a    = {};                                                       // 0..5 a_coefficients
+	NANJING_COEFFS b    = {};                                                       // 0..5 b_coefficients
 
     if (utils::Compare(p_Metallicity, LAMBDA_NANJING_ZLIMIT) > 0) {                 // Z>0.5 Zsun: popI
         if (utils::Compare(p_Mass, 1.5) < 0) {
@@ -753,29 +739,15 @@ double CHeB::CalculateLambdaNanjingStarTrack(const double p_Mass, const double p
         }
     }
 
-    if (lambdaBG.empty()) {                                                 // calculate lambda B & G - not approximated by hand
+    if (std::isnan(lambdaBG[0])) {                                          // calculate lambda B & G - not approximated by hand
         if (utils::Compare(p_Metallicity, LAMBDA_NANJING_ZLIMIT) > 0 && utils::Compare(p_Mass, 1.5) < 0) {
-            double x  = (m_Mass - m_CoreMass) / m_Mass;
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, (m_Mass - m_CoreMass) / m_Mass, y1, y2);
             lambdaBG = { 1.0 / y1, 1.0 / y2 };
         }
         else {
-            double x  = m_Radius;
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, m_Radius, y1, y2);
             lambdaBG = { y1, y2 };
         }
     }
@@ -1492,6 +1464,7 @@ STELLAR_TYPE CHeB::ResolveEnvelopeLoss(bool p_NoCheck) {
 
         CalculateTimescales(m_Mass0, m_Timescales);
         CalculateGBParams(m_Mass0, m_GBParams);
+        InvalidateGBParamsAndTimescales();                                          // m_Timescales and m_GBParams calculated directly above - force recalculation
 
         m_Luminosity = HeMS::CalculateLuminosityOnPhase_Static(m_Mass, m_Tau);
         m_Radius     = HeMS::CalculateRadiusOnPhase_Static(m_Mass, m_Tau);
@@ -112,6 +112,8 @@ protected:
 
     STELLAR_TYPE    EvolveToNextPhase();
 
+    bool            GBParamsAndTimescalesDependOnCoreMass() const               { return utils::Compare(m_Mass0, m_MassCutoffs[static_cast<int>(MASS_CUTOFF::MHeF)]) < 0; } // tHe depends on the core mass for low-mass stars - see CalculateLifetimeOnPhase()
+
     bool            IsEndOfPhase() const                                        { return !ShouldEvolveOnPhase(); }                                              // Phase ends when age at or after He Burning
     bool            IsSupernova() const                                         { return false; }                                                               // Not here
 
@@ -0,0 +1,1032 @@
+// Native cosmic integration of COMPAS BSE output
+//
+// Built as a separate executable (see the Makefile target 'cosmic-integration') - see
+// CosmicIntegration.h for a description of the method and the differences from the
+// Python implementation in compas_python_utils/cosmic_integration/FastCosmicIntegration.py
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+
+#include <boost/program_options.hpp>
+
+#include "CosmicIntegration.h"
+
+namespace po = boost::program_options;
+
+
+// WMAP9 cosmology (as astropy.cosmology.WMAP9)
+constexpr double WMAP9_H0                       = 69.32;                                                        // km s^-1 Mpc^-1
+constexpr double WMAP9_OMEGA_M0                 = 0.2865;
+constexpr double WMAP9_T_CMB0                   = 2.725;                                                        // K
+constexpr double WMAP9_N_EFF                    = 3.04;
+
+constexpr double SPEED_OF_LIGHT_KM_S            = 299792.458;                                                   // km s^-1
+constexpr double MPC_KM                         = 3.0856775814913673E19;                                        // km in a Mpc
+constexpr double MYR_S                          = 3.15576E13;                                                   // s in a (Julian) Myr
+
+constexpr int    CI_REDSHIFT_TILE               = 512;                                                          // redshift bins per kernel tile - merger & detection totals for a tile stay in L1
+constexpr int    CI_COSMOLOGY_STEPS             = 20000;                                                        // Simpson intervals for the age of the Universe at the maximum redshift
+constexpr int    CI_IMF_STEPS                   = 2000;                                                         // Simpson intervals (in log mass) per IMF segment
+constexpr int    CI_N_THETAS                    = 1000000;                                                      // Finn & Chernoff projection factor samples
+constexpr unsigned long CI_THETA_SEED           = 1234567UL;                                                    // seed for projection factor samples
+
+const std::string BSE_DCO_GROUP                 = "BSE_Double_Compact_Objects";
+const std::string BSE_CE_GROUP                  = "BSE_Common_Envelopes";
+const std::string BSE_SYSPARMS_GROUP            = "BSE_System_Parameters";
+
+
+/*
+ * Composite Simpson's rule
+ *
+ * double Simpson(F p_F, const double p_Lo, const double p_Hi, const int p_N)
+ *
+ * @param   [IN]    p_F                         Integrand
+ * @param   [IN]    p_Lo                        Lower limit
+ * @param   [IN]    p_Hi                        Upper limit
+ * @param   [IN]    p_N                         Number of intervals (rounded up to even)
+ * @return                                      Integral of p_F from p_Lo to p_Hi
+ */
+template <typename F>
+double Simpson(F p_F, const double p_Lo, const double p_Hi, const int p_N) {
+    int    n   = p_N + (p_N % 2);
+    double h   = (p_Hi - p_Lo) / n;
+    double sum = p_F(p_Lo) + p_F(p_Hi);
+    for (int i = 1; i < n; i++) sum += p_F(p_Lo + i * h) * (i % 2 == 0 ? 2.0 : 4.0);
+    return sum * h / 3.0;
+}
+
+
+CosmicIntegrator::CosmicIntegrator(const CosmicIntegrationParametersT& p_Parameters) {
+
+    m_Parameters                 = p_Parameters;
+
+    m_FileId                     = -1;
+
+    m_NRedshifts                 = 0;
+    m_NRedshiftsDetection        = 0;
+    m_TimeFirstSF                = 0.0;
+
+    m_UseMetallicityDistribution = false;
+    m_PDrawMetallicity           = 1.0;
+
+    m_NMc                        = 0;
+    m_NEta                       = 0;
+
+    m_NSystems                   = 0;
+    m_MinZ                       = 0.0;
+    m_MaxZ                       = 0.0;
+    m_SampledM1Min               = 0.0;
+    m_SampledM1Max               = 0.0;
+    m_SampledM2Min               = 0.0;
+
+    m_NBinaries                  = 0;
+}
+
+
+/*
+ * Return the number of entries in a (1-d) dataset
+ *
+ * hsize_t DatasetSize(const std::string p_Group, const std::string p_Dataset)
+ *
+ * @param   [IN]    p_Group                     HDF5 group name
+ * @param   [IN]    p_Dataset                   HDF5 dataset name
+ * @return                                      Number of entries in dataset (0 if the dataset does not exist)
+ */
+hsize_t CosmicIntegrator::DatasetSize(const std::string p_Group, const std::string p_Dataset) const {
+
+    hsize_t size = 0;
+
+    std::string path = p_Group + "/" + p_Dataset;
+    if (H5Lexists(m_FileId, p_Group.c_str(), H5P_DEFAULT) > 0 && H5Lexists(m_FileId, path.c_str(), H5P_DEFAULT) > 0) {
+        hid_t dataset = H5Dopen(m_FileId, path.c_str(), H5P_DEFAULT);
+        if (dataset >= 0) {
+            hid_t   dataspace = H5Dget_space(dataset);
+            hsize_t dims[1]   = { 0 };
+            if (H5Sget_simple_extent_ndims(dataspace) == 1) {
+                H5Sget_simple_extent_dims(dataspace, dims, NULL);
+                size = dims[0];
+            }
+            H5Sclose(dataspace);
+            H5Dclose(dataset);
+        }
+    }
+
+    return size;
+}
+
+
+/*
+ * Read a chunk of a (1-d) dataset
+ *
+ * The dataset is read via a hyperslab selection, so only the chunk requested is read from
+ * the file.  HDF5 converts the stored datatype to the memory datatype (so, for example,
+ * stellar types and boolean flags can be read as doubles).
+ *
+ * bool ReadChunk(const std::string p_Group, const std::string p_Dataset, const hsize_t p_Start, const hsize_t p_Count, T& p_Values)
+ *
+ * @param   [IN]    p_Group                     HDF5 group name
+ * @param   [IN]    p_Dataset                   HDF5 dataset name
+ * @param   [IN]    p_Start                     Index of first entry to read
+ * @param   [IN]    p_Count                     Number of entries to read
+ * @param   [OUT]   p_Values                    Values read
+ * @return                                      Boolean status (true = ok)
+ */
+template <typename T>
+static bool ReadDatasetChunk(const hid_t p_FileId, const hid_t p_MemType, const std::string p_Group, const std::string p_Dataset, const hsize_t p_Start, const hsize_t p_Count, std::vector<T>& p_Values) {
+
+    bool ok = false;
+
+    p_Values.resize(p_Count);
+    if (p_Count == 0) return true;
+
+    std::string path    = p_Group + "/" + p_Dataset;
+    hid_t       dataset = H5Dopen(p_FileId, path.c_str(), H5P_DEFAULT);
+    if (dataset < 0) {
+        std::cerr << "ERROR: Unable to open dataset " << path << std::endl;
+    }
+    else {
+        hid_t   dataspace = H5Dget_space(dataset);
+        hsize_t start[1]  = { p_Start };
+        hsize_t count[1]  = { p_Count };
+        hid_t   memspace  = H5Screate_simple(1, count, NULL);
+
+        if (H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, start, NULL, count, NULL) >= 0 &&
+            H5Dread(dataset, p_MemType, memspace, dataspace, H5P_DEFAULT, p_Values.data()) >= 0) ok = true;
+        else std::cerr << "ERROR: Unable to read dataset " << path << std::endl;
+
+        H5Sclose(memspace);
+        H5Sclose(dataspace);
+        H5Dclose(dataset);
+    }
+
+    return ok;
+}
+
+bool CosmicIntegrator::ReadChunk(const std::string p_Group, const std::string p_Dataset, const hsize_t p_Start, const hsize_t p_Count, std::vector<double>& p_Values) const {
+    return ReadDatasetChunk(m_FileId, H5T_NATIVE_DOUBLE, p_Group, p_Dataset, p_Start, p_Count, p_Values);
+}
+
+bool CosmicIntegrator::ReadChunk(const std::string p_Group, const std::string p_Dataset, const hsize_t p_Start, const hsize_t p_Count, std::vector<unsigned long long>& p_Values) const {
+    return ReadDatasetChunk(m_FileId, H5T_NATIVE_ULLONG, p_Group, p_Dataset, p_Start, p_Count, p_Values);
+}
+
+
+/*
+ * Calculate the redshift grid, and the age of the Universe, luminosity distance and comoving
+ * shell volume at each redshift - as calculate_redshift_related_params() in FastCosmicIntegration.py
+ *
+ * Flat WMAP9 cosmology, including photons and (massless) neutrinos.  The age of the Universe at
+ * the maximum redshift is integrated directly, and ages at lower redshifts (and the comoving
+ * distance at higher redshifts) are accumulated step by step along the redshift grid.
+ *
+ * void CalculateRedshiftRelatedParams()
+ */
+void CosmicIntegrator::CalculateRedshiftRelatedParams() {
+
+    double h            = WMAP9_H0 / 100.0;
+    double omegaGamma0  = 4.48150052E-7 * std::pow(WMAP9_T_CMB0, 4.0) / (h * h);
+    double omegaNu0     = 0.22710731766 * WMAP9_N_EFF * omegaGamma0;
+    double omegaR0      = omegaGamma0 + omegaNu0;
+    double omegaM0      = WMAP9_OMEGA_M0;
+    double omegaDE0     = 1.0 - omegaM0 - omegaR0;
+
+    double hubbleTime   = MPC_KM / WMAP9_H0 / MYR_S;                                                            // Myr
+    double hubbleDist   = SPEED_OF_LIGHT_KM_S / WMAP9_H0;                                                       // Mpc
+
+    // dt = t_H * a da / sqrt(Om a + Or + OL a^4) - regular at a = 0
+    auto dAge = [&](const double a) { return a / std::sqrt(omegaM0 * a + omegaR0 + omegaDE0 * a * a * a * a); };
+    auto age  = [&](const double z) { return hubbleTime * Simpson(dAge, 0.0, 1.0 / (1.0 + z), CI_COSMOLOGY_STEPS); };
+
+    // dDc = D_H dz / E(z)
+    auto dDc  = [&](const double z) { double zp1 = 1.0 + z; return 1.0 / std::sqrt(omegaM0 * zp1 * zp1 * zp1 + omegaR0 * zp1 * zp1 * zp1 * zp1 + omegaDE0); };
+
+    double dz           = m_Parameters.redshiftStep;
+    m_NRedshifts        = static_cast<int>(std::llround(m_Parameters.maxRedshift / dz)) + 1;
+    m_NRedshiftsDetection = static_cast<int>(m_Parameters.maxRedshiftDetection / dz);
+
+    m_Redshifts.resize(m_NRedshifts);
+    m_Times.resize(m_NRedshifts);
+    m_Distances.resize(m_NRedshifts);
+    m_ShellVolumes.resize(m_NRedshifts);
+
+    for (int i = 0; i < m_NRedshifts; i++) m_Redshifts[i] = i * dz;
+
+    // ages - from the maximum redshift down
+    m_Times[m_NRedshifts - 1] = age(m_Redshifts[m_NRedshifts - 1]);
+    for (int i = m_NRedshifts - 2; i >= 0; i--) {
+        m_Times[i] = m_Times[i + 1] + hubbleTime * Simpson(dAge, 1.0 / (1.0 + m_Redshifts[i + 1]), 1.0 / (1.0 + m_Redshifts[i]), 4);
+    }
+    m_TimeFirstSF = age(m_Parameters.zFirstSF);
+
+    // comoving distances (and volumes) - from redshift 0 up
+    std::vector<double> volumes(m_NRedshifts);
+    double comovingDistance = 0.0;
+    for (int i = 0; i < m_NRedshifts; i++) {
+        if (i > 0) comovingDistance += hubbleDist * Simpson(dDc, m_Redshifts[i - 1], m_Redshifts[i], 4);
+        m_Distances[i] = comovingDistance * (1.0 + m_Redshifts[i]);                                              // luminosity distance (Mpc)
+        volumes[i]     = 4.0 * M_PI / 3.0 * comovingDistance * comovingDistance * comovingDistance / 1.0E9;     // Gpc^3
+    }
+    m_Distances[0] = 0.001;                                                                                     // avoid division by 0
+
+    // shell volumes - duplicate last shell to keep same length
+    for (int i = 0; i < m_NRedshifts - 1; i++) m_ShellVolumes[i] = volumes[i + 1] - volumes[i];
+    m_ShellVolumes[m_NRedshifts - 1] = m_NRedshifts > 1 ? m_ShellVolumes[m_NRedshifts - 2] : 0.0;
+}
+
+
+/*
+ * Calculate the star forming mass evolved per binary sampled by COMPAS - the analytic equivalent
+ * of COMPASData.find_star_forming_mass_per_binary_sampling() in ClassCOMPAS.py
+ *
+ * Primary masses are drawn from a Kroupa (2001) IMF on [0.01, 200] Msol, mass ratios are
+ * uniform on [0, 1], and a fraction fBin of stars are in binaries.  COMPAS only samples
+ * binaries with primary mass in [M1min, M1max] and secondary mass above M2min, so
+ *
+ *     mass evolved per binary = <m1> (1 + fBin / 2) / (fBin * Integral[M1min, M1max] xi(m) (1 - qmin(m)) dm)
+ *
+ * where xi is the (normalised) IMF and qmin(m) = min(1, M2min / m).
+ *
+ * double StarFormingMassPerBinary()
+ *
+ * @return                                      Star forming mass evolved per binary (Msol)
+ */
+double CosmicIntegrator::StarFormingMassPerBinary() const {
+
+    const double m1 = 0.01, m2 = 0.08, m3 = 0.5, m4 = 200.0;
+    const double a12 = 0.3, a23 = 1.3, a34 = 2.3;
+
+    // unnormalised, continuous broken power law
+    auto xi = [&](const double m) {
+        if (m < m1 || m > m4) return 0.0;
+        if (m < m2) return std::pow(m, -a12);
+        if (m < m3) return std::pow(m2, a23 - a12) * std::pow(m, -a23);
+        return std::pow(m2, a23 - a12) * std::pow(m3, a34 - a23) * std::pow(m, -a34);
+    };
+
+    // integrate f(m) dm in log mass, splitting at the IMF break points (and any other points supplied)
+    auto integrate = [&](std::function<double(double)> f, const double lo, const double hi, std::vector<double> breaks) {
+        breaks.push_back(m2); breaks.push_back(m3);
+        std::vector<double> edges = { lo, hi };
+        for (auto b: breaks) if (b > lo && b < hi) edges.push_back(b);
+        std::sort(edges.begin(), edges.end());
+        double sum = 0.0;
+        for (size_t i = 0; i + 1 < edges.size(); i++) {
+            sum += Simpson([&](const double lnM) { double m = std::exp(lnM); return f(m) * m; }, std::log(edges[i]), std::log(edges[i + 1]), CI_IMF_STEPS);
+        }
+        return sum;
+    };
+
+    double m1Min = m_Parameters.useSampledMassRanges ? m_SampledM1Min : m_Parameters.m1Min;
+    double m1Max = m_Parameters.useSampledMassRanges ? m_SampledM1Max : m_Parameters.m1Max;
+    double m2Min = m_Parameters.useSampledMassRanges ? m_SampledM2Min : m_Parameters.m2Min;
+
+    double norm      = integrate(xi, m1, m4, {});
+    double meanMass  = integrate([&](const double m) { return m * xi(m); }, m1, m4, {}) / norm;
+    double fSampled  = integrate([&](const double m) { return xi(m) * (1.0 - std::min(1.0, m2Min / m)); }, m1Min, m1Max, { m2Min }) / norm;
+
+    return meanMass * (1.0 + 0.5 * m_Parameters.fBin) / (m_Parameters.fBin * fSampled);
+}
+
+
+/*
+ * Calculate the metallicity distribution (log skew normal in Z) at each redshift - as
+ * find_metallicity_distribution() in FastCosmicIntegration.py - and from it the formation
+ * rate per unit weight at each redshift for each metallicity bin used by the selected DCOs
+ *
+ * The distribution is normalised at each redshift over the full metallicity grid, but the
+ * formation rates are only stored for the (typically few) bins that DCOs fall in.
+ *
+ * void CalculateMetallicityDistribution()
+ */
+void CosmicIntegrator::CalculateMetallicityDistribution() {
+
+    double massPerBinary = StarFormingMassPerBinary();
+    std::cout << "Average_SF_mass_needed = " << std::setprecision(10) << massPerBinary * m_NSystems << " Msol" << std::endl;
+
+    // number of binaries formed per yr per Gpc^3 that each COMPAS binary represents
+    m_NFormed.resize(m_NRedshifts);
+    for (int i = 0; i < m_NRedshifts; i++) {
+        double zp1  = 1.0 + m_Redshifts[i];
+        double sfr  = m_Parameters.aSF * std::pow(zp1, m_Parameters.bSF) / (1.0 + std::pow(zp1 / m_Parameters.cSF, m_Parameters.dSF)) * 1.0E9;   // Msol yr^-1 Gpc^-3
+        m_NFormed[i] = sfr / (massPerBinary * m_NSystems);
+    }
+
+    m_UseMetallicityDistribution = std::log(m_MinZ) != std::log(m_MaxZ);
+
+    m_FormationRate.clear();
+    m_DCOBins.assign(m_DCOMetallicities.size(), 0);
+
+    if (!m_UseMetallicityDistribution) {                                                                        // all star formation at a single metallicity
+        m_FormationRate.push_back(m_NFormed);
+        return;
+    }
+
+    int nZ = static_cast<int>(std::llround((m_Parameters.maxLogZ - m_Parameters.minLogZ) / m_Parameters.stepLogZ)) + 1;
+    std::vector<double> logZ(nZ);
+    m_Metallicities.resize(nZ);
+    for (int k = 0; k < nZ; k++) {
+        logZ[k]            = m_Parameters.minLogZ + k * m_Parameters.stepLogZ;
+        m_Metallicities[k] = std::exp(logZ[k]);
+    }
+
+    m_PDrawMetallicity = 1.0 / (std::log(m_MaxZ) - std::log(m_MinZ));
+
+    // metallicity bin for each DCO (as np.digitize), and the bins used
+    std::vector<int> binIndex(nZ, -1);
+    std::vector<int> binsUsed;
+    for (size_t i = 0; i < m_DCOMetallicities.size(); i++) {
+        int k = static_cast<int>(std::upper_bound(m_Metallicities.begin(), m_Metallicities.end(), m_DCOMetallicities[i]) - m_Metallicities.begin());
+        k = std::min(k, nZ - 1);
+        if (binIndex[k] < 0) {
+            binIndex[k] = static_cast<int>(binsUsed.size());
+            binsUsed.push_back(k);
+        }
+        m_DCOBins[i] = binIndex[k];
+    }
+
+    m_FormationRate.assign(binsUsed.size(), std::vector<double>(m_NRedshifts, 0.0));
+
+    double beta = m_Parameters.alpha / std::sqrt(1.0 + m_Parameters.alpha * m_Parameters.alpha);
+    auto   pdf  = [](const double x) { return std::exp(-0.5 * x * x) / std::sqrt(2.0 * M_PI); };
+    auto   cdf  = [](const double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
+
+    for (int i = 0; i < m_NRedshifts; i++) {
+        double sigma = m_Parameters.sigma0 * std::pow(10.0, m_Parameters.sigmaz * m_Redshifts[i]);
+        double mean  = m_Parameters.mu0 * std::pow(10.0, m_Parameters.muz * m_Redshifts[i]);
+        double mu    = std::log(mean / 2.0 / (std::exp(0.5 * sigma * sigma) * cdf(beta * sigma)));
+
+        auto dPdlogZ = [&](const int k) { double x = (logZ[k] - mu) / sigma; return 2.0 / sigma * pdf(x) * cdf(m_Parameters.alpha * x); };
+
+        double norm = 0.0;
+        for (int k = 0; k < nZ; k++) norm += dPdlogZ(k);
+        norm *= m_Parameters.stepLogZ;
+
+        for (size_t b = 0; b < binsUsed.size(); b++) {
+            m_FormationRate[b][i] = m_NFormed[i] * dPdlogZ(binsUsed[b]) / norm / m_PDrawMetallicity;
+        }
+    }
+}
+
+
+/*
+ * Calculate the SNR of each (chirp mass, symmetric mass ratio) grid point at 1 Mpc, and the
+ * detection probability as a function of SNR - as compute_snr_and_detection_grids() in
+ * FastCosmicIntegration.py
+ *
+ * bool CalculateSNRAndDetectionGrids()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool CosmicIntegrator::CalculateSNRAndDetectionGrids() {
+
+    std::string datasetName;
+    if      (m_Parameters.sensitivity == "design") datasetName = "SimNoisePSDaLIGODesignSensitivityP1200087";
+    else if (m_Parameters.sensitivity == "O1")     datasetName = "P1500238_GW150914_H1-GDS-CALIB_STRAIN.txt";
+    else if (m_Parameters.sensitivity == "O3")     datasetName = "SimNoisePSDaLIGOMidHighSensitivityP1200087";
+    else {
+        std::cerr << "ERROR: Unknown sensitivity: " << m_Parameters.sensitivity << std::endl;
+        return false;
+    }
+
+    // read the SNR grid (SNR at 1 Mpc on a (m1, m2) grid)
+    hid_t fileId = H5Fopen(m_Parameters.snrGridFilename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (fileId < 0) {
+        std::cerr << "ERROR: Unable to open SNR grid file " << m_Parameters.snrGridFilename << std::endl;
+        return false;
+    }
+
+    std::vector<double> massAxis;
+    std::vector<double> snrGrid;
+    bool ok = false;
+
+    hid_t axisId = H5Dopen(fileId, "mass_axis", H5P_DEFAULT);
+    hid_t gridId = H5Dopen(fileId, ("snr_values/" + datasetName).c_str(), H5P_DEFAULT);
+    if (axisId >= 0 && gridId >= 0) {
+        hid_t    axisSpace = H5Dget_space(axisId);
+        hssize_t nMass     = H5Sget_simple_extent_npoints(axisSpace);
+        hid_t    gridSpace = H5Dget_space(gridId);
+        if (nMass > 1 && H5Sget_simple_extent_npoints(gridSpace) == nMass * nMass) {
+            massAxis.resize(nMass);
+            snrGrid.resize(nMass * nMass);
+            ok = H5Dread(axisId, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, massAxis.data()) >= 0 &&
+                 H5Dread(gridId, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, snrGrid.data()) >= 0;
+        }
+        H5Sclose(gridSpace);
+        H5Sclose(axisSpace);
+    }
+    if (gridId >= 0) H5Dclose(gridId);
+    if (axisId >= 0) H5Dclose(axisId);
+    H5Fclose(fileId);
+
+    if (!ok) {
+        std::cerr << "ERROR: Unable to read SNR grid " << datasetName << " from " << m_Parameters.snrGridFilename << std::endl;
+        return false;
+    }
+
+    // bilinear interpolation in log mass - points outside the grid are clamped to the grid edge,
+    // and missing (NaN) grid values are excluded from the interpolation
+    size_t nMass = massAxis.size();
+    std::vector<double> logMass(nMass);
+    for (size_t i = 0; i < nMass; i++) logMass[i] = std::log(massAxis[i]);
+
+    auto locate = [&](const double lnM, size_t& idx, double& frac) {
+        if (lnM <= logMass.front()) { idx = 0; frac = 0.0; return; }
+        if (lnM >= logMass.back())  { idx = nMass - 2; frac = 1.0; return; }
+        idx  = static_cast<size_t>(std::upper_bound(logMass.begin(), logMass.end(), lnM) - logMass.begin()) - 1;
+        frac = (lnM - logMass[idx]) / (logMass[idx + 1] - logMass[idx]);
+    };
+
+    auto snrAt1Mpc = [&](const double mass1, const double mass2) {
+        size_t i, j;
+        double fi, fj;
+        locate(std::log(mass1), i, fi);
+        locate(std::log(mass2), j, fj);
+        double corners[4] = { snrGrid[i * nMass + j], snrGrid[i * nMass + j + 1], snrGrid[(i + 1) * nMass + j], snrGrid[(i + 1) * nMass + j + 1] };
+        double weights[4] = { (1.0 - fi) * (1.0 - fj), (1.0 - fi) * fj, fi * (1.0 - fj), fi * fj };
+        double sum = 0.0, sumWeights = 0.0;
+        for (int k = 0; k < 4; k++) {
+            if (std::isnan(corners[k])) continue;
+            sum        += weights[k] * corners[k];
+            sumWeights += weights[k];
+        }
+        return sumWeights > 0.0 ? sum / sumWeights : 0.0;
+    };
+
+    m_NMc  = static_cast<int>(std::llround(m_Parameters.McMax / m_Parameters.McStep));
+    m_NEta = static_cast<int>(std::llround(m_Parameters.etaMax / m_Parameters.etaStep));
+    m_SNRAt1Mpc.resize(static_cast<size_t>(m_NEta) * m_NMc);
+
+    for (int e = 0; e < m_NEta; e++) {
+        double eta    = (e + 1) * m_Parameters.etaStep;
+        double mRatio = 0.5 * (1.0 + std::sqrt(std::max(0.0, 1.0 - 4.0 * eta)));
+        for (int c = 0; c < m_NMc; c++) {
+            double Mc = (c + 1) * m_Parameters.McStep;
+            double Mt = Mc / std::pow(eta, 0.6);
+            double M1 = Mt * mRatio;
+            m_SNRAt1Mpc[static_cast<size_t>(e) * m_NMc + c] = snrAt1Mpc(M1, Mt - M1);
+        }
+    }
+
+    // detection probability as a function of SNR (Finn & Chernoff 1993) - projection factors are
+    // drawn with a fixed seed so results are repeatable
+    std::mt19937_64 generator(CI_THETA_SEED);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    std::vector<double> thetas(CI_N_THETAS);
+    for (int i = 0; i < CI_N_THETAS; i++) {
+        double cosTheta = 2.0 * uniform(generator) - 1.0;
+        double cosInc   = 2.0 * uniform(generator) - 1.0;
+        double phi      = 2.0 * M_PI * uniform(generator);
+        double zeta     = 2.0 * M_PI * uniform(generator);
+        double Fp       = 0.5 * std::cos(2.0 * zeta) * (1.0 + cosTheta * cosTheta) * std::cos(2.0 * phi) - std::sin(2.0 * zeta) * cosTheta * std::sin(2.0 * phi);
+        double Fx       = 0.5 * std::sin(2.0 * zeta) * (1.0 + cosTheta * cosTheta) * std::cos(2.0 * phi) + std::cos(2.0 * zeta) * cosTheta * std::sin(2.0 * phi);
+        double cosIncSq = cosInc * cosInc;
+        thetas[i]       = std::sqrt(0.25 * Fp * Fp * (1.0 + cosIncSq) * (1.0 + cosIncSq) + Fx * Fx * cosIncSq);
+    }
+    std::sort(thetas.begin(), thetas.end());
+
+    int nSNR = static_cast<int>(std::llround(m_Parameters.snrMax / m_Parameters.snrStep));
+    m_DetectionProbabilityFromSNR.resize(nSNR);
+    for (int i = 0; i < nSNR; i++) {
+        double thetaMin = m_Parameters.snrThreshold / ((i + 1) * m_Parameters.snrStep);
+        if (thetaMin > 1.0) m_DetectionProbabilityFromSNR[i] = 0.0;
+        else {
+            double idx = static_cast<double>(std::upper_bound(thetas.begin(), thetas.end(), thetaMin) - thetas.begin());
+            m_DetectionProbabilityFromSNR[i] = 1.0 - (idx - 1.0) / CI_N_THETAS;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * First pass over BSE_Double_Compact_Objects: apply the DCO type and Hubble time masks, and
+ * record the seeds of the selected DCOs
+ *
+ * bool ReadDCOSeeds()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool CosmicIntegrator::ReadDCOSeeds() {
+
+    hsize_t nDCOs = DatasetSize(BSE_DCO_GROUP, "SEED");
+    if (nDCOs == 0) {
+        std::cerr << "ERROR: No double compact objects found in " << m_Parameters.inputFilename << std::endl;
+        return false;
+    }
+
+    m_DCOSelected.assign(nDCOs, 0);
+    m_DCOSeeds.clear();
+
+    std::vector<double>             type1, type2, mergesHubbleTime;
+    std::vector<unsigned long long> seeds;
+
+    for (hsize_t start = 0; start < nDCOs; start += m_Parameters.chunkSize) {
+        hsize_t count = std::min(static_cast<hsize_t>(m_Parameters.chunkSize), nDCOs - start);
+
+        if (!ReadChunk(BSE_DCO_GROUP, "Stellar_Type(1)", start, count, type1) ||
+            !ReadChunk(BSE_DCO_GROUP, "Stellar_Type(2)", start, count, type2) ||
+            !ReadChunk(BSE_DCO_GROUP, "Merges_Hubble_Time", start, count, mergesHubbleTime) ||
+            !ReadChunk(BSE_DCO_GROUP, "SEED", start, count, seeds)) return false;
+
+        for (hsize_t i = 0; i < count; i++) {
+            bool isBH1 = type1[i] == 14.0, isBH2 = type2[i] == 14.0;                                            // 14 = BH
+            bool isNS1 = type1[i] == 13.0, isNS2 = type2[i] == 13.0;                                            // 13 = NS
+
+            bool selected;
+            switch (m_Parameters.dcoType) {
+                case CI_DCO_TYPE::BBH : selected = isBH1 && isBH2; break;
+                case CI_DCO_TYPE::BHNS: selected = (isBH1 && isNS2) || (isNS1 && isBH2); break;
+                case CI_DCO_TYPE::BNS : selected = isNS1 && isNS2; break;
+                default               : selected = true;
+            }
+            if (m_Parameters.mergesHubbleTime && mergesHubbleTime[i] == 0.0) selected = false;
+
+            if (selected) {
+                m_DCOSelected[start + i] = 1;
+                m_DCOSeeds.push_back(std::make_pair(seeds[i], m_DCOSeeds.size()));
+            }
+        }
+    }
+
+    std::sort(m_DCOSeeds.begin(), m_DCOSeeds.end());
+
+    return true;
+}
+
+
+/*
+ * Pass over BSE_Common_Envelopes: deselect DCOs that had immediate RLOF after a CE, or went
+ * through an optimistic CE (as requested)
+ *
+ * bool ReadCommonEnvelopeExclusions()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool CosmicIntegrator::ReadCommonEnvelopeExclusions() {
+
+    if (!m_Parameters.noRLOFAfterCEE && !m_Parameters.pessimisticCEE) return true;
+
+    hsize_t nCEs = DatasetSize(BSE_CE_GROUP, "SEED");
+
+    std::vector<unsigned long long> excludedSeeds;
+    std::vector<double>             rlof, optimistic;
+    std::vector<unsigned long long> seeds;
+
+    auto isDCOSeed = [&](const unsigned long long seed) {
+        auto it = std::lower_bound(m_DCOSeeds.begin(), m_DCOSeeds.end(), std::make_pair(seed, static_cast<size_t>(0)));
+        return it != m_DCOSeeds.end() && it->first == seed;
+    };
+
+    for (hsize_t start = 0; start < nCEs; start += m_Parameters.chunkSize) {
+        hsize_t count = std::min(static_cast<hsize_t>(m_Parameters.chunkSize), nCEs - start);
+
+        if (!ReadChunk(BSE_CE_GROUP, "SEED", start, count, seeds)) return false;
+        if (m_Parameters.noRLOFAfterCEE && !ReadChunk(BSE_CE_GROUP, "Immediate_RLOF>CE", start, count, rlof)) return false;
+        if (m_Parameters.pessimisticCEE && !ReadChunk(BSE_CE_GROUP, "Optimistic_CE", start, count, optimistic)) return false;
+
+        for (hsize_t i = 0; i < count; i++) {
+            bool exclude = (m_Parameters.noRLOFAfterCEE && rlof[i] != 0.0) || (m_Parameters.pessimisticCEE && optimistic[i] != 0.0);
+            if (exclude && isDCOSeed(seeds[i])) excludedSeeds.push_back(seeds[i]);
+        }
+    }
+
+    if (excludedSeeds.empty()) return true;
+
+    std::sort(excludedSeeds.begin(), excludedSeeds.end());
+
+    // deselect excluded DCOs - ordinals are reassigned so they remain contiguous in DCO file order
+    std::vector<char> excludedOrdinals(m_DCOSeeds.size(), 0);
+    for (auto& seed: m_DCOSeeds) {
+        if (std::binary_search(excludedSeeds.begin(), excludedSeeds.end(), seed.first)) excludedOrdinals[seed.second] = 1;
+    }
+
+    std::vector<size_t> newOrdinal(m_DCOSeeds.size());
+    size_t ordinal = 0, selected = 0;
+    for (size_t row = 0; row < m_DCOSelected.size(); row++) {
+        if (!m_DCOSelected[row]) continue;
+        if (excludedOrdinals[selected]) m_DCOSelected[row] = 0;
+        else newOrdinal[selected] = ordinal++;
+        selected++;
+    }
+
+    std::vector<std::pair<unsigned long long, size_t>> seedsKept;
+    seedsKept.reserve(ordinal);
+    for (auto& seed: m_DCOSeeds) {
+        if (!excludedOrdinals[seed.second]) seedsKept.push_back(std::make_pair(seed.first, newOrdinal[seed.second]));
+    }
+    m_DCOSeeds.swap(seedsKept);
+
+    return true;
+}
+
+
+/*
+ * Pass over BSE_System_Parameters: count the systems, find the sampled metallicity and mass
+ * ranges, and look up the metallicity of each selected DCO (matched by seed)
+ *
+ * bool ReadSystemParameters()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool CosmicIntegrator::ReadSystemParameters() {
+
+    hsize_t nSystems = DatasetSize(BSE_SYSPARMS_GROUP, "SEED");
+    if (nSystems == 0) {
+        std::cerr << "ERROR: No systems found in " << m_Parameters.inputFilename << std::endl;
+        return false;
+    }
+
+    m_NSystems     = nSystems;
+    m_MinZ         = std::numeric_limits<double>::max();
+    m_MaxZ         = std::numeric_limits<double>::lowest();
+    m_SampledM1Min = std::numeric_limits<double>::max();
+    m_SampledM1Max = std::numeric_limits<double>::lowest();
+    m_SampledM2Min = std::numeric_limits<double>::max();
+
+    m_DCOMetallicities.assign(m_DCOSeeds.size(), std::nan(""));
+
+    std::vector<double>             Z, mass1, mass2;
+    std::vector<unsigned long long> seeds;
+
+    for (hsize_t start = 0; start < nSystems; start += m_Parameters.chunkSize) {
+        hsize_t count = std::min(static_cast<hsize_t>(m_Parameters.chunkSize), nSystems - start);
+
+        if (!ReadChunk(BSE_SYSPARMS_GROUP, "SEED", start, count, seeds) ||
+            !ReadChunk(BSE_SYSPARMS_GROUP, "Metallicity@ZAMS(1)", start, count, Z) ||
+            !ReadChunk(BSE_SYSPARMS_GROUP, "Mass@ZAMS(1)", start, count, mass1) ||
+            !ReadChunk(BSE_SYSPARMS_GROUP, "Mass@ZAMS(2)", start, count, mass2)) return false;
+
+        for (hsize_t i = 0; i < count; i++) {
+            m_MinZ = std::min(m_MinZ, Z[i]);
+            m_MaxZ = std::max(m_MaxZ, Z[i]);
+
+            if (mass1[i] != mass2[i]) m_SampledM1Min = std::min(m_SampledM1Min, mass1[i]);                     // masses set equal through RLOF at ZAMS are not sampled masses
+            m_SampledM1Max = std::max(m_SampledM1Max, mass1[i]);
+            m_SampledM2Min = std::min(m_SampledM2Min, mass2[i]);
+
+            auto range = std::equal_range(m_DCOSeeds.begin(), m_DCOSeeds.end(), std::make_pair(seeds[i], static_cast<size_t>(0)),
+                                          [](const std::pair<unsigned long long, size_t>& a, const std::pair<unsigned long long, size_t>& b) { return a.first < b.first; });
+            for (auto it = range.first; it != range.second; ++it) m_DCOMetallicities[it->second] = Z[i];
+        }
+    }
+
+    for (auto& seed: m_DCOSeeds) {
+        if (std::isnan(m_DCOMetallicities[seed.second])) {
+            std::cerr << "ERROR: No system parameters found for DCO with SEED " << seed.first << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * Rate kernel: accumulate the merger and detection rates of a range of DCOs, summed over the DCOs
+ *
+ * For each DCO the merger rate at redshift z_j is the formation rate at the redshift at which a
+ * binary that merges at z_j formed (age(z_j) - delay time), so the formation redshift increases
+ * monotonically with j - it is found with a merge-walk along the age grid rather than a search.
+ *
+ * The loops are blocked over (redshift tile x DCO): the per-redshift totals for a tile stay in
+ * cache while all DCOs in the range are accumulated into it, and each DCO's walk position is
+ * carried from one tile to the next.
+ *
+ * void Kernel(const std::vector<CIBinaryT>& p_Binaries, const size_t p_Start, const size_t p_End,
+ *             std::vector<double>& p_MergerRate, std::vector<double>& p_DetectionRate, std::vector<double>& p_BinWeights)
+ *
+ * @param   [IN]    p_Binaries                  DCOs
+ * @param   [IN]    p_Start                     Index of first DCO to accumulate
+ * @param   [IN]    p_End                       Index of last DCO to accumulate + 1
+ * @param   [INOUT] p_MergerRate                Merger rate per redshift (yr^-1 Gpc^-3)
+ * @param   [INOUT] p_DetectionRate             Detection rate per redshift (yr^-1)
+ * @param   [INOUT] p_BinWeights                Sum of DCO weights per metallicity bin (for the formation rate)
+ */
+void CosmicIntegrator::Kernel(const std::vector<CIBinaryT>& p_Binaries, const size_t p_Start, const size_t p_End,
+                              std::vector<double>& p_MergerRate, std::vector<double>& p_DetectionRate, std::vector<double>& p_BinWeights) const {
+
+    size_t n = p_End - p_Start;
+    if (n == 0) return;
+
+    const double dz      = m_Parameters.redshiftStep;
+    const int    nSNR    = static_cast<int>(m_DetectionProbabilityFromSNR.size());
+
+    // per DCO: number of merger redshifts for which the binary formed after the first star formation,
+    // eta grid row, and walk position
+    std::vector<int>    jMax(n);
+    std::vector<int>    etaRow(n);
+    std::vector<int>    walk(n, 0);
+
+    for (size_t b = 0; b < n; b++) {
+        const CIBinaryT& binary = p_Binaries[p_Start + b];
+
+        p_BinWeights[binary.metallicityIndex] += binary.weight;
+
+        // number of redshifts at which the formation time is after the first star formation (ages decrease with redshift);
+        // as in the Python implementation the last of these is dropped unless all redshifts qualify
+        int firstTooEarly = static_cast<int>(std::lower_bound(m_Times.begin(), m_Times.end(), m_TimeFirstSF + binary.delayTime, std::greater<double>()) - m_Times.begin());
+        jMax[b] = firstTooEarly == m_NRedshifts ? m_NRedshifts : std::max(0, firstTooEarly - 1);
+
+        int eta   = static_cast<int>(std::nearbyint(binary.eta / m_Parameters.etaStep)) - 1;
+        etaRow[b] = std::min(std::max(eta, 0), m_NEta - 1);
+    }
+
+    for (int j0 = 0; j0 < m_NRedshifts; j0 += CI_REDSHIFT_TILE) {
+        int j1 = std::min(m_NRedshifts, j0 + CI_REDSHIFT_TILE);
+
+        for (size_t b = 0; b < n; b++) {
+            const CIBinaryT& binary = p_Binaries[p_Start + b];
+            int jEnd = std::min(j1, jMax[b]);
+            if (jEnd <= j0) continue;
+
+            const std::vector<double>& formationRate = m_FormationRate[binary.metallicityIndex];
+            const double* snrRow = m_SNRAt1Mpc.data() + static_cast<size_t>(etaRow[b]) * m_NMc;
+            int k = walk[b];
+
+            for (int j = j0; j < jEnd; j++) {
+                double tForm = m_Times[j] - binary.delayTime;
+
+                while (k < m_NRedshifts - 2 && m_Times[k + 1] > tForm) k++;                                    // m_Times[k] >= tForm > m_Times[k + 1]
+                double zForm = m_Redshifts[k] + (tForm - m_Times[k]) * (m_Redshifts[k + 1] - m_Redshifts[k]) / (m_Times[k + 1] - m_Times[k]);
+                int    zIdx  = std::min(static_cast<int>(std::ceil(zForm / dz)), m_NRedshifts - 1);
+
+                double mergerRate = formationRate[zIdx] * binary.weight;
+                p_MergerRate[j] += mergerRate;
+
+                if (j < m_NRedshiftsDetection) {
+                    int    McIdx = std::max(0, static_cast<int>(std::nearbyint(binary.chirpMass * (1.0 + m_Redshifts[j]) / m_Parameters.McStep)) - 1);
+                    double snr   = (McIdx < m_NMc ? snrRow[McIdx] : 0.00001) / m_Distances[j];
+                    int    pIdx  = static_cast<int>(std::nearbyint(snr / m_Parameters.snrStep)) - 1;
+                    double pDet  = pIdx < 0 ? 0.0 : (pIdx < nSNR ? m_DetectionProbabilityFromSNR[pIdx] : 1.0);
+
+                    p_DetectionRate[j] += mergerRate * pDet * m_ShellVolumes[j] / (1.0 + m_Redshifts[j]);
+                }
+            }
+            walk[b] = k;
+        }
+    }
+}
+
+
+/*
+ * Second pass over BSE_Double_Compact_Objects: read the selected DCOs chunk by chunk and
+ * accumulate their rates, splitting each chunk across threads
+ *
+ * bool IntegrateDCOs()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool CosmicIntegrator::IntegrateDCOs() {
+
+    int nThreads = std::max(1, m_Parameters.threads);
+    size_t nBins = m_FormationRate.size();
+
+    std::vector<std::vector<double>> mergerRate(nThreads, std::vector<double>(m_NRedshifts, 0.0));
+    std::vector<std::vector<double>> detectionRate(nThreads, std::vector<double>(m_NRedshifts, 0.0));
+    std::vector<std::vector<double>> binWeights(nThreads, std::vector<double>(nBins, 0.0));
+
+    hsize_t nDCOs = m_DCOSelected.size();
+
+    std::vector<double>    mass1, mass2, formationTime, coalescenceTime, weights;
+    std::vector<CIBinaryT> binaries;
+    size_t                 ordinal = 0;
+    double                 maxChirpMass = 0.0;
+
+    for (hsize_t start = 0; start < nDCOs; start += m_Parameters.chunkSize) {
+        hsize_t count = std::min(static_cast<hsize_t>(m_Parameters.chunkSize), nDCOs - start);
+
+        if (std::none_of(m_DCOSelected.begin() + start, m_DCOSelected.begin() + start + count, [](const char s) { return s != 0; })) continue;
+
+        if (!ReadChunk(BSE_DCO_GROUP, "Mass(1)", start, count, mass1) ||
+            !ReadChunk(BSE_DCO_GROUP, "Mass(2)", start, count, mass2) ||
+            !ReadChunk(BSE_DCO_GROUP, "Time", start, count, formationTime) ||
+            !ReadChunk(BSE_DCO_GROUP, "Coalescence_Time", start, count, coalescenceTime)) return false;
+        if (!m_Parameters.weightColumn.empty() && !ReadChunk(BSE_DCO_GROUP, m_Parameters.weightColumn, start, count, weights)) return false;
+
+        binaries.clear();
+        for (hsize_t i = 0; i < count; i++) {
+            if (!m_DCOSelected[start + i]) continue;
+
+            double totalMass = mass1[i] + mass2[i];
+
+            CIBinaryT binary;
+            binary.metallicityIndex = m_DCOBins[ordinal++];
+            binary.delayTime        = formationTime[i] + coalescenceTime[i];
+            binary.chirpMass        = std::pow(mass1[i] * mass2[i], 0.6) / std::pow(totalMass, 0.2);
+            binary.eta              = mass1[i] * mass2[i] / (totalMass * totalMass);
+            binary.weight           = m_Parameters.weightColumn.empty() ? 1.0 : weights[i];
+            binaries.push_back(binary);
+
+            maxChirpMass = std::max(maxChirpMass, binary.chirpMass);
+        }
+
+        // split the chunk across threads - each thread accumulates into its own totals
+        size_t perThread = (binaries.size() + nThreads - 1) / nThreads;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < nThreads; t++) {
+            size_t lo = std::min(binaries.size(), t * perThread);
+            size_t hi = std::min(binaries.size(), lo + perThread);
+            if (lo >= hi) break;
+            threads.push_back(std::thread(&CosmicIntegrator::Kernel, this, std::cref(binaries), lo, hi,
+                                          std::ref(mergerRate[t]), std::ref(detectionRate[t]), std::ref(binWeights[t])));
+        }
+        for (auto& thread: threads) thread.join();
+
+        m_NBinaries += binaries.size();
+    }
+
+    if (maxChirpMass * (1.0 + m_Parameters.maxRedshiftDetection) > m_Parameters.McMax) {
+        std::cerr << "WARNING: Maximum chirp mass used for detectability calculation is below maximum binary chirp mass * (1+maximum redshift for detectability calculation)" << std::endl;
+    }
+
+    // sum the thread totals
+    m_FormationRateTotal.assign(m_NRedshifts, 0.0);
+    m_MergerRateTotal.assign(m_NRedshifts, 0.0);
+    m_DetectionRateTotal.assign(m_NRedshifts, 0.0);
+
+    for (int t = 0; t < nThreads; t++) {
+        for (int j = 0; j < m_NRedshifts; j++) {
+            m_MergerRateTotal[j]    += mergerRate[t][j];
+            m_DetectionRateTotal[j] += detectionRate[t][j];
+        }
+        for (size_t b = 0; b < nBins; b++) {
+            for (int j = 0; j < m_NRedshifts; j++) m_FormationRateTotal[j] += binWeights[t][b] * m_FormationRate[b][j];
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * Write the rates (summed over the selected DCOs) per redshift
+ *
+ * bool WriteRates()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool CosmicIntegrator::WriteRates() const {
+
+    std::ofstream file(m_Parameters.outputFilename);
+    if (!file.is_open()) {
+        std::cerr << "ERROR: Unable to open output file " << m_Parameters.outputFilename << std::endl;
+        return false;
+    }
+
+    double totalDetectionRate = 0.0;
+    for (int j = 0; j < m_NRedshiftsDetection; j++) totalDetectionRate += m_DetectionRateTotal[j];
+
+    file << std::setprecision(10);
+    file << "# COMPAS cosmic integration rates for " << m_Parameters.inputFilename << "\n";
+    file << "# DCOs: " << m_NBinaries << " of " << m_DCOSelected.size() << ", systems: " << m_NSystems << "\n";
+    file << "# Rates are summed over DCOs; detection rates are calculated to redshift " << m_Parameters.maxRedshiftDetection << " only\n";
+    file << "# Total detection rate (yr^-1): " << totalDetectionRate << "\n";
+    file << "Redshift,Formation_Rate,Merger_Rate,Detection_Rate\n";
+    file << "-,Gpc^-3 yr^-1,Gpc^-3 yr^-1,yr^-1\n";
+
+    for (int j = 0; j < m_NRedshifts; j++) {
+        file << m_Redshifts[j] << "," << m_FormationRateTotal[j] << "," << m_MergerRateTotal[j] << "," << (j < m_NRedshiftsDetection ? m_DetectionRateTotal[j] : 0.0) << "\n";
+    }
+
+    file.close();
+
+    std::cout << "DCOs integrated: " << m_NBinaries << std::endl;
+    std::cout << "Merger rate at redshift 0 (Gpc^-3 yr^-1): " << m_MergerRateTotal[0] << std::endl;
+    std::cout << "Total detection rate (yr^-1): " << totalDetectionRate << std::endl;
+
+    return !file.fail();
+}
+
+
+/*
+ * Run the cosmic integration
+ *
+ * bool Run()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool CosmicIntegrator::Run() {
+
+    m_FileId = H5Fopen(m_Parameters.inputFilename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (m_FileId < 0) {
+        std::cerr << "ERROR: Unable to open COMPAS output file " << m_Parameters.inputFilename << std::endl;
+        return false;
+    }
+
+    bool ok = ReadDCOSeeds() && ReadCommonEnvelopeExclusions() && ReadSystemParameters();
+    if (ok) {
+        CalculateRedshiftRelatedParams();
+        CalculateMetallicityDistribution();
+        ok = CalculateSNRAndDetectionGrids() && IntegrateDCOs() && WriteRates();
+    }
+
+    H5Fclose(m_FileId);
+    m_FileId = -1;
+
+    return ok;
+}
+
+
+int main(int argc, char *argv[]) {
+
+    CosmicIntegrationParametersT p;
+    std::string dcoType;
+
+    const char* compasRoot = std::getenv("COMPAS_ROOT_DIR");
+    std::string defaultSNRGrid = std::string(compasRoot ? compasRoot : ".") + "/compas_python_utils/cosmic_integration/SNR_Grid_IMRPhenomPv2_FD_all_noise.h5";
+
+    po::options_description options("COMPAS cosmic integration options");
+    options.add_options()
+        ("help,h",      "Print this help message")
+        ("path",        po::value<std::string>(&p.inputFilename)->default_value("COMPAS_Output.h5"),                "Path to the COMPAS file that contains the output")
+        ("output",      po::value<std::string>(&p.outputFilename)->default_value("Cosmic_Integration_Rates.csv"),   "Output file for rates per redshift")
+        ("snr-grid",    po::value<std::string>(&p.snrGridFilename)->default_value(defaultSNRGrid),                 "SNR grid file")
+        ("dco_type",    po::value<std::string>(&dcoType)->default_value("BBH"),                                    "Which DCO type to calculate rates for, one of: ['all', 'BBH', 'BHNS', 'BNS']")
+        ("weight",      po::value<std::string>(&p.weightColumn)->default_value(""),                                "Name of column with sampling weights (leave empty for unweighted samples)")
+        ("maxz",        po::value<double>(&p.maxRedshift)->default_value(10.0),                                    "Maximum redshift to use in array")
+        ("zSF",         po::value<double>(&p.zFirstSF)->default_value(10.0),                                       "Redshift of first star formation")
+        ("maxzdet",     po::value<double>(&p.maxRedshiftDetection)->default_value(1.0),                            "Maximum redshift to calculate detection rates")
+        ("zstep",       po::value<double>(&p.redshiftStep)->default_value(0.001),                                  "Size of step to take in redshift")
+        ("sens",        po::value<std::string>(&p.sensitivity)->default_value("O3"),                               "Which detector sensitivity to use: one of ['design', 'O1', 'O3']")
+        ("snr",         po::value<double>(&p.snrThreshold)->default_value(8.0),                                    "SNR threshold required for a detection")
+        ("m1min",       po::value<double>(&p.m1Min)->default_value(5.0),                                           "Minimum primary mass sampled by COMPAS (used with --no-sampled-mass-ranges)")
+        ("m1max",       po::value<double>(&p.m1Max)->default_value(150.0),                                         "Maximum primary mass sampled by COMPAS (used with --no-sampled-mass-ranges)")
+        ("m2min",       po::value<double>(&p.m2Min)->default_value(0.1),                                           "Minimum secondary mass sampled by COMPAS (used with --no-sampled-mass-ranges)")
+        ("fbin",        po::value<double>(&p.fBin)->default_value(0.7),                                            "Binary fraction used by COMPAS")
+        ("mu0",         po::value<double>(&p.mu0)->default_value(0.035),                                           "Mean metallicity at redshift 0")
+        ("muz",         po::value<double>(&p.muz)->default_value(-0.23),                                           "Redshift evolution of mean metallicity, dPdlogZ")
+        ("sigma0",      po::value<double>(&p.sigma0)->default_value(0.39),                                         "Variance in metallicity density distribution, dPdlogZ")
+        ("sigmaz",      po::value<double>(&p.sigmaz)->default_value(0.0),                                          "Redshift evolution of variance, dPdlogZ")
+        ("alpha",       po::value<double>(&p.alpha)->default_value(0.0),                                           "Skewness of metallicity density distribution, dPdlogZ")
+        ("aSF",         po::value<double>(&p.aSF)->default_value(0.01),                                            "Parameter for shape of SFR(z)")
+        ("bSF",         po::value<double>(&p.bSF)->default_value(2.77),                                            "Parameter for shape of SFR(z)")
+        ("cSF",         po::value<double>(&p.cSF)->default_value(2.90),                                            "Parameter for shape of SFR(z)")
+        ("dSF",         po::value<double>(&p.dSF)->default_value(4.70),                                            "Parameter for shape of SFR(z)")
+        ("no-sampled-mass-ranges",                                                                                  "Use --m1min, --m1max and --m2min in lieu of the sampled mass ranges")
+        ("include-hubble-time-non-mergers",                                                                         "Do not mask DCOs that do not merge in a Hubble time")
+        ("optimistic-CEE",                                                                                          "Do not mask DCOs that went through an optimistic CE")
+        ("allow-RLOF-after-CEE",                                                                                    "Do not mask DCOs that had immediate RLOF after a CE")
+        ("chunk-size",  po::value<size_t>(&p.chunkSize)->default_value(100000),                                    "Number of dataset entries read per chunk")
+        ("threads",     po::value<int>(&p.threads)->default_value(std::max(1U, std::thread::hardware_concurrency())), "Number of threads")
+    ;
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, options), vm);
+        po::notify(vm);
+    }
+    catch (po::error& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (vm.count("help")) {
+        std::cout << options << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    p.useSampledMassRanges = vm.count("no-sampled-mass-ranges") == 0;
+    p.mergesHubbleTime     = vm.count("include-hubble-time-non-mergers") == 0;
+    p.pessimisticCEE       = vm.count("optimistic-CEE") == 0;
+    p.noRLOFAfterCEE       = vm.count("allow-RLOF-after-CEE") == 0;
+
+    p.minLogZ = -12.0; p.maxLogZ = 0.0; p.stepLogZ = 0.01;
+    p.McMax   = 300.0; p.McStep  = 0.1;
+    p.etaMax  = 0.25;  p.etaStep = 0.01;
+    p.snrMax  = 1000.0; p.snrStep = 0.1;
+
+    if      (dcoType == "all")  p.dcoType = CI_DCO_TYPE::ALL;
+    else if (dcoType == "BBH")  p.dcoType = CI_DCO_TYPE::BBH;
+    else if (dcoType == "BHNS") p.dcoType = CI_DCO_TYPE::BHNS;
+    else if (dcoType == "BNS")  p.dcoType = CI_DCO_TYPE::BNS;
+    else {
+        std::cerr << "ERROR: Unknown DCO type: " << dcoType << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string error;
+    if      (p.maxRedshiftDetection > p.maxRedshift)             error = "Maximum detection redshift cannot be above maximum redshift";
+    else if (p.redshiftStep <= 0.0)                               error = "Redshift step must be positive";
+    else if (p.m1Min > p.m1Max)                                   error = "Minimum sampled primary mass cannot be above maximum sampled primary mass";
+    else if (p.fBin <= 0.0 || p.fBin > 1.0)                       error = "Binary fraction must be in (0, 1]";
+    else if (p.mu0 < 0.0 || p.sigma0 < 0.0 || p.snrThreshold < 0.0) error = "mu0, sigma0 and snr must be nonnegative";
+    else if (p.chunkSize == 0)                                    error = "Chunk size must be positive";
+    if (!error.empty()) {
+        std::cerr << "ERROR: " << error << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    CosmicIntegrator integrator(p);
+
+    return integrator.Run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
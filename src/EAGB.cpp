@@ -66,10 +66,10 @@ void EAGB::CalculateTimescales(const double p_Mass, DBL_VECTOR &p_Timescales) {
  */
 double EAGB::CalculateLambdaNanjingEnhanced(const int p_MassInd, const int p_Zind) const {
 
-	DBL_VECTOR maxBG    = {};                                                       // [0] = maxB, [1] = maxG
-	DBL_VECTOR lambdaBG = {};                                                       // [0] = lambdaB, [1] = lambdaG
-	DBL_VECTOR a        = {};                                                       // 0..5 a_coefficients
-	DBL_VECTOR b        = {};                                                       // 0..5 b_coefficients
+	NANJING_BG maxBG    = {};                                                       // [0] = maxB, [1] = maxG
+	NANJING_BG lambdaBG = NANJING_BG_NONE;                                          // [0] = lambdaB, [1] = lambdaG (NaN = not yet calculated)
+	NANJING_COEFFS a    = {};                                                       // 0..5 a_coefficients
+	NANJING_COEFFS b    = {};                                                       // 0..5 b_coefficients
     double     Rmax     = std::numeric_limits<double>::max();                       // Upper R limit to applicability of Nanjing polynomials.
 
     switch(p_Zind) {
@@ -316,29 +316,15 @@ double EAGB::CalculateLambdaNanjingEnhanced(const int p_MassInd, const int p_Zin
             break;
         }
 
-    if (lambdaBG.empty()) {
+    if (std::isnan(lambdaBG[0])) {
         if ( (p_Zind == 1) && (p_MassInd == 0) ) {                        // Pop. I metallicity and M = 1 Msun
-            double x  = (m_Mass - m_CoreMass) / m_Mass;
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, (m_Mass - m_CoreMass) / m_Mass, y1, y2);
             lambdaBG = { 1.0 / y1, 1.0 / y2 };
         }
         else {
-            double x  = std::min(m_Radius, Rmax);                           // Evaluate lambda with maximum allowed radius to prevent exceeding domain of the polynomial fits
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, std::min(m_Radius, Rmax), y1, y2);  // Evaluate lambda with maximum allowed radius to prevent exceeding domain of the polynomial fits
             lambdaBG = { y1, y2 };
         }
     }
@@ -377,10 +363,10 @@ double EAGB::CalculateLambdaNanjingEnhanced(const int p_MassInd, const int p_Zin
  */
 double EAGB::CalculateLambdaNanjingStarTrack(const double p_Mass, const double p_Metallicity) const {
 
-	DBL_VECTOR maxBG    = {};                                                       // [0] = maxB, [1] = maxG
-	DBL_VECTOR lambdaBG = {};                                                       // [0] = lambdaB, [1] = lambdaG
-	DBL_VECTOR a        = {};                                                       // 0..5 a_coefficients
-	DBL_VECTOR b        = {};                                                       // 0..5 b_coefficients
+	NANJING_BG maxBG    = {};                                                       // [0] = maxB, [1] = maxG
+	NANJING_BG lambdaBG = NANJING_BG_NONE;                                          // [0] = lambdaB, [1] = lambdaG (NaN = not yet calculated)
+	NANJING_COEFFS a    = {};                                                       // 0..5 a_coefficients
+	NANJING_COEFFS b    = {};                                                       // 0..5 b_coefficients
 
     if (utils::Compare(p_Metallicity, LAMBDA_NANJING_ZLIMIT) > 0) {                 // Z>0.5 Zsun: popI
         if (utils::Compare(p_Mass, 1.5) < 0) {                                     // Should probably use effective mass m_Mass0 instead for Lambda calculations
@@ -647,43 +633,22 @@ double EAGB::CalculateLambdaNanjingStarTrack(const double p_Mass, const double p
         }
     }
 
-    if (lambdaBG.empty()) {                                                 // calculate lambda B & G - not approximated by hand
+    if (std::isnan(lambdaBG[0])) {                                          // calculate lambda B & G - not approximated by hand
         if (utils::Compare(p_Metallicity, LAMBDA_NANJING_ZLIMIT) > 0 &&
             (utils::Compare(p_Mass, 1.5) < 0 || (utils::Compare(p_Mass, 25.0) < 0 && utils::Compare(p_Mass, 18.0) >= 0)) ) {
-            double x  = (m_Mass - m_CoreMass) / m_Mass;
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, (m_Mass - m_CoreMass) / m_Mass, y1, y2);
             lambdaBG = { 1.0 / y1, 1.0 / y2 };
         }
         else if ( (utils::Compare(p_Metallicity, LAMBDA_NANJING_ZLIMIT) > 0  && utils::Compare(p_Mass, 2.5) >= 0 && utils::Compare(p_Mass, 5.5) < 0) ||
                   (utils::Compare(p_Metallicity, LAMBDA_NANJING_ZLIMIT) <= 0 && utils::Compare(p_Mass, 2.5) >= 0 && utils::Compare(p_Mass, 4.5) < 0)) {
-            double x  = m_Radius;
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, m_Radius, y1, y2);
             lambdaBG = { pow(10.0, y1), y2 };
         }
         else {
-            double x  = m_Radius;
-            double x2 = x * x;
-            double x3 = x2 * x;
-            double x4 = x2 * x2;
-            double x5 = x3 * x2;
-
-            double y1 = a[0] + (a[1] * x) + (a[2] * x2) + (a[3] * x3) + (a[4] * x4) + (a[5] * x5);
-            double y2 = b[0] + (b[1] * x) + (b[2] * x2) + (b[3] * x3) + (b[4] * x4) + (b[5] * x5);
-
+            double y1, y2;
+            EvaluateLambdaNanjingPolynomials(a, b, m_Radius, y1, y2);
             lambdaBG = { y1, y2 };
         }
     }
@@ -1022,6 +987,7 @@ STELLAR_TYPE EAGB::ResolveEnvelopeLoss(bool p_NoCheck) {
 
         m_Age      = HeGB::CalculateAgeOnPhase_Static(m_Mass, m_COCoreMass, timescales(tHeMS), m_GBParams);
         HeHG::CalculateGBParams_Static(m_Mass0, m_Mass, LogMetallicityXi(), m_MassCutoffs, m_AnCoefficients, m_BnCoefficients, m_GBParams);  // IM: order of type change and parameter updates to be revisited (e.g., why not just CalculateGBParams(m_Mass0, m_GBParams)?)  JR: static function has no access to class variables
+        InvalidateGBParamsAndTimescales();                                  // m_Timescales and m_GBParams written directly above - force recalculation
         m_Luminosity = HeGB::CalculateLuminosityOnPhase_Static(m_COCoreMass, gbParams(B), gbParams(D));
 
         double R1, R2;
@@ -0,0 +1,905 @@
+// Native merging of COMPAS HDF5 output files
+//
+// Built as a separate executable (see the Makefile target 'h5merge') - see H5Merge.h for
+// a description of the method and the differences from compas_python_utils/h5copy.py
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fnmatch.h>
+#include <fcntl.h>
+#include <iostream>
+#include <thread>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include "H5Merge.h"
+
+namespace fs = boost::filesystem;
+namespace po = boost::program_options;
+
+
+constexpr size_t H5MERGE_DEFAULT_CHUNK_SIZE     = 100000;                                                       // chunk size for output datasets if the input dataset is not chunked (as h5copy.py)
+constexpr size_t H5MERGE_DEFAULT_BUFFER_SIZE    = 10;                                                           // IO buffer size (number of chunks) (as h5copy.py)
+constexpr size_t H5MERGE_MAX_FILTER_VALUES      = 16;                                                           // maximum number of client data values per filter
+
+// raw chunk addresses are only available from HDF5 1.10.5
+#if H5_VERSION_GE(1, 10, 5)
+#define H5MERGE_RAW_CHUNKS true
+#else
+#define H5MERGE_RAW_CHUNKS false
+#endif
+
+
+H5Merger::H5Merger(const H5MergeParametersT& p_Parameters) {
+    m_Parameters    = p_Parameters;
+    m_OutputFileId  = -1;
+    m_RawChunkBytes = 0;
+    m_FilesCopied   = 0;
+    m_ChunksCopied  = 0;
+    m_EntriesCopied = 0;
+}
+
+
+/*
+ * Return the names of the members of a group of the specified type (groups or datasets), in name order
+ *
+ * std::vector<std::string> Members(const hid_t p_Group, const H5I_type_t p_Type)
+ *
+ * @param   [IN]    p_Group                     HDF5 group id
+ * @param   [IN]    p_Type                      H5I_GROUP or H5I_DATASET
+ * @return                                      Member names
+ */
+std::vector<std::string> H5Merger::Members(const hid_t p_Group, const H5I_type_t p_Type) {
+
+    std::vector<std::string> members;
+
+    H5G_info_t info;
+    if (H5Gget_info(p_Group, &info) < 0) return members;
+
+    for (hsize_t idx = 0; idx < info.nlinks; idx++) {
+        ssize_t length = H5Lget_name_by_idx(p_Group, ".", H5_INDEX_NAME, H5_ITER_INC, idx, NULL, 0, H5P_DEFAULT);
+        if (length < 0) continue;
+
+        std::vector<char> name(length + 1);
+        (void)H5Lget_name_by_idx(p_Group, ".", H5_INDEX_NAME, H5_ITER_INC, idx, name.data(), name.size(), H5P_DEFAULT);
+
+        hid_t object = H5Oopen(p_Group, name.data(), H5P_DEFAULT);                                              // skips dangling links
+        if (object < 0) continue;
+        if (H5Iget_type(object) == p_Type) members.push_back(std::string(name.data()));
+        H5Oclose(object);
+    }
+
+    return members;
+}
+
+
+/*
+ * Describe the filter pipeline of a (chunked) dataset creation property list
+ *
+ * Two datasets can exchange raw chunks only if their filter pipelines are identical - the
+ * filter ids, flags and client data values are flattened into a vector for comparison.
+ *
+ * std::vector<unsigned> FilterPipeline(const hid_t p_Dcpl)
+ *
+ * @param   [IN]    p_Dcpl                      Dataset creation property list
+ * @return                                      Filter pipeline (empty if no filters)
+ */
+std::vector<unsigned> H5Merger::FilterPipeline(const hid_t p_Dcpl) {
+
+    std::vector<unsigned> pipeline;
+
+    int nFilters = H5Pget_nfilters(p_Dcpl);
+    for (int idx = 0; idx < nFilters; idx++) {
+        unsigned int flags;
+        size_t       nValues = H5MERGE_MAX_FILTER_VALUES;
+        unsigned int values[H5MERGE_MAX_FILTER_VALUES];
+        unsigned int config;
+
+        H5Z_filter_t filter = H5Pget_filter2(p_Dcpl, idx, &flags, &nValues, values, 0, NULL, &config);
+
+        pipeline.push_back(static_cast<unsigned>(filter));
+        pipeline.push_back(flags);
+        pipeline.push_back(static_cast<unsigned>(nValues));
+        for (size_t v = 0; v < std::min(nValues, H5MERGE_MAX_FILTER_VALUES); v++) pipeline.push_back(values[v]);
+    }
+
+    return pipeline;
+}
+
+
+/*
+ * Copy an attribute - callback for H5Aiterate2() (see CopyAttributes())
+ *
+ * Existing attributes of the same name are replaced (as h5copy.py does).
+ */
+static herr_t CopyAttribute(hid_t p_From, const char* p_Name, const H5A_info_t* p_Info, void* p_To) {
+
+    hid_t  to = *static_cast<hid_t*>(p_To);
+    herr_t ok = -1;
+
+    hid_t attribute = H5Aopen(p_From, p_Name, H5P_DEFAULT);
+    if (attribute < 0) return ok;
+
+    hid_t    datatype  = H5Aget_type(attribute);
+    hid_t    dataspace = H5Aget_space(attribute);
+    hssize_t nPoints   = H5Sget_simple_extent_npoints(dataspace);
+    bool     vlen      = H5Tis_variable_str(datatype) > 0 || H5Tdetect_class(datatype, H5T_VLEN) > 0;
+
+    std::vector<char> buf(std::max<hssize_t>(nPoints, 1) * H5Tget_size(datatype));
+    if (H5Aread(attribute, datatype, buf.data()) >= 0) {
+        if (H5Aexists(to, p_Name) > 0) (void)H5Adelete(to, p_Name);
+
+        hid_t copy = H5Acreate2(to, p_Name, datatype, dataspace, H5P_DEFAULT, H5P_DEFAULT);
+        if (copy >= 0) {
+            ok = H5Awrite(copy, datatype, buf.data());
+            H5Aclose(copy);
+        }
+        if (vlen) (void)H5Dvlen_reclaim(datatype, dataspace, H5P_DEFAULT, buf.data());
+    }
+
+    H5Sclose(dataspace);
+    H5Tclose(datatype);
+    H5Aclose(attribute);
+
+    return ok < 0 ? -1 : 0;
+}
+
+
+/*
+ * Copy the attributes (e.g. units) of one dataset to another
+ *
+ * bool CopyAttributes(const hid_t p_From, const hid_t p_To)
+ *
+ * @param   [IN]    p_From                      Dataset to copy attributes from
+ * @param   [IN]    p_To                        Dataset to copy attributes to
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::CopyAttributes(const hid_t p_From, const hid_t p_To) {
+    hid_t to = p_To;
+    return H5Aiterate2(p_From, H5_INDEX_NAME, H5_ITER_INC, NULL, CopyAttribute, &to) >= 0;
+}
+
+
+/*
+ * Read a raw chunk from an input file
+ *
+ * bool ReadRawChunk(const int p_Fd, const haddr_t p_Address, const size_t p_Bytes, char* p_Buf)
+ *
+ * @param   [IN]    p_Fd                        Input file descriptor
+ * @param   [IN]    p_Address                   File address of the chunk
+ * @param   [IN]    p_Bytes                     Stored size of the chunk
+ * @param   [OUT]   p_Buf                       Chunk read
+ * @return                                      Boolean status (true = ok)
+ */
+static bool ReadRawChunk(const int p_Fd, const haddr_t p_Address, const size_t p_Bytes, char* p_Buf) {
+
+    size_t done = 0;
+    while (done < p_Bytes) {
+        ssize_t n = pread(p_Fd, p_Buf + done, p_Bytes - done, static_cast<off_t>(p_Address + done));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        done += static_cast<size_t>(n);
+    }
+
+    return true;
+}
+
+
+/*
+ * Copy the batched raw chunks to the output file
+ *
+ * The chunks are read from the input files (at the addresses HDF5 reported) by up to --threads
+ * threads concurrently, then written to the output datasets (via HDF5, on this thread) in the
+ * order batched.
+ *
+ * bool FlushRawChunks()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::FlushRawChunks() {
+
+    if (m_RawChunks.empty()) return true;
+
+    size_t nChunks = m_RawChunks.size();
+
+    std::vector<size_t> offsets(nChunks);
+    size_t bytes = 0;
+    for (size_t idx = 0; idx < nChunks; idx++) {
+        offsets[idx] = bytes;
+        bytes       += m_RawChunks[idx].bytes;
+    }
+
+    std::vector<char> buf(bytes);
+    std::vector<char> read(nChunks, 0);
+
+    int nThreads = static_cast<int>(std::min(static_cast<size_t>(std::max(1, m_Parameters.threads)), nChunks));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nThreads; t++) {
+        threads.push_back(std::thread([this, t, nThreads, nChunks, &offsets, &buf, &read]() {
+            for (size_t idx = t; idx < nChunks; idx += nThreads) {
+                read[idx] = ReadRawChunk(m_RawChunks[idx].fd, m_RawChunks[idx].address, m_RawChunks[idx].bytes, buf.data() + offsets[idx]);
+            }
+        }));
+    }
+    for (auto& thread: threads) thread.join();
+
+    bool ok = true;
+    for (size_t idx = 0; ok && idx < nChunks; idx++) {
+        const RawChunkT& chunk = m_RawChunks[idx];
+        hsize_t offset[1] = { chunk.offset };
+        if (!read[idx]) {
+            std::cerr << "ERROR: Unable to read raw chunk at address " << chunk.address << std::endl;
+            ok = false;
+        }
+        else if (H5Dwrite_chunk(chunk.dataset, H5P_DEFAULT, chunk.filterMask, offset, chunk.bytes, buf.data() + offsets[idx]) < 0) {
+            std::cerr << "ERROR: Unable to write raw chunk to file " << m_OutputFilename << std::endl;
+            ok = false;
+        }
+        else m_ChunksCopied++;
+    }
+
+    m_RawChunks.clear();
+    m_RawChunkBytes = 0;
+
+    return ok;
+}
+
+
+/*
+ * Open (or create) the output dataset for an input dataset
+ *
+ * Existing output datasets are appended to - they must be chunked.  New output datasets are
+ * created as Log::CreateHDF5Dataset() creates them (1-d, chunked, unlimited, allocated
+ * incrementally), with the datatype, filters and attributes of the input dataset, and with
+ * the chunk size specified by --chunk-size (or, by default, that of the input dataset).
+ *
+ * bool OpenOutputDataset(const hid_t p_Input, const std::string p_Group, const std::string p_Dataset, OutputT& p_Output)
+ *
+ * @param   [IN]    p_Input                     Input dataset id
+ * @param   [IN]    p_Group                     HDF5 group name
+ * @param   [IN]    p_Dataset                   HDF5 dataset name
+ * @param   [OUT]   p_Output                    Output dataset details
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::OpenOutputDataset(const hid_t p_Input, const std::string p_Group, const std::string p_Dataset, OutputT& p_Output) {
+
+    std::string path = p_Group + "/" + p_Dataset;
+
+    if (H5Lexists(m_OutputFileId, path.c_str(), H5P_DEFAULT) > 0) {                                            // existing dataset - append to it
+        p_Output.dataset = H5Dopen(m_OutputFileId, path.c_str(), H5P_DEFAULT);
+        if (p_Output.dataset < 0) {
+            std::cerr << "ERROR: Unable to open dataset " << path << " in file " << m_OutputFilename << std::endl;
+            return false;
+        }
+
+        hid_t dcpl = H5Dget_create_plist(p_Output.dataset);
+        bool  ok   = H5Pget_layout(dcpl) == H5D_CHUNKED && H5Pget_chunk(dcpl, 1, &p_Output.chunkSize) == 1;
+        if (ok) {
+            hid_t dataspace = H5Dget_space(p_Output.dataset);
+            (void)H5Sget_simple_extent_dims(dataspace, &p_Output.size, NULL);
+            H5Sclose(dataspace);
+
+            p_Output.datatype = H5Dget_type(p_Output.dataset);
+            p_Output.filters  = FilterPipeline(dcpl);
+        }
+        else {
+            std::cerr << "ERROR: Only chunked datasets can be resized: dataset " << path << " in file " << m_OutputFilename << std::endl;
+            H5Dclose(p_Output.dataset);
+        }
+        H5Pclose(dcpl);
+
+        return ok;
+    }
+
+    hid_t   inputDcpl    = H5Dget_create_plist(p_Input);
+    bool    inputChunked = H5Pget_layout(inputDcpl) == H5D_CHUNKED;
+    hsize_t chunkSize    = m_Parameters.chunkSize;
+    if (chunkSize == 0 && (!inputChunked || H5Pget_chunk(inputDcpl, 1, &chunkSize) != 1)) chunkSize = H5MERGE_DEFAULT_CHUNK_SIZE;
+
+    hsize_t dims[1]      = { 0 };
+    hsize_t maxDims[1]   = { H5S_UNLIMITED };
+    hsize_t chunkDims[1] = { chunkSize };
+    hid_t   dataspace    = H5Screate_simple(1, dims, maxDims);
+    hid_t   dcpl         = H5Pcreate(H5P_DATASET_CREATE);
+    (void)H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_INCR);
+    (void)H5Pset_layout(dcpl, H5D_CHUNKED);
+    bool ok = H5Pset_chunk(dcpl, 1, chunkDims) >= 0;
+
+    int nFilters = inputChunked ? H5Pget_nfilters(inputDcpl) : 0;                                                // same filters as the input dataset
+    for (int idx = 0; ok && idx < nFilters; idx++) {
+        unsigned int flags;
+        size_t       nValues = H5MERGE_MAX_FILTER_VALUES;
+        unsigned int values[H5MERGE_MAX_FILTER_VALUES];
+        unsigned int config;
+
+        H5Z_filter_t filter = H5Pget_filter2(inputDcpl, idx, &flags, &nValues, values, 0, NULL, &config);
+        ok = filter >= 0 && H5Pset_filter(dcpl, filter, flags, std::min(nValues, H5MERGE_MAX_FILTER_VALUES), values) >= 0;
+    }
+
+    p_Output.datatype = H5Dget_type(p_Input);
+    p_Output.dataset  = ok ? H5Dcreate(m_OutputFileId, path.c_str(), p_Output.datatype, dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT) : -1;
+    if (p_Output.dataset < 0) {
+        std::cerr << "ERROR: Unable to create dataset " << path << " in file " << m_OutputFilename << std::endl;
+        H5Tclose(p_Output.datatype);
+        ok = false;
+    }
+    else if (!CopyAttributes(p_Input, p_Output.dataset)) {
+        std::cerr << "ERROR: Unable to copy attributes of dataset " << path << " to file " << m_OutputFilename << std::endl;
+        ok = false;
+    }
+
+    if (p_Output.dataset >= 0) {
+        hid_t outputDcpl   = H5Dget_create_plist(p_Output.dataset);                                               // the filters as set for the datatype (e.g. shuffle)
+        p_Output.filters   = FilterPipeline(outputDcpl);
+        p_Output.size      = 0;
+        p_Output.chunkSize = chunkSize;
+        H5Pclose(outputDcpl);
+    }
+
+    H5Pclose(dcpl);
+    H5Sclose(dataspace);
+    H5Pclose(inputDcpl);
+
+    return ok;
+}
+
+
+/*
+ * Copy an input dataset to the end of an output dataset via the IO buffer
+ *
+ * The data are read in the input dataset's datatype, and HDF5 converts them to the output
+ * dataset's datatype (if different) when they are written.
+ *
+ * bool CopyBuffered(const hid_t p_Input, OutputT& p_Output, const hsize_t p_Size, const std::string p_Path)
+ *
+ * @param   [IN]    p_Input                     Input dataset id
+ * @param   [IN]    p_Output                    Output dataset (already extended - p_Output.size is the size before extension)
+ * @param   [IN]    p_Size                      Number of entries to copy
+ * @param   [IN]    p_Path                      "group/dataset" (for error messages)
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::CopyBuffered(const hid_t p_Input, OutputT& p_Output, const hsize_t p_Size, const std::string p_Path) {
+
+    hid_t   datatype   = H5Dget_type(p_Input);
+    bool    vlen       = H5Tis_variable_str(datatype) > 0 || H5Tdetect_class(datatype, H5T_VLEN) > 0;
+    hsize_t blockSize  = std::max(static_cast<hsize_t>(1), static_cast<hsize_t>(m_Parameters.bufferSize)) * p_Output.chunkSize;
+    hid_t   inputSpace = H5Dget_space(p_Input);
+    hid_t   outSpace   = H5Dget_space(p_Output.dataset);
+
+    if (H5Tget_class(datatype) == H5T_STRING && H5Tget_class(p_Output.datatype) == H5T_STRING &&                // the output dataset's datatype can't be changed
+        !vlen && H5Tis_variable_str(p_Output.datatype) <= 0 && H5Tget_size(datatype) > H5Tget_size(p_Output.datatype)) {
+        std::cerr << "WARNING: Strings longer than " << H5Tget_size(p_Output.datatype) << " characters truncated when copying dataset " << p_Path << " to file " << m_OutputFilename << std::endl;
+    }
+
+    std::vector<char> buf(std::min(blockSize, p_Size) * H5Tget_size(datatype));
+
+    bool ok = true;
+    for (hsize_t start = 0; ok && start < p_Size; start += blockSize) {
+        hsize_t count[1]       = { std::min(blockSize, p_Size - start) };
+        hsize_t inputStart[1]  = { start };
+        hsize_t outputStart[1] = { p_Output.size + start };
+        hid_t   memSpace       = H5Screate_simple(1, count, NULL);
+
+        bool read = H5Sselect_hyperslab(inputSpace, H5S_SELECT_SET, inputStart, NULL, count, NULL) >= 0 &&
+                    H5Dread(p_Input, datatype, memSpace, inputSpace, H5P_DEFAULT, buf.data()) >= 0;
+
+        ok = read &&
+             H5Sselect_hyperslab(outSpace, H5S_SELECT_SET, outputStart, NULL, count, NULL) >= 0 &&
+             H5Dwrite(p_Output.dataset, datatype, memSpace, outSpace, H5P_DEFAULT, buf.data()) >= 0;
+
+        if (read && vlen) (void)H5Dvlen_reclaim(datatype, memSpace, H5P_DEFAULT, buf.data());
+        H5Sclose(memSpace);
+
+        if (ok) m_EntriesCopied += count[0];
+        else std::cerr << "ERROR: Unable to copy dataset " << p_Path << " to file " << m_OutputFilename << std::endl;
+    }
+
+    H5Sclose(outSpace);
+    H5Sclose(inputSpace);
+    H5Tclose(datatype);
+
+    return ok;
+}
+
+
+/*
+ * Append an input dataset to the output dataset of the same name
+ *
+ * Raw chunks are batched for copying (see FlushRawChunks()) if the layouts match: the output
+ * dataset ends on a chunk boundary, and the input dataset has the same chunk size, datatype and
+ * filters.  Otherwise the dataset is copied via the IO buffer (see CopyBuffered()).
+ *
+ * bool CopyDataset(const hid_t p_InputFileId, const int p_Fd, const std::string p_Filename, const std::string p_Group, const std::string p_Dataset)
+ *
+ * @param   [IN]    p_InputFileId               Input file id
+ * @param   [IN]    p_Fd                        Input file descriptor for raw chunk reads (< 0 if raw chunks can't be read)
+ * @param   [IN]    p_Filename                  Input file name (for error messages)
+ * @param   [IN]    p_Group                     HDF5 group name
+ * @param   [IN]    p_Dataset                   HDF5 dataset name
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::CopyDataset(const hid_t p_InputFileId, const int p_Fd, const std::string p_Filename, const std::string p_Group, const std::string p_Dataset) {
+
+    std::string path  = p_Group + "/" + p_Dataset;
+    hid_t       input = H5Dopen(p_InputFileId, path.c_str(), H5P_DEFAULT);
+    if (input < 0) {
+        std::cerr << "ERROR: Unable to open dataset " << path << " in file " << p_Filename << std::endl;
+        return false;
+    }
+
+    bool    ok        = false;
+    hsize_t size      = 0;
+    hid_t   dataspace = H5Dget_space(input);
+
+    if (H5Sget_simple_extent_ndims(dataspace) != 1) {
+        std::cerr << "ERROR: Dataset " << path << " in file " << p_Filename << " is not 1-dimensional" << std::endl;
+    }
+    else {
+        (void)H5Sget_simple_extent_dims(dataspace, &size, NULL);
+
+        auto output = m_Outputs.find(path);
+        if (output == m_Outputs.end()) {
+            OutputT newOutput;
+            if (OpenOutputDataset(input, p_Group, p_Dataset, newOutput)) output = m_Outputs.emplace(path, newOutput).first;
+        }
+
+        if (output != m_Outputs.end()) {
+            OutputT& out        = output->second;
+            hsize_t  newSize[1] = { out.size + size };
+
+            if (size == 0) ok = true;
+            else if (H5Dset_extent(out.dataset, newSize) < 0) {
+                std::cerr << "ERROR: Unable to extend dataset " << path << " in file " << m_OutputFilename << std::endl;
+            }
+            else {
+                hid_t   dcpl      = H5Dget_create_plist(input);
+                hsize_t chunkSize = 0;
+                bool    rawCopy   = H5MERGE_RAW_CHUNKS && p_Fd >= 0 &&
+                                    out.size % out.chunkSize == 0 &&
+                                    H5Pget_layout(dcpl) == H5D_CHUNKED && H5Pget_chunk(dcpl, 1, &chunkSize) == 1 && chunkSize == out.chunkSize &&
+                                    FilterPipeline(dcpl) == out.filters;
+                if (rawCopy) {
+                    hid_t datatype = H5Dget_type(input);
+                    rawCopy = H5Tequal(datatype, out.datatype) > 0;
+                    H5Tclose(datatype);
+                }
+                H5Pclose(dcpl);
+
+                if (rawCopy) {                                                                                  // copy chunk by chunk
+                    ok = true;
+                    for (hsize_t start = 0; ok && start < size; start += chunkSize) {
+                        hsize_t  coords[1]  = { start };
+                        unsigned filterMask = 0;
+                        haddr_t  address    = HADDR_UNDEF;
+                        hsize_t  bytes      = 0;
+#if H5MERGE_RAW_CHUNKS
+                        ok = H5Dget_chunk_info_by_coord(input, coords, &filterMask, &address, &bytes) >= 0;
+#endif
+                        if (!ok) {
+                            std::cerr << "ERROR: Unable to locate chunk of dataset " << path << " in file " << p_Filename << std::endl;
+                        }
+                        else if (address != HADDR_UNDEF && bytes > 0) {                                         // chunks never written read as fill values in the output too
+                            if (!m_RawChunks.empty() && m_RawChunkBytes + bytes > H5MERGE_BATCH_BYTES) ok = FlushRawChunks();
+                            m_RawChunks.push_back({ p_Fd, address, static_cast<size_t>(bytes), filterMask, out.dataset, out.size + start });
+                            m_RawChunkBytes += bytes;
+                        }
+                    }
+                }
+                else {                                                                                          // copy via the IO buffer
+                    ok = CopyBuffered(input, out, size, path);
+                }
+
+                out.size += size;
+            }
+        }
+    }
+
+    H5Sclose(dataspace);
+    H5Dclose(input);
+
+    return ok;
+}
+
+
+/*
+ * Copy (append) the groups of an input file to the output file
+ *
+ * bool CopyFile(const std::string p_Filename)
+ *
+ * @param   [IN]    p_Filename                  Input file name
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::CopyFile(const std::string p_Filename) {
+
+    hid_t fileId = H5Fopen(p_Filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (fileId < 0) {
+        std::cerr << "ERROR: Unable to open HDF5 file " << p_Filename << std::endl;
+        return false;
+    }
+
+    std::cout << "Copying file " << p_Filename << std::endl;
+
+    // raw chunks are read from the file directly - HDF5 chunk addresses
+    // are relative to the end of the user block, so only if there isn't one
+    hsize_t userBlock = 0;
+    hid_t   fcpl      = H5Fget_create_plist(fileId);
+    (void)H5Pget_userblock(fcpl, &userBlock);
+    H5Pclose(fcpl);
+    int fd = userBlock == 0 ? open(p_Filename.c_str(), O_RDONLY) : -1;
+
+    bool  ok   = true;
+    hid_t root = H5Gopen(fileId, "/", H5P_DEFAULT);
+    for (auto& group: Members(root, H5I_GROUP)) {
+
+        if (std::find(m_Parameters.excludeGroups.begin(), m_Parameters.excludeGroups.end(), group) != m_Parameters.excludeGroups.end()) continue;
+
+        hid_t inputGroup = H5Gopen(fileId, group.c_str(), H5P_DEFAULT);
+        std::vector<std::string> datasets = Members(inputGroup, H5I_DATASET);
+        H5Gclose(inputGroup);
+
+        hid_t outputGroup = H5Lexists(m_OutputFileId, group.c_str(), H5P_DEFAULT) > 0
+                            ? H5Gopen(m_OutputFileId, group.c_str(), H5P_DEFAULT)
+                            : H5Gcreate(m_OutputFileId, group.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        if (outputGroup < 0) {
+            std::cerr << "ERROR: Unable to create group " << group << " in file " << m_OutputFilename << std::endl;
+            ok = false;
+            break;
+        }
+        size_t outputDatasets = Members(outputGroup, H5I_DATASET).size();
+        H5Gclose(outputGroup);
+
+        if (outputDatasets > 0 && outputDatasets != datasets.size()) {                                          // skip the group, as h5copy.py does
+            std::cerr << "Dataset count mismatch between source and destination for group " << group << " in files " << p_Filename << " and " << m_OutputFilename << std::endl;
+            std::cerr << "WARNING: Group " << group << " from file " << p_Filename << " not copied to " << m_OutputFilename << std::endl;
+            continue;
+        }
+
+        for (auto& dataset: datasets) {
+            if (!(ok = CopyDataset(fileId, fd, p_Filename, group, dataset))) break;
+        }
+        if (!ok) break;
+    }
+    H5Gclose(root);
+
+    ok = FlushRawChunks() && ok;                                                                                // the input file must stay open until its raw chunks are copied
+
+    if (fd >= 0) close(fd);
+    H5Fclose(fileId);
+
+    if (ok) m_FilesCopied++;
+
+    return ok;
+}
+
+
+/*
+ * Record the datasets of an input file as sources for the virtual output datasets
+ *
+ * bool IndexFile(const std::string p_Filename)
+ *
+ * @param   [IN]    p_Filename                  Input file name
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::IndexFile(const std::string p_Filename) {
+
+    hid_t fileId = H5Fopen(p_Filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (fileId < 0) {
+        std::cerr << "ERROR: Unable to open HDF5 file " << p_Filename << std::endl;
+        return false;
+    }
+
+    std::cout << "Indexing file " << p_Filename << std::endl;
+
+    // record the input file relative to the output file if possible - HDF5 looks for
+    // relative source files in the directory of the file containing the virtual dataset
+    boost::system::error_code error;
+    fs::path    relative = fs::relative(fs::path(p_Filename), fs::path(m_OutputFilename).parent_path(), error);
+    std::string filename = error || relative.empty() ? p_Filename : relative.string();
+
+    bool  ok   = true;
+    hid_t root = H5Gopen(fileId, "/", H5P_DEFAULT);
+    for (auto& group: Members(root, H5I_GROUP)) {
+
+        if (std::find(m_Parameters.excludeGroups.begin(), m_Parameters.excludeGroups.end(), group) != m_Parameters.excludeGroups.end()) continue;
+
+        hid_t inputGroup = H5Gopen(fileId, group.c_str(), H5P_DEFAULT);
+        std::vector<std::string> datasets = Members(inputGroup, H5I_DATASET);
+        H5Gclose(inputGroup);
+
+        auto groupSize = m_VirtualGroups.emplace(group, datasets.size()).first;                                  // number of datasets in the output group
+        if (groupSize->second != datasets.size()) {                                                             // skip the group, as h5copy.py does
+            std::cerr << "Dataset count mismatch between source and destination for group " << group << " in files " << p_Filename << " and " << m_OutputFilename << std::endl;
+            std::cerr << "WARNING: Group " << group << " from file " << p_Filename << " not copied to " << m_OutputFilename << std::endl;
+            continue;
+        }
+
+        for (auto& dataset: datasets) {
+            std::string path  = group + "/" + dataset;
+            hid_t       input = H5Dopen(fileId, path.c_str(), H5P_DEFAULT);
+            hsize_t     size  = 0;
+            if (input >= 0) {
+                hid_t dataspace = H5Dget_space(input);
+                ok = H5Sget_simple_extent_ndims(dataspace) == 1 && H5Sget_simple_extent_dims(dataspace, &size, NULL) >= 0;  // 1-d datasets only
+                H5Sclose(dataspace);
+                H5Dclose(input);
+            }
+            else ok = false;
+
+            if (!ok) {
+                std::cerr << "ERROR: Unable to index dataset " << path << " in file " << p_Filename << std::endl;
+                break;
+            }
+
+            auto output = m_VirtualOutputs.find(path);
+            if (output == m_VirtualOutputs.end()) {
+                output = m_VirtualOutputs.emplace(path, VirtualOutputT{ p_Filename, {}, 0 }).first;
+                m_VirtualOrder.push_back(path);
+            }
+            if (size > 0) output->second.mappings.push_back({ filename, output->second.size, size });
+            output->second.size += size;
+        }
+        if (!ok) break;
+    }
+    H5Gclose(root);
+    H5Fclose(fileId);
+
+    if (ok) m_FilesCopied++;
+
+    return ok;
+}
+
+
+/*
+ * Create the virtual output datasets recorded by IndexFile()
+ *
+ * Each output dataset maps its input datasets end to end, and takes the datatype and
+ * attributes of the first input dataset.
+ *
+ * bool CreateVirtualDatasets()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::CreateVirtualDatasets() {
+
+    std::string inputFilename = "";
+    hid_t       inputFileId   = -1;
+
+    bool ok = true;
+    for (auto& path: m_VirtualOrder) {
+        VirtualOutputT& output = m_VirtualOutputs[path];
+        std::string     group  = path.substr(0, path.find('/'));
+
+        if (output.inputFilename != inputFilename) {
+            if (inputFileId >= 0) H5Fclose(inputFileId);
+            inputFilename = output.inputFilename;
+            inputFileId   = H5Fopen(inputFilename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+        }
+        hid_t input = inputFileId >= 0 ? H5Dopen(inputFileId, path.c_str(), H5P_DEFAULT) : -1;
+        if (input < 0) {
+            std::cerr << "ERROR: Unable to open dataset " << path << " in file " << inputFilename << std::endl;
+            ok = false;
+            break;
+        }
+
+        if (H5Lexists(m_OutputFileId, group.c_str(), H5P_DEFAULT) <= 0) {
+            hid_t outputGroup = H5Gcreate(m_OutputFileId, group.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            if (outputGroup >= 0) H5Gclose(outputGroup);
+        }
+
+        hsize_t dims[1]       = { output.size };
+        hid_t   virtualSpace  = H5Screate_simple(1, dims, NULL);
+        hid_t   dcpl          = H5Pcreate(H5P_DATASET_CREATE);
+        std::string dataset   = "/" + path;
+        (void)H5Pset_layout(dcpl, H5D_VIRTUAL);
+        for (auto& mapping: output.mappings) {
+            hsize_t start[1]    = { mapping.start };
+            hsize_t count[1]    = { mapping.size };
+            hid_t   sourceSpace = H5Screate_simple(1, count, NULL);
+            ok = H5Sselect_hyperslab(virtualSpace, H5S_SELECT_SET, start, NULL, count, NULL) >= 0 &&
+                 H5Pset_virtual(dcpl, virtualSpace, mapping.filename.c_str(), dataset.c_str(), sourceSpace) >= 0;
+            H5Sclose(sourceSpace);
+            if (!ok) break;
+        }
+        (void)H5Sselect_all(virtualSpace);
+
+        hid_t datatype = H5Dget_type(input);
+        hid_t virtualDataset = ok ? H5Dcreate(m_OutputFileId, path.c_str(), datatype, virtualSpace, H5P_DEFAULT, dcpl, H5P_DEFAULT) : -1;
+        if (virtualDataset < 0 || !CopyAttributes(input, virtualDataset)) {
+            std::cerr << "ERROR: Unable to create virtual dataset " << path << " in file " << m_OutputFilename << std::endl;
+            ok = false;
+        }
+
+        if (virtualDataset >= 0) H5Dclose(virtualDataset);
+        H5Tclose(datatype);
+        H5Pclose(dcpl);
+        H5Sclose(virtualSpace);
+        H5Dclose(input);
+
+        if (!ok) break;
+    }
+
+    if (inputFileId >= 0) H5Fclose(inputFileId);
+
+    return ok;
+}
+
+
+/*
+ * Collect the input files named by an input path, as h5copy.py does
+ *
+ * A file is collected if its name matches the filename filter.  A directory's files are
+ * collected (in name order) if they match the filter, and its subdirectories are descended
+ * into while p_Depth is not 0.
+ *
+ * bool CollectInputFiles(const std::string p_Path, const int p_Depth, std::vector<std::string>& p_Files)
+ *
+ * @param   [IN]    p_Path                      Input file or directory name
+ * @param   [IN]    p_Depth                     Recursion levels remaining (< 0 = unlimited)
+ * @param   [OUT]   p_Files                     Input files collected (fully-qualified names) - appended to
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::CollectInputFiles(const std::string p_Path, const int p_Depth, std::vector<std::string>& p_Files) const {
+
+    std::string filter = m_Parameters.filenameFilter + ".h5";
+
+    boost::system::error_code error;
+    fs::path path = fs::absolute(fs::path(p_Path));
+
+    if (fs::is_regular_file(path, error)) {
+        if (fnmatch(filter.c_str(), path.filename().c_str(), 0) == 0) p_Files.push_back(fs::canonical(path, error).string());
+        else std::cerr << "WARNING: " << p_Path << " does not match file filter (" << filter << "): ignored" << std::endl;
+    }
+    else if (fs::is_directory(path, error)) {
+        std::vector<fs::path> entries;
+        for (fs::directory_iterator entry(path, error), end; !error && entry != end; entry.increment(error)) entries.push_back(entry->path());
+        if (error) {
+            std::cerr << "ERROR: Unable to read directory " << p_Path << ": " << error.message() << std::endl;
+            return false;
+        }
+        std::sort(entries.begin(), entries.end());
+
+        for (auto& entry: entries) {
+            if (fs::is_regular_file(entry, error) && fnmatch(filter.c_str(), entry.filename().c_str(), 0) == 0) p_Files.push_back(fs::canonical(entry, error).string());
+        }
+        if (p_Depth != 0) {
+            for (auto& entry: entries) {
+                if (fs::is_directory(entry, error) && !CollectInputFiles(entry.string(), p_Depth - 1, p_Files)) return false;
+            }
+        }
+    }
+    else std::cerr << "WARNING: " << p_Path << " does not exist or is not a file or a directory: ignored" << std::endl;
+
+    return true;
+}
+
+
+/*
+ * Run the merge
+ *
+ * bool Run()
+ *
+ * @return                                      Boolean status (true = ok)
+ */
+bool H5Merger::Run() {
+
+    fs::path output = fs::absolute(fs::path(m_Parameters.outputFilename));
+    m_OutputFilename = output.string();
+
+    boost::system::error_code error;
+    bool exists = fs::exists(output, error);
+    if (exists && !fs::is_regular_file(output, error)) {
+        std::cerr << "ERROR: " << m_OutputFilename << " is the name of an existing directory or other filesystem object - choose a different output filename" << std::endl;
+        return false;
+    }
+    if (exists && !m_Parameters.eraseOutput && m_Parameters.virtualDatasets) {
+        std::cerr << "ERROR: Virtual datasets can't be appended to - use --erase-output, or choose a different output filename" << std::endl;
+        return false;
+    }
+    if (exists) m_OutputFilename = fs::canonical(output, error).string();
+
+    std::vector<std::string> files;
+    for (auto& input: m_Parameters.inputs) {
+        if (!CollectInputFiles(input, m_Parameters.recursionDepth, files) && m_Parameters.stopOnError) return false;
+    }
+    files.erase(std::remove(files.begin(), files.end(), m_OutputFilename), files.end());                         // don't copy the output file to itself
+
+    // the chunk cache is disabled for the output file (as h5copy.py does) - the output
+    // datasets are written sequentially, and all of them are open for the whole run
+    hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+    int    mdcElements;
+    size_t rdccSlots, rdccBytes;
+    double rdccW0;
+    (void)H5Pget_cache(fapl, &mdcElements, &rdccSlots, &rdccBytes, &rdccW0);
+    (void)H5Pset_cache(fapl, mdcElements, rdccSlots, 0, rdccW0);
+
+    m_OutputFileId = exists && !m_Parameters.eraseOutput
+                     ? H5Fopen(m_OutputFilename.c_str(), H5F_ACC_RDWR, fapl)
+                     : H5Fcreate(m_OutputFilename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    H5Pclose(fapl);
+    if (m_OutputFileId < 0) {
+        std::cerr << "ERROR: Unable to open output file " << m_OutputFilename << std::endl;
+        return false;
+    }
+
+    bool ok = true;
+    for (auto& file: files) {
+        bool fileOk = m_Parameters.virtualDatasets ? IndexFile(file) : CopyFile(file);
+        ok = fileOk && ok;
+        if (!fileOk && m_Parameters.stopOnError) break;
+    }
+    if (m_Parameters.virtualDatasets && (ok || !m_Parameters.stopOnError)) ok = CreateVirtualDatasets() && ok;
+
+    for (auto& output: m_Outputs) {
+        H5Tclose(output.second.datatype);
+        H5Dclose(output.second.dataset);
+    }
+    m_Outputs.clear();
+
+    if (H5Fclose(m_OutputFileId) < 0) ok = false;
+    m_OutputFileId = -1;
+
+    std::cout << "Files " << (m_Parameters.virtualDatasets ? "indexed: " : "copied: ") << m_FilesCopied << " of " << files.size() << std::endl;
+    if (!m_Parameters.virtualDatasets) {
+        std::cout << "Raw chunks copied: " << m_ChunksCopied << ", entries copied via IO buffer: " << m_EntriesCopied << std::endl;
+    }
+
+    return ok;
+}
+
+
+int main(int argc, char *argv[]) {
+
+    H5MergeParametersT p;
+
+    po::options_description options("COMPAS HDF5 merge options");
+    options.add_options()
+        ("help,h",                                                                                                          "Print this help message")
+        ("input",          po::value<std::vector<std::string>>(&p.inputs)->multitoken(),                                    "Input directory and/or file name(s)")
+        ("buffer-size,b",  po::value<size_t>(&p.bufferSize)->default_value(H5MERGE_DEFAULT_BUFFER_SIZE),                    "IO buffer size (number of HDF5 chunks) for datasets not copied chunk by chunk")
+        ("chunk-size,c",   po::value<size_t>(&p.chunkSize)->default_value(0),                                               "HDF5 output file dataset chunk size (0 = chunk size of the input datasets)")
+        ("erase-output,e", po::bool_switch(&p.eraseOutput),                                                                 "Erase existing output file before copying input files")
+        ("filter,f",       po::value<std::string>(&p.filenameFilter)->default_value("*"),                                   "Input filename filter (the .h5 extension is added)")
+        ("output,o",       po::value<std::string>(&p.outputFilename)->default_value("h5out.h5"),                            "Output file name")
+        ("recursive,r",    po::value<int>(&p.recursionDepth)->default_value(0)->implicit_value(-1),                         "Recursion depth (default is no recursion; -r with no depth is unlimited)")
+        ("stop-on-error,s", po::bool_switch(&p.stopOnError),                                                                "Stop all copying if an error occurs (default is skip to next file and continue)")
+        ("exclude,x",      po::value<std::vector<std::string>>(&p.excludeGroups)->multitoken(),                             "List of input groups to be excluded (default is all groups will be copied)")
+        ("vds",            po::bool_switch(&p.virtualDatasets),                                                             "Create virtual datasets that refer to the input files instead of copying them")
+        ("threads",        po::value<int>(&p.threads)->default_value(std::max(1U, std::thread::hardware_concurrency())),    "Number of threads reading raw chunks from the input files")
+    ;
+
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(options).positional(positional).run(), vm);
+        po::notify(vm);
+    }
+    catch (po::error& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (vm.count("help")) {
+        std::cout << "Usage: COMPAS_H5Merge [options] input [input ...]" << std::endl << std::endl << options << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    if (p.outputFilename.size() < 3 || (p.outputFilename.substr(p.outputFilename.size() - 3) != ".h5" && p.outputFilename.substr(p.outputFilename.size() - 3) != ".H5")) {
+        p.outputFilename += ".h5";                                                                              // add output file extension if necessary (as h5copy.py does)
+    }
+
+    if (p.inputs.empty()) {
+        std::cerr << "ERROR: No input files or directories specified" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    H5Eset_auto(H5E_DEFAULT, NULL, NULL);                                                                       // disable HDF5 error stack printing - errors are reported here
+
+    H5Merger merger(p);
+
+    return merger.Run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,154 @@
+#ifndef __H5Merge_h__
+#define __H5Merge_h__
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "hdf5.h"
+
+
+/*
+ * Native merging of COMPAS HDF5 output files
+ *
+ * This is a compiled replacement for compas_python_utils/h5copy.py: it copies (concatenates) the
+ * groups and datasets of one or more COMPAS HDF5 files (e.g. the outputs of the shards of a large
+ * run) into a single output file.  It is built alongside COMPAS (see the Makefile) as a separate
+ * executable.  The command-line options and the copying rules follow h5copy.py:
+ *
+ *    - input files and directories are processed in the order given (directories in name order,
+ *      descending --recursive levels), and only files named <filter>.h5 are copied
+ *    - each input group (COMPAS logfile) is appended to the output group of the same name, unless
+ *      it is excluded (--exclude), or the output group already holds a different number of datasets
+ *      (in which case a warning is issued and the group is skipped for that file)
+ *    - each input dataset (COMPAS column) is appended to the output dataset of the same name, which
+ *      is created if necessary - as Log::CreateHDF5Dataset() creates datasets: 1-d, chunked, unlimited,
+ *      allocated incrementally, with the units (and any other) attributes of the input dataset
+ *
+ * Datasets created in the output file take the filters (e.g. --hdf5-compression) and, unless --chunk-size
+ * is specified, the chunk size of the first input dataset copied to them.  Data are copied in one of two
+ * ways:
+ *
+ *    - chunk by chunk: if the output dataset ends on a chunk boundary, and the input dataset has the same
+ *      chunk size, datatype and filters, the raw (filtered) chunks of the input dataset are copied as they
+ *      are stored (H5Dwrite_chunk()) - no decompression, datatype conversion or recompression.  The chunks
+ *      are read from the input file directly (at the file addresses HDF5 reports), in batches of up to
+ *      H5MERGE_BATCH_BYTES, split across --threads threads - so reads from (e.g.) a parallel filesystem
+ *      proceed concurrently, while HDF5 (which serialises its API calls) is only called to write them.
+ *      COMPAS output files are written a whole chunk at a time, so typically the whole of the first file
+ *      copied, and every dataset that has a multiple of the chunk size entries (e.g. BSE_System_Parameters
+ *      when each shard evolves a multiple of --hdf5-chunk-size binaries), is copied this way
+ *    - otherwise through an IO buffer of --buffer-size chunks, via HDF5 (H5Dread()/H5Dwrite()), which
+ *      converts the datatype if the input dataset's datatype differs from the output dataset's (e.g.
+ *      fixed-length strings of different lengths)
+ *
+ * Instead of copying, --vds creates an index file: each output dataset is an HDF5 virtual dataset (VDS)
+ * that maps the input datasets end to end, so the output file holds no data (and is created almost
+ * instantly) but reads exactly as the concatenated file would.  The input files must remain in place
+ * (their names are recorded relative to the output file where possible, so the directory tree can be
+ * moved as a whole).  VDS requires HDF5 1.10 or later to read (h5py >= 2.9).
+ */
+
+
+constexpr size_t H5MERGE_BATCH_BYTES = 256 * 1024 * 1024;                      // maximum size of a batch of raw chunks read concurrently (bytes)
+
+
+// merge parameters - defaults match h5copy.py where the options are the same
+typedef struct H5MergeParameters {
+
+    std::vector<std::string> inputs;                    // input file and/or directory names
+    std::string              outputFilename;            // output file name
+    std::string              filenameFilter;            // input filename filter (the ".h5" extension is added)
+    int                      recursionDepth;            // directory recursion depth (0 = no recursion, < 0 = unlimited)
+    std::vector<std::string> excludeGroups;             // input groups not copied
+
+    bool                     eraseOutput;               // erase an existing output file before copying
+    bool                     stopOnError;               // stop at the first error (otherwise skip to the next file)
+    bool                     virtualDatasets;           // create virtual datasets (VDS) referring to the input files instead of copying
+
+    size_t                   chunkSize;                 // chunk size of datasets created in the output file (0 = that of the first input dataset)
+    size_t                   bufferSize;                // IO buffer size (number of chunks) for datasets not copied chunk by chunk
+    int                      threads;                   // number of threads reading raw chunks
+} H5MergeParametersT;
+
+
+class H5Merger {
+
+public:
+
+    H5Merger(const H5MergeParametersT& p_Parameters);
+
+    bool Run();
+
+private:
+
+    // an output dataset
+    typedef struct Output {
+        hid_t                 dataset;                  // dataset id (open for the whole run)
+        hid_t                 datatype;                 // datatype
+        hsize_t               size;                     // current size (entries)
+        hsize_t               chunkSize;                // chunk size (entries)
+        std::vector<unsigned> filters;                  // filter pipeline (see FilterPipeline())
+    } OutputT;
+
+    // a raw chunk to be copied from an input file to an output dataset
+    typedef struct RawChunk {
+        int      fd;                                    // input file descriptor
+        haddr_t  address;                               // file address of the chunk
+        size_t   bytes;                                 // stored (filtered) size of the chunk
+        unsigned filterMask;                            // filters skipped when the chunk was written
+        hid_t    dataset;                               // output dataset
+        hsize_t  offset;                                // output chunk offset (entries)
+    } RawChunkT;
+
+    // a VDS mapping: an input dataset and its position in the output dataset
+    typedef struct Mapping {
+        std::string filename;                           // input file name (relative to the output file if possible)
+        hsize_t     start;                              // first output entry
+        hsize_t     size;                               // entries
+    } MappingT;
+
+    // a virtual output dataset
+    typedef struct VirtualOutput {
+        std::string           inputFilename;            // the input file the dataset was first seen in (for datatype and attributes)
+        std::vector<MappingT> mappings;                 // input datasets, in order
+        hsize_t               size;                     // total size (entries)
+    } VirtualOutputT;
+
+    H5MergeParametersT                    m_Parameters;
+
+    std::string                           m_OutputFilename;     // fully-qualified output filename
+    hid_t                                 m_OutputFileId;
+
+    std::map<std::string, OutputT>        m_Outputs;            // output datasets, keyed by "group/dataset"
+    std::vector<RawChunkT>                m_RawChunks;          // raw chunks batched for copying
+    size_t                                m_RawChunkBytes;      // bytes in m_RawChunks
+
+    std::vector<std::string>              m_VirtualOrder;       // virtual output datasets ("group/dataset") in order of first appearance
+    std::map<std::string, VirtualOutputT> m_VirtualOutputs;     // virtual output datasets, keyed by "group/dataset"
+    std::map<std::string, size_t>         m_VirtualGroups;      // number of datasets in each virtual output group
+
+    // statistics
+    size_t                                m_FilesCopied;
+    unsigned long long                    m_ChunksCopied;       // raw chunks copied
+    unsigned long long                    m_EntriesCopied;      // entries copied via the IO buffer
+
+
+    bool CollectInputFiles(const std::string p_Path, const int p_Depth, std::vector<std::string>& p_Files) const;
+
+    bool CopyFile(const std::string p_Filename);
+    bool CopyDataset(const hid_t p_InputFileId, const int p_Fd, const std::string p_Filename, const std::string p_Group, const std::string p_Dataset);
+    bool CopyBuffered(const hid_t p_Input, OutputT& p_Output, const hsize_t p_Size, const std::string p_Path);
+    bool OpenOutputDataset(const hid_t p_Input, const std::string p_Group, const std::string p_Dataset, OutputT& p_Output);
+    bool FlushRawChunks();
+
+    bool IndexFile(const std::string p_Filename);
+    bool CreateVirtualDatasets();
+
+    static std::vector<std::string> Members(const hid_t p_Group, const H5I_type_t p_Type);
+    static std::vector<unsigned>    FilterPipeline(const hid_t p_Dcpl);
+    static bool                     CopyAttributes(const hid_t p_From, const hid_t p_To);
+};
+
+
+#endif // __H5Merge_h__
@@ -0,0 +1,266 @@
+#include <cmath>
+#include <limits>
+
+#include "ImportanceSampler.h"
+#include "Options.h"
+#include "Rand.h"
+#include "utils.h"
+
+ImportanceSampler* ImportanceSampler::m_Instance = nullptr;
+
+
+ImportanceSampler* ImportanceSampler::Instance() {
+
+    if (!m_Instance) {
+        m_Instance = new ImportanceSampler();
+    }
+    return m_Instance;
+}
+
+
+/*
+ * Start the ImportanceSampler service
+ *
+ * Enables the service if the user specified --importance-sampling, and sets up the prior
+ * densities from the birth distributions specified by the user (the distributions have
+ * been validated by the Options service).  Until the first refit the proposal is the prior.
+ *
+ *
+ * void Start()
+ */
+void ImportanceSampler::Start() {
+
+    m_Enabled = OPTIONS->ImportanceSampling();
+    if (!m_Enabled) return;
+
+    m_BatchSize           = OPTIONS->ImportanceSamplingBatchSize();
+    m_ExplorationFraction = OPTIONS->ImportanceSamplingExplorationFraction();
+
+    double massMin = OPTIONS->InitialMassFunctionMin();
+    double massMax = OPTIONS->InitialMassFunctionMax();
+
+    m_Lower = {{ std::log(massMin), OPTIONS->MassRatioDistributionMin(), std::log(OPTIONS->SemiMajorAxisDistributionMin()) }};
+    m_Upper = {{ std::log(massMax), OPTIONS->MassRatioDistributionMax(), std::log(OPTIONS->SemiMajorAxisDistributionMax()) }};
+
+    for (int i = 0; i < IS_DIMENSIONS; i++) {
+        m_PriorScale[i] = (m_Upper[i] - m_Lower[i]) / std::sqrt(12.0);                                     // standard deviation of a uniform distribution over the bounds
+    }
+
+    // the initial mass function as power law segments, continuous at the breaks
+    // (see utils::SampleInitialMass())
+
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    std::vector<PowerLawSegmentT> imf;
+    switch (OPTIONS->InitialMassFunction()) {
+        case INITIAL_MASS_FUNCTION::SALPETER: imf = {{ 0.0, inf, SALPETER_POWER, 1.0 }}; break;
+        case INITIAL_MASS_FUNCTION::POWERLAW: imf = {{ 0.0, inf, OPTIONS->InitialMassFunctionPower(), 1.0 }}; break;
+        case INITIAL_MASS_FUNCTION::UNIFORM : imf = {{ 0.0, inf, 0.0, 1.0 }}; break;
+        case INITIAL_MASS_FUNCTION::KROUPA  : imf = {{ 0.0,            KROUPA_BREAK_1, KROUPA_POWER_1, 1.0 },
+                                                     { KROUPA_BREAK_1, KROUPA_BREAK_2, KROUPA_POWER_2, KROUPA_BREAK_1_POWER_1_2 },
+                                                     { KROUPA_BREAK_2, inf,            KROUPA_POWER_3, KROUPA_BREAK_1_POWER_1_2 * KROUPA_BREAK_2_POWER_2_3 }}; break;
+    }
+
+    m_IMFSegments.clear();
+    m_IMFNormalisation = 0.0;
+    for (auto& segment: imf) {                                                                              // clip the segments to the mass bounds and integrate
+        double lower = std::max(segment.lower, massMin);
+        double upper = std::min(segment.upper, massMax);
+        if (lower >= upper) continue;
+
+        double powerPlus1 = segment.power + 1.0;
+        m_IMFNormalisation += segment.coefficient * (powerPlus1 == 0.0 ? std::log(upper / lower) : (PPOW(upper, powerPlus1) - PPOW(lower, powerPlus1)) / powerPlus1);
+
+        m_IMFSegments.push_back({ lower, upper, segment.power, segment.coefficient });
+    }
+
+    m_LogPriorDensityQA = -std::log(m_Upper[1] - m_Lower[1]) - std::log(m_Upper[2] - m_Lower[2]);          // flat in q and in ln a
+
+    m_Components.clear();
+    m_Hits.clear();
+    m_HitWeight        = 0.0;
+    m_TotalWeight      = 0.0;
+    m_BinariesRecorded = 0;
+}
+
+
+/*
+ * Location of a sample in the sampled dimensions (ln m1, q, ln a)
+ *
+ *
+ * LocationT Location(const ImportanceSampleT& p_Sample)
+ *
+ * @param   [IN]    p_Sample                    The sample
+ * @return                                      Location of the sample
+ */
+ImportanceSampler::LocationT ImportanceSampler::Location(const ImportanceSampleT& p_Sample) {
+    return {{ std::log(p_Sample.mass1), p_Sample.massRatio, std::log(p_Sample.semiMajorAxis) }};
+}
+
+
+/*
+ * ln of the prior density at p_X, with respect to (ln m1, q, ln a)
+ *
+ *
+ * double LogPriorDensity(const LocationT& p_X)
+ *
+ * @param   [IN]    p_X                         Location
+ * @return                                      ln of the prior density
+ */
+double ImportanceSampler::LogPriorDensity(const LocationT& p_X) const {
+
+    double mass = std::exp(p_X[0]);
+
+    const PowerLawSegmentT* segment = &m_IMFSegments.back();
+    for (auto& thisSegment: m_IMFSegments) {
+        if (mass < thisSegment.upper) { segment = &thisSegment; break; }
+    }
+
+    return std::log(segment->coefficient / m_IMFNormalisation) + (segment->power + 1.0) * p_X[0] + m_LogPriorDensityQA;    // dN/dln(m) = m dN/dm
+}
+
+
+/*
+ * ln of the density of the current proposal mixture at p_X, with respect to (ln m1, q, ln a)
+ *
+ * The components are equally weighted and truncated to the prior bounds.
+ *
+ *
+ * double LogMixtureDensity(const LocationT& p_X)
+ *
+ * @param   [IN]    p_X                         Location
+ * @return                                      ln of the mixture density (-inf if the density underflows)
+ */
+double ImportanceSampler::LogMixtureDensity(const LocationT& p_X) const {
+
+    double density = 0.0;
+    for (auto& component: m_Components) {
+        double exponent = 0.0;
+        for (int i = 0; i < IS_DIMENSIONS; i++) {
+            double z  = (p_X[i] - component.mean[i]) / m_Sigma[i];
+            exponent -= 0.5 * z * z;
+        }
+        density += std::exp(exponent - component.logNormalisation);
+    }
+
+    return std::log(density / m_Components.size()) + m_LogGaussianNormalisation;
+}
+
+
+/*
+ * Refit the proposal mixture to the hits found so far
+ *
+ * One gaussian per hit, with widths equal to the prior spread scaled by the (weighted) hit
+ * fraction to the power 1/IS_DIMENSIONS - i.e. each gaussian covers roughly the volume of the
+ * prior that is expected to hold one hit.  If no hits have been found yet the proposal remains
+ * the prior.
+ *
+ *
+ * void Refit()
+ */
+void ImportanceSampler::Refit() {
+
+    if (m_Hits.empty()) return;
+
+    double scale = std::pow(std::min(HitFraction(), 1.0), 1.0 / IS_DIMENSIONS);
+
+    m_LogGaussianNormalisation = -0.5 * IS_DIMENSIONS * std::log(_2_PI);
+    for (int i = 0; i < IS_DIMENSIONS; i++) {
+        m_Sigma[i] = m_PriorScale[i] * scale;
+        m_LogGaussianNormalisation -= std::log(m_Sigma[i]);
+    }
+
+    m_Components.clear();
+    m_Components.reserve(m_Hits.size());
+    for (auto& hit: m_Hits) {
+        ComponentT component = { hit, 0.0 };
+        for (int i = 0; i < IS_DIMENSIONS; i++) {                                                           // probability mass inside the bounds
+            double upper = 0.5 * std::erfc(-(m_Upper[i] - hit[i]) / (m_Sigma[i] * M_SQRT2));
+            double lower = 0.5 * std::erfc(-(m_Lower[i] - hit[i]) / (m_Sigma[i] * M_SQRT2));
+            component.logNormalisation += std::log(upper - lower);
+        }
+        m_Components.push_back(component);
+    }
+}
+
+
+/*
+ * Draw the primary mass, mass ratio and semi-major axis of a binary
+ *
+ * Draws from the prior (the birth distributions specified by the user) until the proposal
+ * has been fitted - thereafter from the prior with probability --importance-sampling-exploration-fraction
+ * and from the proposal mixture otherwise.
+ *
+ *
+ * ImportanceSampleT Sample()
+ *
+ * @return                                      The sample, with its importance weight
+ */
+ImportanceSampleT ImportanceSampler::Sample() {
+
+    ImportanceSampleT sample;
+
+    if (m_Components.empty() || RAND->Random() < m_ExplorationFraction) {                                  // draw from the prior?
+                                                                                                            // yes
+        sample.mass1         = utils::SampleInitialMass(OPTIONS->InitialMassFunction(),
+                                                        OPTIONS->InitialMassFunctionMax(),
+                                                        OPTIONS->InitialMassFunctionMin(),
+                                                        OPTIONS->InitialMassFunctionPower());
+        sample.massRatio     = utils::SampleMassRatio(OPTIONS->MassRatioDistribution(),
+                                                      OPTIONS->MassRatioDistributionMax(),
+                                                      OPTIONS->MassRatioDistributionMin());
+        sample.semiMajorAxis = utils::SampleSemiMajorAxis(OPTIONS->SemiMajorAxisDistribution(),
+                                                          OPTIONS->SemiMajorAxisDistributionMax(),
+                                                          OPTIONS->SemiMajorAxisDistributionMin(),
+                                                          OPTIONS->SemiMajorAxisDistributionPower(),
+                                                          OPTIONS->OrbitalPeriodDistributionMax(),
+                                                          OPTIONS->OrbitalPeriodDistributionMin(),
+                                                          sample.mass1,
+                                                          sample.mass1 * sample.massRatio);
+    }
+    else {                                                                                                  // no - draw from the mixture
+        const ComponentT& component = m_Components[RAND->RandomInt(m_Components.size())];
+
+        LocationT x;
+        for (int i = 0; i < IS_DIMENSIONS; i++) {                                                           // truncated gaussian - the mean is always inside the bounds
+            do { x[i] = component.mean[i] + RAND->RandomGaussian(m_Sigma[i]); } while (x[i] < m_Lower[i] || x[i] > m_Upper[i]);
+        }
+
+        sample.mass1         = std::exp(x[0]);
+        sample.massRatio     = x[1];
+        sample.semiMajorAxis = std::exp(x[2]);
+    }
+
+    if (m_Components.empty()) {                                                                             // proposal is the prior?
+        sample.weight = 1.0;                                                                                // yes
+    }
+    else {                                                                                                  // no - prior / (f prior + (1 - f) mixture)
+        LocationT x   = Location(sample);
+        sample.weight = 1.0 / (m_ExplorationFraction + (1.0 - m_ExplorationFraction) * std::exp(LogMixtureDensity(x) - LogPriorDensity(x)));
+    }
+
+    return sample;
+}
+
+
+/*
+ * Record the outcome of a binary that has completed its evolution
+ *
+ * Refits the proposal at the end of each batch of --importance-sampling-batch-size binaries.
+ *
+ *
+ * void Record(const ImportanceSampleT& p_Sample, const bool p_Hit)
+ *
+ * @param   [IN]    p_Sample                    The sample from which the binary was constructed
+ * @param   [IN]    p_Hit                       True if the binary reached the evolution target
+ */
+void ImportanceSampler::Record(const ImportanceSampleT& p_Sample, const bool p_Hit) {
+
+    m_TotalWeight += p_Sample.weight;
+    if (p_Hit) {
+        m_HitWeight += p_Sample.weight;
+        m_Hits.push_back(Location(p_Sample));
+    }
+
+    if (++m_BinariesRecorded % m_BatchSize == 0) Refit();                                                  // end of batch - refit the proposal
+}
@@ -0,0 +1,133 @@
+#ifndef __ImportanceSampler_h__
+#define __ImportanceSampler_h__
+
+#define IMPORTANCE_SAMPLER ImportanceSampler::Instance()
+
+#include "constants.h"
+#include "typedefs.h"
+
+#include <array>
+#include <vector>
+
+
+/*
+ * Importance sampler: adaptive importance sampling of binary initial conditions
+ *
+ * Populations of rare systems (double compact objects, say) are expensive to build by plain
+ * Monte Carlo sampling, because almost all binaries sampled from the birth distributions never
+ * become one.  The ImportanceSampler service (--importance-sampling) concentrates the sampling
+ * in the regions of parameter space that produce them, following the adaptive importance sampling
+ * scheme of STROOPWAFEL (Broekgaarden et al. 2019) - but in-process, so there is no need to run
+ * COMPAS repeatedly in batches and read the output back (cf. compas_python_utils/preprocessing/
+ * stroopwafelInterface.py).
+ *
+ * The sampled dimensions are x = (ln m1, q, ln a).  The remaining initial conditions (metallicity,
+ * eccentricity, kicks etc.) are sampled as usual, so they are distributed according to their priors
+ * and don't contribute to the weights.
+ *
+ * - binaries that reach the evolution target (--evolution-target) are "hits"
+ * - until the first hits are found (and at least one batch of --importance-sampling-batch-size
+ *   binaries has been evolved), binaries are sampled from the prior (the usual birth distributions)
+ *   and have weight 1
+ * - at the end of each batch the proposal is refitted: a mixture of (truncated) gaussians, one
+ *   centred on each hit found so far, with widths equal to the prior's spread in each dimension
+ *   scaled by the estimated hit fraction to the power 1/3 (the number of dimensions) - so the
+ *   gaussians shrink as the hits get denser
+ * - once the proposal is fitted, each binary is drawn from the prior with probability f
+ *   (--importance-sampling-exploration-fraction) - which keeps exploring for regions not yet
+ *   known to produce hits - and from the mixture otherwise
+ *
+ * Each binary carries the importance weight w = prior(x) / (f prior(x) + (1 - f) mixture(x)),
+ * which is written to BSE_System_Parameters (Importance_Weight) and used to accumulate the
+ * population summary.  Weights are bounded above by 1/f.  The weighted sum over any subset of
+ * binaries estimates the number of binaries that plain sampling would have put in that subset.
+ *
+ * The prior densities are those of the initial mass function (any of the power-law IMFs), a
+ * FLAT mass ratio distribution and a FLATINLOG semi-major axis distribution - the Options
+ * service rejects any other distribution (and specified initial masses, mass ratio, semi-major
+ * axis or orbital period) when --importance-sampling is specified.  Binaries rejected at birth
+ * (touching, secondary below --minimum-secondary-mass etc.) are redrawn from the same proposal,
+ * as they would be redrawn from the prior in plain sampling.
+ */
+
+
+typedef struct ImportanceSample {
+    double mass1;                                                                                           // primary mass (Msol)
+    double massRatio;                                                                                       // mass ratio q = m2 / m1
+    double semiMajorAxis;                                                                                   // semi-major axis (AU)
+    double weight;                                                                                          // importance weight
+} ImportanceSampleT;
+
+
+class ImportanceSampler {
+
+private:
+
+    static constexpr int IS_DIMENSIONS = 3;                                                                 // ln m1, q, ln a
+
+    typedef struct PowerLawSegment {
+        double lower;                                                                                       // lower edge (Msol)
+        double upper;                                                                                       // upper edge (Msol)
+        double power;                                                                                       // power law index
+        double coefficient;                                                                                 // coefficient (for continuity at the breaks)
+    } PowerLawSegmentT;
+
+    typedef std::array<double, IS_DIMENSIONS> LocationT;                                                    // location in the sampled dimensions
+
+    typedef struct Component {
+        LocationT mean;                                                                                     // location of the hit
+        double    logNormalisation;                                                                         // ln of the probability mass of the gaussian inside the prior bounds
+    } ComponentT;
+
+    ImportanceSampler() { m_Enabled = false; };
+    ImportanceSampler(ImportanceSampler const&) = delete;
+    ImportanceSampler& operator = (ImportanceSampler const&) = delete;
+
+    static ImportanceSampler*     m_Instance;
+
+    bool                          m_Enabled;                                                                // true if importance sampling is enabled
+
+    unsigned long int             m_BatchSize;                                                              // binaries evolved between refits of the proposal
+    double                        m_ExplorationFraction;                                                    // fraction of binaries drawn from the prior once the proposal is fitted
+
+    LocationT                     m_Lower;                                                                  // prior bounds in the sampled dimensions
+    LocationT                     m_Upper;
+    LocationT                     m_PriorScale;                                                             // prior spread in the sampled dimensions
+
+    std::vector<PowerLawSegmentT> m_IMFSegments;                                                            // initial mass function, clipped to the mass bounds
+    double                        m_IMFNormalisation;                                                       // integral of m_IMFSegments
+    double                        m_LogPriorDensityQA;                                                      // ln of the (constant) density in q and ln a
+
+    std::vector<ComponentT>       m_Components;                                                             // current proposal mixture - empty until the first hits are found
+    LocationT                     m_Sigma;                                                                  // gaussian widths of the current proposal
+    double                        m_LogGaussianNormalisation;                                               // ln of the normalisation of the (untruncated) gaussians
+
+    std::vector<LocationT>        m_Hits;                                                                   // locations of the hits found so far
+    double                        m_HitWeight;                                                              // sum of the weights of the hits
+    double                        m_TotalWeight;                                                            // sum of the weights of all binaries recorded
+    unsigned long int             m_BinariesRecorded;                                                       // number of binaries recorded
+
+    static LocationT              Location(const ImportanceSampleT& p_Sample);
+
+    double                        LogPriorDensity(const LocationT& p_X) const;
+    double                        LogMixtureDensity(const LocationT& p_X) const;
+
+    void                          Refit();
+
+public:
+
+    static ImportanceSampler* Instance();
+
+    bool              Enabled() const                                                                       { return m_Enabled; }
+
+    unsigned long int Hits() const                                                                          { return m_Hits.size(); }
+    double            HitFraction() const                                                                   { return m_TotalWeight > 0.0 ? m_HitWeight / m_TotalWeight : 0.0; }
+
+    void              Start();
+
+    ImportanceSampleT Sample();
+    void              Record(const ImportanceSampleT& p_Sample, const bool p_Hit);
+};
+
+
+#endif // __ImportanceSampler_h__
@@ -19,6 +19,39 @@ Log* Log::Instance() {
 }
 
 
+/*
+ * Create the HDF5 container file (if logging to HDF5 files)
+ *
+ * The container is created on demand - when the first HDF5 logfile is opened, or when the
+ * run details are written in Log::Stop() - rather than in Log::Start().  Does nothing if
+ * the container is open; reopens it if it has been created and since closed (the standard
+ * logfiles, and with them the container, are closed before Log::Stop() is called).
+ *
+ *
+ * bool Log::OpenHDF5Container()
+ *
+ * @return                                      Boolean status - true = container open; false = create failed
+ */
+bool Log::OpenHDF5Container() {
+
+    if (m_HDF5ContainerId >= 0) return true;                                                                            // already open
+
+    string fileExt    = "." + LOGFILETYPEFileExt.at(OPTIONS->LogfileType());                                            // file extension for HDF5 files
+    string h5Filename = m_LogBasePath + "/" + m_LogContainerName + "/" + m_HDF5ContainerName + fileExt;                 // full filename with path, container, and extension ("/" works on Uni*x and Windows)
+
+    m_HDF5ContainerId = m_HDF5ContainerCreated                                                                          // container already created (and since closed)?
+                        ? H5Fopen(h5Filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT)                                        // yes - reopen it
+                        : H5Fcreate(h5Filename.c_str(), H5F_ACC_EXCL, H5P_DEFAULT, H5P_DEFAULT);                        // no - create it
+    if (m_HDF5ContainerId < 0) {                                                                                        // created ok?
+        Squawk("ERROR: Unable to create HDF5 container file with file name " + h5Filename);                             // no - announce error
+        return false;
+    }
+
+    m_HDF5ContainerCreated = true;
+    return true;
+}
+
+
 /*
  * Open the run details file inside the HDF5 container (if logging to HDF5 files)
  * 
@@ -274,9 +307,13 @@ void Log::Start(const string              p_LogBasePath,
         m_LogClasses    = p_LogClasses;                                                                                     // set enabled log classes
         m_DbgLevel      = p_DbgLevel;                                                                                       // set debug level
         m_DbgClasses    = p_DbgClasses;                                                                                     // set enagled debug classes
+        m_ClassBits.clear();                                                                                                // clear class registry
+        m_LogClassMask  = RegisterClasses(m_LogClasses);                                                                    // enabled log classes as bitmask
+        m_DbgClassMask  = RegisterClasses(m_DbgClasses);                                                                    // enabled debug classes as bitmask
         m_DbgToLogfile  = p_DbgToLogfile;                                                                                   // write debug records to logfile?
         m_ErrToLogfile  = p_ErrorsToLogfile;                                                                                // write error records to logfile?
         m_LogfileType   = p_LogfileType;                                                                                    // set log file type
+        m_LogfileFlush  = OPTIONS->LogfileFlush();                                                                          // set CSV, TSV, TXT log file flush policy
 
         m_Logfiles.clear();                                                                                                 // clear all entries
 
@@ -306,6 +343,13 @@ void Log::Start(const string              p_LogBasePath,
         // process the logfile definitions file if specified
         m_Enabled = UpdateAllLogfileRecordSpecs();                                                                          // update all logfile record specifications - disable logging upon failure
 
+        if (OPTIONS->ImportanceSampling() &&                                                                                // importance sampling, and
+            std::find(m_BSE_SysParms_Rec.begin(), m_BSE_SysParms_Rec.end(), T_ANY_PROPERTY(BINARY_PROPERTY::IMPORTANCE_WEIGHT)) == m_BSE_SysParms_Rec.end()) { // importance weight not already in BSE_SYSTEM_PARAMETERS?
+            m_BSE_SysParms_Rec.push_back(BINARY_PROPERTY::IMPORTANCE_WEIGHT);                                               // add it - the system parameters are meaningless without their weights
+        }
+
+        UpdateLoggedProperties();                                                                                           // record which properties the active logfiles write
+
         if (m_Enabled) {                                                                                                    // still ok?
                                                                                                                             // yes
             // first create the container folder at p_LogBasePath
@@ -370,47 +414,28 @@ void Log::Start(const string              p_LogBasePath,
             // containing folder now exists
             // now create the run details file
 
-            // if we're logging to HDF5 files We put a copy of the run details file in the HDF5 container file,
-            // so if we are in fact logging to HDF5 files, we need to create the HDF5 container file here.
-
-            if (m_LogfileType == LOGFILETYPE::HDF5) {                                                                       // logging to HDF5 files?
-                                                                                                                            // yes
-                string fileExt = "." + LOGFILETYPEFileExt.at(OPTIONS->LogfileType());                                       // file extension for HDF5 files
-                string h5Filename = m_LogBasePath + "/" + m_LogContainerName + "/" + m_HDF5ContainerName + fileExt;         // full filename with path, container, and extension ("/" works on Uni*x and Windows)
-                m_HDF5ContainerId = H5Fcreate(h5Filename.c_str(), H5F_ACC_EXCL, H5P_DEFAULT, H5P_DEFAULT);                  // create HDF5 container file
-                if (m_HDF5ContainerId < 0) {                                                                                // created ok?                        
-                    Squawk("ERROR: Unable to create HDF5 container file with file name " + h5Filename);                     // no - announce error
-                    Squawk("Logging disabled");                                                                             // show disabled warning
-                    m_Enabled = false;                                                                                      // disable logging
-                }
-                else {                                                                                                      // HDF5 container file now exists and open
-                    m_Enabled = OpenHDF5RunDetailsFile(RUN_DETAILS_FILE_NAME);                                              // open HDF5 run details file inside HDF5 container
-                    if (!m_Enabled) Squawk("Logging disabled");                                                             // show disabled warning
-                }
-            }
-
-            // If logging is still enabled then if we are logging to HDF5 files we
-            // have an open HDF5 container with an open group for the run details file
+            // If we're logging to HDF5 files we put a copy of the run details file in the HDF5 container
+            // file - but the container is not created here.  Creating the run details group, with its
+            // several hundred datasets, is a significant fraction of the startup cost of short runs, and
+            // there is no need to pay it before the first star/binary is evolved: the container is created
+            // when the first HDF5 logfile is opened (see Log::OpenHDF5Container()), and the run details
+            // group is created in Log::Stop(), where it is populated.
             //
-            // We still need to create the run details text file
-            // We only create the file here - the run details file is populated in Log::Stop()
+            // We only create the run details text file here - it is populated in Log::Stop()
 
-            if (m_Enabled) {                                                                                                // still ok?
-                                                                                                                            // yes
-                string filename = m_LogBasePath + "/" + m_LogContainerName + "/" + RUN_DETAILS_FILE_NAME;                   // run details (text) filename with container name
-                try {
-                    m_RunDetailsFile.open(filename, std::ios::out);                                                         // create run details (text) file
-                    m_RunDetailsFile.exceptions(std::ofstream::failbit | std::ofstream::badbit);                            // enable exceptions on run details file
-                }
-                catch (const std::ofstream::failure &e) {                                                                   // fs problem...
-                    Squawk("ERROR: Unable to create run details file with file name " + filename);                          // announce error
-                    Squawk(e.what());                                                                                       // plus details
-                    m_Enabled = false;                                                                                      // fail
-                }
-                catch (...) {                                                                                               // unhandled problem...
-                    Squawk("ERROR: Unable to create log file with file name " + filename);                                  // announce error
-                    m_Enabled = false;                                                                                      // fail
-                }
+            string filename = m_LogBasePath + "/" + m_LogContainerName + "/" + RUN_DETAILS_FILE_NAME;                       // run details (text) filename with container name
+            try {
+                m_RunDetailsFile.open(filename, std::ios::out);                                                             // create run details (text) file
+                m_RunDetailsFile.exceptions(std::ofstream::failbit | std::ofstream::badbit);                                // enable exceptions on run details file
+            }
+            catch (const std::ofstream::failure &e) {                                                                       // fs problem...
+                Squawk("ERROR: Unable to create run details file with file name " + filename);                              // announce error
+                Squawk(e.what());                                                                                           // plus details
+                m_Enabled = false;                                                                                          // fail
+            }
+            catch (...) {                                                                                                   // unhandled problem...
+                Squawk("ERROR: Unable to create log file with file name " + filename);                                      // announce error
+                m_Enabled = false;                                                                                          // fail
             }
 
             // store input files if required
@@ -496,7 +521,8 @@ void Log::Stop(std::tuple<int, int> p_ObjectStats) {
 
         if (m_LogfileType == LOGFILETYPE::HDF5) {                                                                                       // logging to HDF5 files?
               
-            bool ok = true;                                                                                                             // status
+            bool ok = OpenHDF5Container() && OpenHDF5RunDetailsFile(RUN_DETAILS_FILE_NAME);                                             // create the run details file inside the HDF5 container
+            if (!ok) Squawk("ERROR: Unable to create HDF5 run details file");                                                           // announce error
                                                                                                                                         // yes - write run details data to HDF5 output file
             // update run HDF5 details file
             
@@ -730,6 +756,8 @@ void Log::Stop(std::tuple<int, int> p_ObjectStats) {
 
         // close standard log files
 
+        if (!m_BSEDetailedTimeline.Close()) Squawk("ERROR: Unable to close compact detailed output file");                            // flush and close compact detailed output file (if open)
+
         CloseAllStandardFiles();                                                                                                        // close all standard log files
         for(unsigned int index = 0; index < m_Logfiles.size(); index++) {                                                               // check for open logfiles (even if not active)
             if (IsActiveId(index)) {                                                                                                    // logfile active?
@@ -812,6 +840,8 @@ int Log::Open(const string p_LogFileName, const bool p_Append, const bool p_Time
                 h5GroupId = h5FileId;                                                                               // no group for detailed file - just use the file id
             }
             else {                                                                                                  // no, not detailed ouput file
+                (void)OpenHDF5Container();                                                                          // create the HDF5 container if this is the first HDF5 logfile
+
                 h5FileId    = m_HDF5ContainerId;                                                                    // container file id
                 h5GroupName = m_LogNamePrefix + p_LogFileName;                                                      // HDF5 file group name
 
@@ -894,6 +924,12 @@ int Log::Open(const string p_LogFileName, const bool p_Append, const bool p_Time
             }
                
             try {
+                // records are written through a large IO buffer, so that (unless --logfile-flush RECORD is specified)
+                // writes to the file system are made when the buffer fills, rather than for every record.  The buffer
+                // must be set before the file is opened, and is kept (and reused) when the entry is cleared
+                if (m_Logfiles[id].buffer.empty()) m_Logfiles[id].buffer.resize(TEXT_LOGFILE_BUFFER_SIZE);           // allocate IO buffer if necessary
+                m_Logfiles[id].file.rdbuf()->pubsetbuf(m_Logfiles[id].buffer.data(), m_Logfiles[id].buffer.size()); // set IO buffer
+
                 m_Logfiles[id].file.open(filename, std::ios::out | std::ios::app);                                  // create fs log file
                 m_Logfiles[id].file.exceptions(std::ofstream::failbit | std::ofstream::badbit);                     // enable exceptions on log file
 
@@ -1042,34 +1078,55 @@ void Log::Squawk(const string p_SquawkStr) {
 
 
 /*
- * Determine whether record should be logged/debug string should be written based on log/debug classes and log/debug level.
+ * Return the class bitmask for the log/debug class specified
+ *
+ * Class names are case-insensitive, so the class registry is keyed on the lowercase class name.  Classes not enabled for logging or debugging
+ * are not in the registry, and return 0.
  *
  *
- * bool DoIt(const string p_Class, const int p_Level, const std::vector<string> p_EnabledClasses, const int p_EnabledLevel)
+ * LOG_CLASS_MASK ClassMask(const string& p_Class)
  *
- * @param   [IN]    p_Class                     The class (logging or debug) of the record being evaluated
- * @param   [IN]    p_Level                     The level (logging or debug) of the record being evaluated
- * @param   [IN]    p_EnabledClasses            List of classes enabled for logging or debugging (vector<string>)
- * @param   [IN]    p_EnabledLevel              The application logging or debug level
- * @return                                      Boolean indicating whether record should be logged/debug string should be written
+ * @param   [IN]    p_Class                     The class (logging or debug) for which the mask is required
+ * @return                                      Bitmask for class (0 if class not registered)
  */
-bool Log::DoIt(const string p_Class, const int p_Level, const std::vector<string> p_EnabledClasses, const int p_EnabledLevel) {
-    
-    bool doIt = (p_Level <= p_EnabledLevel);                                                                    // first check level
-
-    if (doIt) {                                                                                                 // now check class
-        if (!(p_Class.empty() || p_EnabledClasses.empty())) {                                                   // log class restricted?
-            doIt = false;                                                                                       // until we know better...
-            for (auto iter = p_EnabledClasses.begin(); iter != p_EnabledClasses.end(); ++iter) {                // check enabled classes
-                if (utils::Equals(p_Class, *iter)) {                                                            // matches an enabled class?
-                    doIt = true;                                                                                // yes, and...
-                    break;                                                                                      // we're done
-                }
+LOG_CLASS_MASK Log::ClassMask(const string& p_Class) const {
+    auto iter = m_ClassBits.find(utils::ToLower(p_Class));
+    return iter == m_ClassBits.end() ? 0 : (LOG_CLASS_MASK(1) << iter->second);
+}
+
+
+/*
+ * Register log/debug classes and return the bitmask of the classes registered
+ *
+ * Log and debug classes share the registry, so a class enabled for both logging and debugging
+ * has the same bit in both masks.  An empty class list means "no class restriction", and returns
+ * a mask of 0.  The mask can only hold 64 classes - classes beyond that are ignored (with a warning).
+ *
+ *
+ * LOG_CLASS_MASK RegisterClasses(const std::vector<string>& p_Classes)
+ *
+ * @param   [IN]    p_Classes                   Classes enabled for logging or debugging
+ * @return                                      Bitmask of the classes enabled
+ */
+LOG_CLASS_MASK Log::RegisterClasses(const std::vector<string>& p_Classes) {
+
+    LOG_CLASS_MASK mask = 0;
+
+    for (auto& thisClass: p_Classes) {
+        string key = utils::ToLower(thisClass);
+        auto iter  = m_ClassBits.find(key);
+        if (iter == m_ClassBits.end()) {                                                                        // new class?
+            int bit = static_cast<int>(m_ClassBits.size());                                                     // yes - next bit
+            if (bit >= static_cast<int>(sizeof(LOG_CLASS_MASK) * 8)) {                                          // out of bits?
+                Squawk("WARNING: Too many log/debug classes - ignoring class " + thisClass);                    // yes - show warning
+                continue;                                                                                       // next class
             }
+            iter = m_ClassBits.insert({key, bit}).first;                                                        // register class
         }
+        mask |= LOG_CLASS_MASK(1) << iter->second;                                                              // add to mask
     }
 
-    return doIt;
+    return mask;
 }
 
 
@@ -1087,7 +1144,7 @@ bool Log::DoIt(const string p_Class, const int p_Level, const std::vector<string
  */
 void Log::Say(const string p_SayClass, const int p_SayLevel, const string p_SayStr) {
     if (m_Enabled) {                                                                                                // logging service enabled?
-        if (DoIt(p_SayClass, p_SayLevel, m_LogClasses, m_LogLevel)) {                                               // logging this class and level?
+        if (DoIt(p_SayClass, p_SayLevel, m_LogClassMask, m_LogLevel)) {                                             // logging this class and level?
             Say_(p_SayStr);                                                                                         // say it
         }
     }
@@ -1129,7 +1186,7 @@ bool Log::Write(const int p_LogfileId, const string p_LogClass, const int p_LogL
     bool result = false;
 
     if (m_Enabled && IsActiveId(p_LogfileId)) {                                                                     // logging service enabled and specified log file active?
-        if (DoIt(p_LogClass, p_LogLevel, m_LogClasses, m_LogLevel)) {                                               // yes - logging this class and level?
+        if (DoIt(p_LogClass, p_LogLevel, m_LogClassMask, m_LogLevel)) {                                             // yes - logging this class and level?
             result = Write_(p_LogfileId, p_LogStr);                                                                 // yes - log it
         }
         else result = true;                                                                                         // not logging this class and level - but ok
@@ -1169,7 +1226,7 @@ bool Log::Write(const int                               p_LogfileId,
     bool result = false;
 
     if (m_Enabled && IsActiveId(p_LogfileId)) {                                                                     // logging service enabled and specified log file active?
-        if (DoIt(p_LogClass, p_LogLevel, m_LogClasses, m_LogLevel)) {                                               // yes - logging this class and level?
+        if (DoIt(p_LogClass, p_LogLevel, m_LogClassMask, m_LogLevel)) {                                             // yes - logging this class and level?
             result = Write_(p_LogfileId, p_LogRecordValues, p_Flush);                                               // yes - log it
         }
         else result = true;                                                                                         // not logging this class and level - but ok
@@ -1183,23 +1240,26 @@ bool Log::Write(const int                               p_LogfileId,
  * Write a string record to specified log file with no class or level check - internal use only
  * Used for CSV, TSV, and TXT files
  * 
+ * The record is written to the logfile's IO buffer, which is flushed after the record is written
+ * only if --logfile-flush RECORD was specified (see FlushTextFiles()).
+ *
  * Disable the specified log file if errors occur.
  *
  *
- * bool Write_(const id p_LogfileId, const string p_LogStr)
+ * bool Write_(const id p_LogfileId, const string& p_LogStr)
  *
  * @param   [IN]    p_LogfileId                 The id of the log file to which the log string should be written
  * @param   [IN]    p_LogStr                    The string to be written
  * @return                                      Boolean indicating whether record was written successfully
  */
-bool Log::Write_(const int p_LogfileId, const string p_LogStr) {
+bool Log::Write_(const int p_LogfileId, const string& p_LogStr) {
 
     bool result = false;
 
     if (m_Enabled && IsActiveId(p_LogfileId)) {                                                                     // logging service enabled and specified log file active?
         try {
-            m_Logfiles[p_LogfileId].file << p_LogStr << std::endl;                                                  // write string to log file
-            m_Logfiles[p_LogfileId].file.flush();                                                                   // flush data to log file
+            m_Logfiles[p_LogfileId].file.write(p_LogStr.data(), p_LogStr.size()).put('\n');                         // write string to log file
+            if (m_LogfileFlush == LOGFILE_FLUSH::RECORD) m_Logfiles[p_LogfileId].file.flush();                      // flush data to log file if required
 
             result = true;                                                                                          // set result
         }
@@ -1248,7 +1308,10 @@ bool Log::WriteHDF5_(h5AttrT& p_H5file, const string p_H5filename, const size_t
 
     hid_t   dSet            = p_H5file.dataSets[p_DataSetIdx].dataSetId;                                                    // dataset id
     hid_t   dType           = p_H5file.dataSets[p_DataSetIdx].h5DataType;                                                   // HDF5 datatype
-    hsize_t dSetCurrentSize = H5Dget_storage_size(dSet) / H5Tget_size(dType);                                               // current size (entries) of HDF5 dataset
+    hsize_t dSetCurrentSize = 0;                                                                                            // current size (entries) of HDF5 dataset
+    hid_t   h5CurrentSpace  = H5Dget_space(dSet);                                                                           // the dataset extent, not its storage size - compressed
+    (void)H5Sget_simple_extent_dims(h5CurrentSpace, &dSetCurrentSize, NULL);                                                // datasets (--hdf5-compression) store fewer bytes than
+    (void)H5Sclose(h5CurrentSpace);                                                                                         // entries * datatype size
     hsize_t h5Dims[1]       = {bufSize};                                                                                    // size of buffer to be written
     hid_t   h5Dspace        = H5Screate_simple(1, h5Dims, NULL);                                                            // create memory dataspace for write
     hid_t   h5FSpace;                                                                                                       // filespace for write - allocated later
@@ -1519,7 +1582,7 @@ bool Log::Write_(const int p_LogfileId, const std::vector<COMPAS_VARIABLE_TYPE>
  * Label is the logging/debug class associated with the log/debug string
  *
  *
- * bool Put(const id p_LogfileId, const string p_LogClass, const int p_LogLevel, const string p_LogStr)
+ * bool Put(const id p_LogfileId, const string& p_LogClass, const int p_LogLevel, const string& p_LogStr)
  *
  * @param   [IN]    p_LogfileId                 The id of the log file to which the log string should be written
  * @param   [IN]    p_LogClass                  Class to determine if string sould be written
@@ -1527,12 +1590,12 @@ bool Log::Write_(const int p_LogfileId, const std::vector<COMPAS_VARIABLE_TYPE>
  * @param   [IN]    p_LogStr                    The string to be written
  * @return                                      Boolean indicating whether record was written successfully
  */
-bool Log::Put(const int p_LogfileId, const string p_LogClass, const int p_LogLevel, const string p_LogStr) {
+bool Log::Put(const int p_LogfileId, const string& p_LogClass, const int p_LogLevel, const string& p_LogStr) {
 
     bool result = false;
 
     if (m_Enabled && IsActiveId(p_LogfileId)) {                                                                     // logging service enabled and specified log file active?
-        if (DoIt(p_LogClass, p_LogLevel, m_LogClasses, m_LogLevel)) {                                               // yes - logging this class and level?
+        if (DoIt(p_LogClass, p_LogLevel, m_LogClassMask, m_LogLevel)) {                                             // yes - logging this class and level?
             result = Put_(p_LogfileId, p_LogStr, p_LogClass);                                                       // yes - log it
         }
         else result = true;                                                                                         // not logging this class and level - but ok
@@ -1564,7 +1627,7 @@ bool Log::Put(const int p_LogfileId, const string p_LogClass, const int p_LogLev
     bool result = false;
 
     if (m_Enabled && IsActiveId(p_LogfileId)) {                                                                     // logging service enabled and specified log file active?
-        if (DoIt(p_LogClass, p_LogLevel, m_LogClasses, m_LogLevel)) {                                               // yes - logging this class and level?
+        if (DoIt(p_LogClass, p_LogLevel, m_LogClassMask, m_LogLevel)) {                                             // yes - logging this class and level?
             result = Put_(p_LogfileId, p_LogRecordValues);                                                          // yes - log it
         }
         else result = true;                                                                                         // not logging this class and level - but ok
@@ -1583,19 +1646,22 @@ bool Log::Put(const int p_LogfileId, const string p_LogClass, const int p_LogLev
  * Disable the specified log file if errors occur.
  *
  *
- * bool Put_(const int p_LogfileId, const string p_LogStr, const string p_Label)
+ * bool Put_(const int p_LogfileId, const string& p_LogStr, const string& p_Label)
  *
  * @param   [IN]    p_LogfileId                 The id of the log file to which the log string should be written
  * @param   [IN]    p_LogStr                    The string to be written
  * @param   [IN]    p_Label                     The record label to be written (if required)
  * @return                                      Boolean indicating whether record was written successfully
  */
-bool Log::Put_(const int p_LogfileId, const string p_LogStr, const string p_Label) {
+bool Log::Put_(const int p_LogfileId, const string& p_LogStr, const string& p_Label) {
 
     bool result = false;
 
     if (m_Enabled && IsActiveId(p_LogfileId)) {                                                                     // logging service enabled and specified log file active?
 
+        bool addLabel = m_Logfiles[p_LogfileId].label && p_Label.length() > 0;                                      // add record label?
+        if (!m_Logfiles[p_LogfileId].timestamp && !addLabel) return Write_(p_LogfileId, p_LogStr);                 // no timestamp or label - log the string as is
+
         string delimiter = "";                                                                                      // field delimiter
         switch (m_Logfiles[p_LogfileId].filetype) {
             case LOGFILETYPE::HDF5: delimiter = ""; break;                                                          // HDF5
@@ -1621,7 +1687,7 @@ bool Log::Put_(const int p_LogfileId, const string p_LogStr, const string p_Labe
 
         string logStr = "";                                                                                         // initialise the output string
                logStr += m_Logfiles[p_LogfileId].timestamp ? timestamp + delimiter : "";                            // add timestamp if required
-               logStr += m_Logfiles[p_LogfileId].label && p_Label.length() > 0 ? p_Label + delimiter : "";          // add record label if required (may be blank)
+               logStr += addLabel ? p_Label + delimiter : "";                                                       // add record label if required
                logStr += p_LogStr;                                                                                  // add the log string
 
         return Write_(p_LogfileId, logStr);                                                                         // log it
@@ -1675,7 +1741,7 @@ bool Log::Debug(const string p_DbgClass, const int p_DbgLevel, const string p_Db
     bool result = false;
 
     if (m_Enabled) {                                                                                                // logging service enabled?
-        if (DoIt(p_DbgClass, p_DbgLevel, m_DbgClasses, m_DbgLevel)) {                                               // debugging this class and level?
+        if (DoIt(p_DbgClass, p_DbgLevel, m_DbgClassMask, m_DbgLevel)) {                                             // debugging this class and level?
             result = Debug_(p_DbgStr);                                                                              // debug it
         }
         else result = true;                                                                                         // not logging this class and level - but ok
@@ -1729,7 +1795,7 @@ bool Log::DebugWait(const string p_DbgClass, const int p_DbgLevel, const string
     bool result = false;
 
     if (m_Enabled) {                                                                                                // logging service enabled?
-        if (DoIt(p_DbgClass, p_DbgLevel, m_DbgClasses, m_DbgLevel)) {                                               // debugging this class and level?
+        if (DoIt(p_DbgClass, p_DbgLevel, m_DbgClassMask, m_DbgLevel)) {                                             // debugging this class and level?
             result = Debug_(p_DbgStr);                                                                              // debug it
             std::cout << "DEBUG: Press any key to continue...";                                                     // announce
             string tmp; std::cin >> tmp;                                                                            // and wait for input
@@ -2310,6 +2376,20 @@ hid_t Log::CreateHDF5Dataset(const string p_Filename, const hid_t p_GroupId, con
         Squawk("ERROR: Unable to set chunk size for HDF5 container file " + p_Filename);                            // no - announce error
     }
     else {                                                                                                          // yes - chunk size set ok
+
+        // set the compression filters, if required (--hdf5-compression, --hdf5-shuffle)
+        // HDF5 applies the filters to each chunk as it is written - COMPAS writes whole chunks (see
+        // "HDF5 File Support" in Log.h), so each chunk is compressed once.  Shuffle and deflate
+        // are built in to every HDF5 library, so the files remain readable by any HDF5 reader (h5py etc.).
+        // Variable-length strings are stored outside the chunks, so filtering them gains nothing
+        if (OPTIONS->HDF5Compression() == HDF5_COMPRESSION::DEFLATE && H5Tis_variable_str(p_H5DataType) <= 0) {
+            if (OPTIONS->HDF5Shuffle()) h5Result = H5Pset_shuffle(h5CPlist);                                        // shuffle first: groups the bytes of each significance together
+            if (h5Result >= 0) h5Result = H5Pset_deflate(h5CPlist, OPTIONS->HDF5CompressionLevel());                // then deflate
+            if (h5Result < 0) {                                                                                     // ok?
+                Squawk("ERROR: Unable to set compression filters for HDF5 container file " + p_Filename);          // no - announce error
+            }
+        }
+
         // create HDF5 dataset
         string h5DsetName = p_DatasetName;                                                                          // dataset name 
         h5DsetName        = utils::trim(h5DsetName);                                                                // remove leading and trailing blanks
@@ -2342,10 +2422,12 @@ hid_t Log::CreateHDF5Dataset(const string p_Filename, const hid_t p_GroupId, con
                 }
             }
             (void)H5Aclose(h5Attr);                                                                                 // close attribute 
+            (void)H5Tclose(h5DType);                                                                                // close attribute datatype
+            (void)H5Sclose(h5Dspace);                                                                               // close scalar dataspace
         }
     }
-    (void)H5Sclose(h5CPlist);                                                                                       // close creation property list
-    (void)H5Sclose(h5Dspace);                                                                                       // close scalar dataspace
+    (void)H5Pclose(h5CPlist);                                                                                       // close creation property list
+    (void)H5Sclose(h5Dspace);                                                                                       // close dataspace
 
     return h5Dset;                                                                                                  // return dataset id: < 0 = fail
 }
@@ -2373,6 +2455,10 @@ hid_t Log::CreateHDF5Dataset(const string p_Filename, const hid_t p_GroupId, con
  *
  * The logfile details are returned.
  *
+ * If the user has requested that only the population summary be written (--population-summary-only),
+ * the per-system BSE population logfiles (system parameters, double compact objects, common envelopes
+ * and supernovae) are never opened, and the default (not open) details are returned for those files.
+ *
  *
  * LogfileDetailsT StandardLogFileDetails(const LOGFILE p_Logfile, const string p_FileSuffix)
  *
@@ -2388,6 +2474,16 @@ LogfileDetailsT Log::StandardLogFileDetails(const LOGFILE p_Logfile, const strin
     LogfileDetailsT      fileDetails = retVal;                                                                                                  // logfile details
     LOGFILE_DESCRIPTOR_T fileDescriptor;                                                                                                        // logfile descriptor
 
+    if (OPTIONS->PopulationSummaryOnly()) {                                                                                                     // population summary only?
+        switch (p_Logfile) {                                                                                                                    // yes - which logfile?
+            case LOGFILE::BSE_COMMON_ENVELOPES:
+            case LOGFILE::BSE_DOUBLE_COMPACT_OBJECTS:
+            case LOGFILE::BSE_SUPERNOVAE:
+            case LOGFILE::BSE_SYSTEM_PARAMETERS: return retVal;                                                                                 // per-system population logfile - not written
+            default: break;                                                                                                                     // others written as usual
+        }
+    }
+
     COMPASUnorderedMap<LOGFILE, LogfileDetailsT>::const_iterator logfile;                                                                       // iterator
     logfile = m_OpenStandardLogFileIds.find(p_Logfile);                                                                                         // look for open logfile
     if (logfile == m_OpenStandardLogFileIds.end()) {                                                                                            // doesn't exist
@@ -2882,6 +2978,98 @@ LogfileDetailsT Log::StandardLogFileDetails(const LOGFILE p_Logfile, const strin
 }
 
 
+/*
+ * Create the compact BSE detailed output file (--detailed-output-compact)
+ *
+ * The compact detailed output file is a single file (for all binaries) in the detailed output
+ * directory, named for the BSE detailed output logfile with the extension DETAILED_OUTPUT_COMPACT_FILE_EXT.
+ * The columns are the same as the columns of the standard BSE detailed output file (including
+ * annotations, and the record type column) - see Log::StandardLogFileDetails().
+ *
+ * If the file cannot be created a warning is shown and compact detailed output is disabled for
+ * the remainder of the run.
+ *
+ *
+ * bool OpenBSEDetailedTimeline()
+ *
+ * @return                                      Boolean status (true = success, false = failure)
+ */
+bool Log::OpenBSEDetailedTimeline() {
+
+    if (m_BSEDetailedTimelineDisabled || !m_Enabled) return false;                                                         // previously failed, or logging not enabled
+
+    // column specifications
+    std::vector<TimelineColumnT> columns;
+    for (auto &property : m_BSE_Detailed_Rec) {                                                                             // for each property to be included in the record
+
+        PROPERTY_DETAILS details;
+        string suffix = "";
+
+        switch (boost::apply_visitor(VariantPropertyType(), property)) {                                                    // which property type?
+            case ANY_PROPERTY_TYPE::T_STAR_PROPERTY     : details = StellarPropertyDetails(static_cast<ANY_STAR_PROPERTY>(boost::get<STAR_PROPERTY>(property)));                     break;
+            case ANY_PROPERTY_TYPE::T_STAR_1_PROPERTY   : details = StellarPropertyDetails(static_cast<ANY_STAR_PROPERTY>(boost::get<STAR_1_PROPERTY>(property)));    suffix = "(1)";  break;
+            case ANY_PROPERTY_TYPE::T_STAR_2_PROPERTY   : details = StellarPropertyDetails(static_cast<ANY_STAR_PROPERTY>(boost::get<STAR_2_PROPERTY>(property)));    suffix = "(2)";  break;
+            case ANY_PROPERTY_TYPE::T_SUPERNOVA_PROPERTY: details = StellarPropertyDetails(static_cast<ANY_STAR_PROPERTY>(boost::get<SUPERNOVA_PROPERTY>(property))); suffix = "(SN)"; break;
+            case ANY_PROPERTY_TYPE::T_COMPANION_PROPERTY: details = StellarPropertyDetails(static_cast<ANY_STAR_PROPERTY>(boost::get<COMPANION_PROPERTY>(property))); suffix = "(CP)"; break;
+            case ANY_PROPERTY_TYPE::T_BINARY_PROPERTY   : details = BinaryPropertyDetails(boost::get<BINARY_PROPERTY>(property));                                                    break;
+
+            case ANY_PROPERTY_TYPE::T_PROGRAM_OPTION: {
+                PROGRAM_OPTION programOption = boost::get<PROGRAM_OPTION>(property);
+                if (programOption == PROGRAM_OPTION::NOTES) {                                                               // PROGRAM_OPTION::NOTES - one column per annotation included
+                    for (size_t idx = 0; idx < m_BSE_Detailed_Notes.size(); idx++) {
+                        if (m_BSE_Detailed_Notes[idx]) {
+                            details = ProgramOptionDetails(programOption, idx);
+                            columns.push_back({ std::get<0>(details), std::get<1>(details), std::get<2>(details) });
+                        }
+                    }
+                    continue;                                                                                               // already added
+                }
+                details = ProgramOptionDetails(programOption);
+                } break;
+
+            default:                                                                                                        // unknown property type
+                Squawk(ERR_MSG(ERROR::UNKNOWN_PROPERTY_TYPE));                                                              // show warning
+                m_BSEDetailedTimelineDisabled = true;
+                return false;
+        }
+        columns.push_back({ std::get<0>(details), std::get<1>(details) + suffix, std::get<2>(details) });
+    }
+    columns.push_back({ TYPENAME::UINT, "Record_Type", "-" });                                                              // record type column - always present
+
+    // create the detailed output directory if necessary
+    string detailedDirName = m_LogBasePath + "/" + m_LogContainerName + "/" + DETAILED_OUTPUT_DIRECTORY_NAME;               // directory name with path ("/" works on Uni*x and Windows)
+    if (!boost::filesystem::exists(detailedDirName)) {                                                                      // directory already exists?
+        boost::system::error_code err;                                                                                      // no - create it
+        boost::filesystem::create_directory(detailedDirName, err);
+        if (err.value() != 0) {                                                                                             // ok?
+            Squawk("ERROR: Unable to create detailed output directory " + detailedDirName);                                 // no - announce error
+            Squawk("Boost filesystem error = " + err.message());                                                            // plus details
+            Squawk("Detailed Output logging disabled");                                                                     // show disabled warning
+            m_BSEDetailedTimelineDisabled = true;
+            return false;
+        }
+    }
+
+    // create the file - add a version number if the file already exists
+    string basename = detailedDirName + "/" + m_LogNamePrefix + OPTIONS->LogfileDetailedOutput();                           // base filename with path
+    string fileExt  = "." + DETAILED_OUTPUT_COMPACT_FILE_EXT;
+    string filename = basename + fileExt;
+    int version = 0;
+    while (utils::FileExists(filename)) {                                                                                   // file already exists?
+        filename = basename + "_" + std::to_string(++version) + fileExt;                                                    // yes - add a version number and generate new filename
+    }
+
+    if (!m_BSEDetailedTimeline.Open(filename, columns)) {                                                                   // created ok?
+        Squawk(ERR_MSG(ERROR::FILE_OPEN_ERROR) + ": " + filename);                                                          // no - announce error
+        Squawk("Detailed Output logging disabled");                                                                         // show disabled warning
+        m_BSEDetailedTimelineDisabled = true;
+        return false;
+    }
+
+    return true;
+}
+
+
 /*
  * Close a (currently open) standard logfile
  *
@@ -2950,6 +3138,39 @@ bool Log::CloseAllStandardFiles() {
 }
 
 
+/*
+ * Flush all open CSV, TSV, and TXT logfiles if the flush policy (--logfile-flush) is p_Occasion
+ *
+ * Called (with LOGFILE_FLUSH::OBJECT) when the evolution of each star/binary is complete.
+ * Records are otherwise flushed after every record (LOGFILE_FLUSH::RECORD - see Write_()),
+ * or when the IO buffer is full and when the logfile is closed.
+ *
+ *
+ * bool FlushTextFiles(const LOGFILE_FLUSH p_Occasion)
+ *
+ * @param   [IN]    p_Occasion                  The occasion for the flush
+ * @return                                      Boolean indicating whether all logfiles were flushed successfully
+ */
+bool Log::FlushTextFiles(const LOGFILE_FLUSH p_Occasion) {
+
+    if (!m_Enabled || m_LogfileType == LOGFILETYPE::HDF5 || p_Occasion != m_LogfileFlush) return true;             // nothing to do
+
+    bool result = true;                                                                                             // default = success
+    for (auto& logfile: m_Logfiles) {                                                                               // for each logfile
+        if (logfile.active && logfile.file.is_open()) {                                                             // open?
+            try { logfile.file.flush(); }                                                                           // yes - flush it
+            catch (const std::ofstream::failure &e) {                                                               // problem...
+                Squawk("ERROR: Unable to flush log file with file name " + logfile.name);                           // announce error
+                Squawk(e.what());                                                                                   // plus details
+                result = false;                                                                                     // fail
+            }
+        }
+    }
+
+    return result;
+}
+
+
 /*
  * Prints text representation of the specification of a logfile record
  *
@@ -3788,3 +4009,52 @@ bool Log::UpdateAllLogfileRecordSpecs() {
 
 	return (error == ERROR::NONE);
 }
+
+
+/*
+ * Record which properties are written to the active BSE logfiles
+ *
+ * Some values are calculated during binary evolution only so that they can be written to
+ * logfiles (e.g. the total energy and angular momentum of the binary).  This function assembles
+ * the set of properties that appear in the record specifications of the BSE logfiles that can
+ * actually be written in this run, so that the calculation of values whose only consumer is a
+ * logfile that will not be written can be skipped (see PropertyLogged()).
+ *
+ * A BSE logfile is considered active if logging is enabled, the program options that control
+ * the logfile allow it to be written (e.g. --detailed-output, --rlof-printing, --population-summary-only),
+ * and at least one of its record types is enabled.  The options that enable the Be Binaries and
+ * Pulsar Evolution logfiles (--be-binaries, --evolve-pulsars) may be specified per grid line, or as
+ * ranges or sets, so the value of those options at startup says nothing about whether the logfiles
+ * will be written - those logfiles are considered active if any of their record types is enabled.
+ *
+ * Must be called after UpdateAllLogfileRecordSpecs(), so that the record specifications are final.
+ *
+ *
+ * void UpdateLoggedProperties()
+ */
+void Log::UpdateLoggedProperties() {
+
+    m_LoggedProperties.clear();
+
+    if (!m_Enabled || OPTIONS->EvolutionMode() != EVOLUTION_MODE::BSE) return;                                                  // nothing to do
+
+    bool perSystemFiles = !OPTIONS->PopulationSummaryOnly();                                                                    // per-system population logfiles written?
+
+    std::vector<std::tuple<bool, const ANY_PROPERTY_VECTOR*>> logfiles = {
+        std::make_tuple(                             OPTIONS->LogfileBeBinariesRecordTypes()           != 0, &m_BSE_BE_Binaries_Rec),
+        std::make_tuple(perSystemFiles            && OPTIONS->LogfileCommonEnvelopesRecordTypes()      != 0, &m_BSE_CEE_Rec),
+        std::make_tuple(perSystemFiles            && OPTIONS->LogfileDoubleCompactObjectsRecordTypes() != 0, &m_BSE_DCO_Rec),
+        std::make_tuple(OPTIONS->DetailedOutput() && OPTIONS->LogfileDetailedOutputRecordTypes()       != 0, &m_BSE_Detailed_Rec),
+        std::make_tuple(                             OPTIONS->LogfilePulsarEvolutionRecordTypes()      != 0, &m_BSE_Pulsars_Rec),
+        std::make_tuple(OPTIONS->RLOFPrinting()   && OPTIONS->LogfileRLOFParametersRecordTypes()       != 0, &m_BSE_RLOF_Rec),
+        std::make_tuple(perSystemFiles            && OPTIONS->LogfileSupernovaeRecordTypes()           != 0, &m_BSE_SNE_Rec),
+        std::make_tuple(OPTIONS->SwitchLog(),                                                                &m_BSE_Switch_Rec),
+        std::make_tuple(perSystemFiles            && OPTIONS->LogfileSystemParametersRecordTypes()     != 0, &m_BSE_SysParms_Rec)
+    };
+
+    for (auto &logfile : logfiles) {                                                                                            // for each BSE logfile
+        if (std::get<0>(logfile)) {                                                                                             // active?
+            for (auto &property : *std::get<1>(logfile)) m_LoggedProperties.insert(property);                                   // yes - record its properties
+        }
+    }
+}
@@ -4,10 +4,12 @@
 #define LOGGING Log::Instance()
 
 #include <fstream>
+#include <cstdint>
 #include <ctime>
 #include <chrono>
 #include <iostream>
 #include <iomanip>
+#include <set>
 
 #include <boost/filesystem.hpp>
 #include <boost/variant.hpp>
@@ -21,10 +23,13 @@
 #include "utils.h"
 
 #include "Options.h"
+#include "Timeline.h"
 #include "LogMacros.h"
 
 using std::string;
 
+typedef std::uint64_t LOG_CLASS_MASK;                                               // bitmask of log/debug classes - one bit per enabled class
+
 /*
  * Log Singleton
  *
@@ -206,6 +211,16 @@ using std::string;
  * Users should bear in mind that the combination of HDF5 chunk size and HDF5 IO buffer size affect performance,
  * storage space, and memory usage - so they may need to experiment to find a balance that suits their needs.
  * 
+ * HDF5 datasets are not compressed by default.  The program option --hdf5-compression DEFLATE enables the
+ * (built-in) deflate filter at the level given by --hdf5-compression-level (1 = fastest, the default, .. 9 =
+ * smallest), and --hdf5-shuffle adds the shuffle filter ahead of it - which typically improves compression of
+ * numeric columns considerably (the high-order bytes of neighbouring values are mostly equal).  Flags, stellar
+ * types, seeds etc. compress very well.  Compression is done by the HDF5 library as each chunk is written - since
+ * COMPAS writes only whole chunks (except at file close), each chunk is compressed exactly once, and the cost is
+ * small compared to the cost of evolving the systems that filled the chunk.  The unused part of the last chunk
+ * of each dataset (see above) holds fill values, which compress to almost nothing - so compression also recovers
+ * most of the space that large chunk sizes otherwise waste.
+ * 
  * 
  * String values stored in HDF5 files
  * ==================================
@@ -353,43 +368,61 @@ using std::string;
 
 
 /*
- * Format a boost::variant value using a format specification passed as a parameter
+ * Format a boost::variant value using a format specification passed as a parameter, and append it to a log record
  *
  * This is defined as a class for use with boost::apply_visitor().
  * It is only ever used by the Log class, hence the reason it is defined here.
  *
  * This function is applied to a boost::variant value via the boost::apply_visitor() function.
- * The function extracts the underlying primitive value stored in the boost::variant value and formats
- * it using the format string constructed here specifically for the underlying primitive type.
+ * The function extracts the underlying primitive value stored in the boost::variant value, formats
+ * it using the format string constructed here specifically for the underlying primitive type, and
+ * appends it to the log record passed to the constructor.
  *
+ * Values are formatted into a buffer on the stack and appended directly to the record, so there is
+ * no heap allocation per value (other than growing the record) - this is called for every value of
+ * every record written to CSV, TSV and TXT logfiles.
  */
-class FormatVariantValue: public boost::static_visitor<string> {
+class FormatVariantValue: public boost::static_visitor<> {
 public:
-    string operator()(const bool                   v, const string fmtStr) const {
+    explicit FormatVariantValue(string& p_Record) : m_Record(p_Record) { }
+
+    void operator()(const bool                   v, const string& fmtStr) const {
                                                       string fmt = OPTIONS->PrintBoolAsString() ? "%5s" : "%1s";
                                                       string vS  = OPTIONS->PrintBoolAsString() ? (v ? "TRUE " : "FALSE") : (v ? "1" : "0");
-                                                      return utils::vFormat(fmt.c_str(), vS.c_str());
+                                                      Append(fmt, vS.c_str());
                                                    }
-    string operator()(const int                    v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const short int              v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const long int               v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const long long int          v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const unsigned int           v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "u"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const unsigned short int     v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "u"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const unsigned long int      v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "u"; return utils::vFormat(fmt.c_str(), v); } // also handles OBJECT_ID (typedef)
-    string operator()(const unsigned long long int v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "u"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const float                  v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "e"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const double                 v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "e"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const long double            v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "e"; return utils::vFormat(fmt.c_str(), v); }
-    string operator()(const string                 v, const string fmtStr) const { string fmt = fmtStr; fmt = "%-" + fmt + "s"; return utils::vFormat(fmt.c_str(), v.c_str()); }
-    string operator()(const ERROR                  v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), static_cast<int>(v)); }
-    string operator()(const STELLAR_TYPE           v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), static_cast<int>(v)); }
-    string operator()(const MT_CASE                v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), static_cast<int>(v)); }
-    string operator()(const MT_TRACKING            v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), static_cast<int>(v)); }
-    string operator()(const SN_EVENT               v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), static_cast<int>(v)); }
-    string operator()(const SN_STATE               v, const string fmtStr) const { string fmt = fmtStr; fmt = "%"  + fmt + "d"; return utils::vFormat(fmt.c_str(), static_cast<int>(v)); }
-    string operator()(const std::vector<string>    v, const string fmtStr) const { string fmt = fmtStr; fmt = "%-" + fmt + "s"; return utils::vFormat(fmt.c_str(), v[0].c_str()); }
-    string operator()(const std::vector<string>    v, const string fmtStr, const size_t idx) const { string fmt = fmtStr; fmt = "%-" + fmt + "s"; return utils::vFormat(fmt.c_str(), v[idx].c_str()); }
+    void operator()(const int                    v, const string& fmtStr) const { Append("%"  + fmtStr + "d", v); }
+    void operator()(const short int              v, const string& fmtStr) const { Append("%"  + fmtStr + "d", v); }
+    void operator()(const long int               v, const string& fmtStr) const { Append("%"  + fmtStr + "d", v); }
+    void operator()(const long long int          v, const string& fmtStr) const { Append("%"  + fmtStr + "d", v); }
+    void operator()(const unsigned int           v, const string& fmtStr) const { Append("%"  + fmtStr + "u", v); }
+    void operator()(const unsigned short int     v, const string& fmtStr) const { Append("%"  + fmtStr + "u", v); }
+    void operator()(const unsigned long int      v, const string& fmtStr) const { Append("%"  + fmtStr + "u", v); } // also handles OBJECT_ID (typedef)
+    void operator()(const unsigned long long int v, const string& fmtStr) const { Append("%"  + fmtStr + "u", v); }
+    void operator()(const float                  v, const string& fmtStr) const { Append("%"  + fmtStr + "e", v); }
+    void operator()(const double                 v, const string& fmtStr) const { Append("%"  + fmtStr + "e", v); }
+    void operator()(const long double            v, const string& fmtStr) const { Append("%"  + fmtStr + "e", v); }
+    void operator()(const string&                v, const string& fmtStr) const { Append("%-" + fmtStr + "s", v.c_str()); }
+    void operator()(const ERROR                  v, const string& fmtStr) const { Append("%"  + fmtStr + "d", static_cast<int>(v)); }
+    void operator()(const STELLAR_TYPE           v, const string& fmtStr) const { Append("%"  + fmtStr + "d", static_cast<int>(v)); }
+    void operator()(const MT_CASE                v, const string& fmtStr) const { Append("%"  + fmtStr + "d", static_cast<int>(v)); }
+    void operator()(const MT_TRACKING            v, const string& fmtStr) const { Append("%"  + fmtStr + "d", static_cast<int>(v)); }
+    void operator()(const SN_EVENT               v, const string& fmtStr) const { Append("%"  + fmtStr + "d", static_cast<int>(v)); }
+    void operator()(const SN_STATE               v, const string& fmtStr) const { Append("%"  + fmtStr + "d", static_cast<int>(v)); }
+    void operator()(const std::vector<string>&   v, const string& fmtStr) const { Append("%-" + fmtStr + "s", v[0].c_str()); }
+    void operator()(const std::vector<string>&   v, const string& fmtStr, const size_t idx) const { Append("%-" + fmtStr + "s", v[idx].c_str()); }
+
+private:
+    string& m_Record;                                                                                   // the log record being constructed
+
+    template <typename T>
+    void Append(const string& p_Fmt, const T p_Value) const {                                           // format strings are short enough not to need the heap
+        char buf[128];
+        int  len = std::snprintf(buf, sizeof(buf), p_Fmt.c_str(), p_Value);
+        if (len < 0) return;                                                                            // formatting failed - append nothing (as utils::vFormat())
+        if (len < static_cast<int>(sizeof(buf))) m_Record.append(buf, len);                             // formatted value fits in the buffer
+        else                                     m_Record += utils::vFormat(p_Fmt.c_str(), p_Value);    // long (string) value
+    }
 };
 
 
@@ -441,17 +474,23 @@ private:
     Log() {                                                                         // constructor - initialise variables
         m_Enabled = false;                                                          // logging disabled initially
         m_HDF5ContainerId = -1;                                                     // no HDF5 container file open initially
+        m_HDF5ContainerCreated = false;                                             // HDF5 container file not created initially
+        m_LogfileFlush = LOGFILE_FLUSH::RECORD;                                     // flush CSV, TSV, TXT logfiles after every record until the logging service is started
         m_Run_Details_H5_File.fileId = -1;                                          // no HDF5 file id for run details file initially
         m_Run_Details_H5_File.groupId = -1;                                         // no HDF5 group id for run details file initially
         m_HDF5DetailedId = -1;                                                      // no HDF5 detailed file open initially
+        m_BSEDetailedTimelineDisabled = false;                                      // compact detailed output not disabled initially
         m_LogBasePath = ".";                                                        // default log file base path
         m_LogContainerName = DEFAULT_OUTPUT_CONTAINER_NAME;                         // default log file container name                        
         m_LogNamePrefix = "";                                                       // default log file name prefix
         m_LogfileType = DEFAULT_LOGFILE_TYPE;                                       // default log file type
         m_LogLevel = 0;                                                             // default log level - log everything
         m_LogClasses = {};                                                          // no default log classes
+        m_LogClassMask = 0;                                                         // no log class restriction
         m_DbgLevel = 0;                                                             // default debug level - debug everything
         m_DbgClasses = {};                                                          // no default debug classes
+        m_DbgClassMask = 0;                                                         // no debug class restriction
+        m_ClassBits = {};                                                           // no classes registered
         m_DbgToLogfile = false;                                                     // default is not to log debug records to the log file
         m_DbgLogfileId = -1;                                                        // default is not valid
         m_Logfiles.empty();                                                         // default is no log files
@@ -483,18 +522,29 @@ private:
 
     string                      m_HDF5ContainerName;                                // HDF5 container name
     hid_t                       m_HDF5ContainerId;                                  // HDF5 container id
+    bool                        m_HDF5ContainerCreated;                             // has the HDF5 container file been created? (it may since have been closed)
     hid_t                       m_HDF5DetailedId;                                   // HDF5 detailed output id
 
+    Timeline                    m_BSEDetailedTimeline;                              // compact BSE detailed output (--detailed-output-compact)
+    bool                        m_BSEDetailedTimelineDisabled;                      // compact BSE detailed output disabled (file could not be created)
+
+    std::set<T_ANY_PROPERTY>    m_LoggedProperties;                                 // properties written to the active BSE logfiles (see UpdateLoggedProperties())
+
     string                      m_LogBasePath;                                      // base path for log files
     string                      m_LogContainerName;                                 // container (directory) name for log files
     string                      m_LogNamePrefix;                                    // prefix for log files
 
     LOGFILETYPE                 m_LogfileType;                                      // logfile type
+    LOGFILE_FLUSH               m_LogfileFlush;                                     // when to flush CSV, TSV, TXT logfiles
     int                         m_LogLevel;                                         // log level
     std::vector <string>        m_LogClasses;                                       // log classes
+    LOG_CLASS_MASK              m_LogClassMask;                                     // log classes as bitmask (0 = no restriction)
 
     int                         m_DbgLevel;                                         // debug level
     std::vector <string>        m_DbgClasses;                                       // debug classes
+    LOG_CLASS_MASK              m_DbgClassMask;                                     // debug classes as bitmask (0 = no restriction)
+
+    std::map<string, int>       m_ClassBits;                                        // bit positions of enabled log/debug classes (keys lowercase)
 
     bool                        m_DbgToLogfile;                                     // log debug records to log file?
     int                         m_DbgLogfileId;                                     // log file id of file to which debug statements should be written
@@ -531,7 +581,8 @@ private:
         bool        timestamp;                                                      // time stamp enabled?
         bool        label;                                                          // record labels enabled?
 
-        std::ofstream file;                                                         // file pointer for CSV, TSV, TXT files
+        std::ofstream     file;                                                     // file pointer for CSV, TSV, TXT files
+        std::vector<char> buffer;                                                   // IO buffer for CSV, TSV, TXT files (kept when the entry is reused)
 
         h5AttrT h5File;                                                             // file details for HDF5 files
     };
@@ -646,13 +697,24 @@ private:
         }
     }
 
-    bool DoIt(const string p_Class, const int p_Level, const std::vector<string> p_EnabledClasses, const int p_EnabledLevel);
+    LOG_CLASS_MASK ClassMask(const string& p_Class) const;
+    LOG_CLASS_MASK RegisterClasses(const std::vector<string>& p_Classes);
+
+    // DoIt() is called for every SAY/LOG/DBG statement, so it is inlined here and checks the level first
+    // (cheapest, and the most common reason to not do it) - the class check is only required if the
+    // statement has a class and classes are restricted
+    bool DoIt(const string& p_Class, const int p_Level, const LOG_CLASS_MASK p_EnabledClasses, const int p_EnabledLevel) const {
+        if (p_Level > p_EnabledLevel) return false;                                 // level not enabled
+        if (p_EnabledClasses == 0 || p_Class.empty()) return true;                  // class not restricted
+        return (ClassMask(p_Class) & p_EnabledClasses) != 0;                        // class enabled?
+    }
+
     void Say_(const string p_SayStr);
-    bool Write_(const int p_LogfileId, const string p_LogStr);
+    bool Write_(const int p_LogfileId, const string& p_LogStr);
     bool Write_(const int p_LogfileId, const std::vector<COMPAS_VARIABLE_TYPE> p_LogRecordValues, const bool p_Flush = false);
     bool WriteHDF5_(h5AttrT& p_H5file, const string p_H5filename, const size_t p_DataSetIdx);
     bool Flush_(const int p_LogfileId) { return Write_(p_LogfileId, {}, true); }
-    bool Put_(const int p_LogfileId, const string p_LogStr, const string p_Label = "");
+    bool Put_(const int p_LogfileId, const string& p_LogStr, const string& p_Label = "");
     bool Put_(const int p_LogfileId, const std::vector<COMPAS_VARIABLE_TYPE> p_LogRecordValues);
     bool Debug_(const string p_DbgStr);
     bool Close_(const int p_LogfileId);
@@ -663,9 +725,12 @@ private:
     STR_STR_STR_STR  FormatFieldHeaders(const PROPERTY_DETAILS p_Details, string p_HeaderSuffix = "");
     LogfileDetailsT  StandardLogFileDetails(const LOGFILE p_Logfile, const string p_FileSuffix = "");
 
+    bool OpenBSEDetailedTimeline();
+
     std::tuple<bool, LOGFILE> GetLogfileDescriptorKey(const string p_Value);
     std::tuple<bool, LOGFILE> GetStandardLogfileKey(const int p_FileId);
 
+    bool  OpenHDF5Container();
     bool  OpenHDF5RunDetailsFile(const string p_Filename = RUN_DETAILS_FILE_NAME);
     hid_t CreateHDF5Dataset(const string p_Filename, const hid_t p_GroupId, const string p_DatasetName, const hid_t p_H5DataType, const string p_UnitsStr, const size_t p_HDF5ChunkSize);
     hid_t GetHDF5DataType(const TYPENAME p_COMPASdatatype, const int p_FieldWidth, const STRING_QUALIFIER p_StringQualifier = STRING_QUALIFIER::FIXED_LENGTH);
@@ -750,7 +815,8 @@ private:
         //    - format for printing for CSV, TSV and TXT files
         //    - record for HDF5 files
         COMPAS_VARIABLE_TYPE value;                                                                                             // property value
-        string               valueStr;                                                                                          // string for formatted value
+
+        if (!hdf5) logRecord.reserve(p_RecordProperties.size() * 32);                                                           // room for typical formatted values, so the record doesn't need to grow
 
         int index = 0;
         for (auto &property : p_RecordProperties) {                                                                             // for each property to be included in the log record
@@ -776,8 +842,8 @@ private:
                                 logRecordValues.push_back(value);                                                               // yes - add value to vector of values
                             }
                             else {                                                                                              // no - CSV, TSV, or TXT file
-                                valueStr = boost::apply_visitor(FormatVariantValue(), value, fmtStr);                           // format value
-                                logRecord += valueStr + delimiter;                                                              // add value string to log record - with delimiter
+                                boost::apply_visitor(FormatVariantValue(logRecord), value, fmtStr);                             // format value and add it to log record
+                                logRecord += delimiter;                                                                         // with delimiter
                             }
                         }
                     }
@@ -812,8 +878,8 @@ private:
                         logRecordValues.push_back(value);                                                                       // yes - add value to vector of values
                     }
                     else {                                                                                                      // no - CSV, TSV, or TXT file
-                        valueStr = boost::apply_visitor(FormatVariantValue(), value, fmtStr);                                   // format value
-                        logRecord += valueStr + delimiter;                                                                      // add value string to log record - with delimiter
+                        boost::apply_visitor(FormatVariantValue(logRecord), value, fmtStr);                                     // format value and add it to log record
+                        logRecord += delimiter;                                                                                 // with delimiter
                     }
                 }
                 else {                                                                                                          // use current value
@@ -823,8 +889,8 @@ private:
                             logRecordValues.push_back(value);                                                                   // yes - add value to vector of values
                         }
                         else {                                                                                                  // no - CSV, TSV, or TXT file
-                            valueStr = boost::apply_visitor(FormatVariantValue(), value, fmtStr);                               // format value
-                            logRecord += valueStr + delimiter;                                                                  // add value string to log record - with delimiter
+                            boost::apply_visitor(FormatVariantValue(logRecord), value, fmtStr);                                 // format value and add it to log record
+                            logRecord += delimiter;                                                                             // with delimiter
                         }
                     }
                     else {                                                                                                      // unknown property type - should never happen
@@ -1094,6 +1160,8 @@ private:
 
     bool UpdateAllLogfileRecordSpecs();
 
+    void UpdateLoggedProperties();
+
 
 public:
 
@@ -1122,13 +1190,24 @@ public:
 
     bool   Enabled() const { return m_Enabled; }
 
+    // PropertyLogged() is used to skip the calculation of values that are only ever written to logfiles when
+    // none of the logfiles that will be written in this run include the property
+    bool   PropertyLogged(const T_ANY_PROPERTY p_Property) const { return m_LoggedProperties.find(p_Property) != m_LoggedProperties.end(); }
+
+    string ContainerPath() const { return m_LogBasePath + "/" + m_LogContainerName; }
+
+    // LogEnabled() and DbgEnabled() are used by the SAY/LOG/DBG macros to decide whether a statement would be
+    // written before the message string is constructed - disabled statements cost only this check
+    bool   LogEnabled(const string& p_LogClass, const int p_LogLevel) const { return m_Enabled && DoIt(p_LogClass, p_LogLevel, m_LogClassMask, m_LogLevel); }
+    bool   DbgEnabled(const string& p_DbgClass, const int p_DbgLevel) const { return m_Enabled && DoIt(p_DbgClass, p_DbgLevel, m_DbgClassMask, m_DbgLevel); }
+
     int    Open(const string p_LogFileName, const bool p_Append, const bool p_TimeStamp, const bool p_Label, const LOGFILE p_StandardLogfile = LOGFILE::NONE);
     bool   Close(const int p_LogfileId);
 
     bool   Write(const int p_LogfileId, const string p_LogClass, const int p_LogLevel, const string p_LogStr);
     bool   Write(const int p_LogfileId, const string p_LogClass, const int p_LogLevel, const std::vector<COMPAS_VARIABLE_TYPE> p_LogRecordValues, const bool p_Flush = false);
     
-    bool   Put(const int p_LogfileId, const string p_LogClass, const int p_LogLevel, const string p_LogStr);
+    bool   Put(const int p_LogfileId, const string& p_LogClass, const int p_LogLevel, const string& p_LogStr);
     bool   Put(const int p_LogfileId, const string p_LogClass, const int p_LogLevel, const std::vector<COMPAS_VARIABLE_TYPE> p_LogRecordValues);
 
     bool   Debug(const string p_DbgClass, const int p_DbgLevel, const string p_DbgStr);
@@ -1141,8 +1220,9 @@ public:
     void   Say(const string p_SayClass, const int p_SayLevel, const string p_SayStr);
 
 
-    // SetSwitchParameters is called by Star::SwitchTo to set the parameters 
-    // to be written to the BSE Switch Log file
+    // SetSwitchParameters is called by Star::SwitchTo (SSE) and
+    // BaseBinaryStar::StellarTypeSwitched (BSE) to set the parameters 
+    // to be written to the Switch Log file
     void   SetSwitchParameters(const OBJECT_ID    p_ObjectIdSwitching, 
                                const STELLAR_TYPE p_TypeSwitchingFrom, 
                                const STELLAR_TYPE p_TypeSwitchingTo) {
@@ -1159,6 +1239,7 @@ public:
 
     bool CloseStandardFile(const LOGFILE p_LogFile, const bool p_Erase = true);
     bool CloseAllStandardFiles();
+    bool FlushTextFiles(const LOGFILE_FLUSH p_Occasion);
 
     std::tuple<ANY_PROPERTY_VECTOR, std::vector<string>, std::vector<bool>> GetStandardLogFileRecordDetails(const LOGFILE p_Logfile);
 
@@ -1169,7 +1250,65 @@ public:
     template <class T>
     bool LogBSEDetailedOutput(const T* const p_Binary, 
                               const long int p_Id,
-                              const BSE_DETAILED_RECORD_TYPE p_RecordType)          { return LogStandardRecord(std::get<2>(LOGFILE_DESCRIPTOR.at(LOGFILE::BSE_DETAILED_OUTPUT)), 0, LOGFILE::BSE_DETAILED_OUTPUT, static_cast<LOGRECORDTYPE>(p_RecordType), p_Binary, "_" + std::to_string(abs(p_Id))); }
+                              const BSE_DETAILED_RECORD_TYPE p_RecordType)          { return OPTIONS->DetailedOutputCompact()
+                                                                                                ? RecordBSEDetailedTimeline(p_Binary, p_Id, static_cast<LOGRECORDTYPE>(p_RecordType))
+                                                                                                : LogStandardRecord(std::get<2>(LOGFILE_DESCRIPTOR.at(LOGFILE::BSE_DETAILED_OUTPUT)), 0, LOGFILE::BSE_DETAILED_OUTPUT, static_cast<LOGRECORDTYPE>(p_RecordType), p_Binary, "_" + std::to_string(abs(p_Id))); }
+
+    /*
+     * Record a BSE detailed output record in the compact detailed output file (--detailed-output-compact)
+     *
+     * The record values are the same as those written to the standard BSE detailed output file (the
+     * same properties, annotations and record type column), but rather than being written to a file
+     * per binary they are appended to the timeline of the binary, which is encoded and written to the
+     * compact detailed output file when the binary has finished evolving (see FlushBSEDetailedTimeline()).
+     *
+     * The compact detailed output file is created on the first call.
+     *
+     *
+     * bool RecordBSEDetailedTimeline(const T* const p_Binary, const long int p_Id, const LOGRECORDTYPE p_RecordType)
+     *
+     * @param   [IN]    p_Binary                    The binary from which the property values should be retrieved
+     * @param   [IN]    p_Id                        The id of the binary
+     * @param   [IN]    p_RecordType                The logfile record type
+     * @return                                      Boolean status (true = success, false = failure)
+     */
+    template <class T>
+    bool RecordBSEDetailedTimeline(const T* const p_Binary, const long int p_Id, const LOGRECORDTYPE p_RecordType) {
+
+        if (((1 << (p_RecordType - 1)) & OPTIONS->LogfileDetailedOutputRecordTypes()) == 0) return true;                   // record type not enabled - nothing to do
+
+        if (!m_BSEDetailedTimeline.IsOpen() && !OpenBSEDetailedTimeline()) return false;                                    // open the file if necessary
+
+        bool ok = true;
+        COMPAS_VARIABLE_TYPE value;
+        std::vector<COMPAS_VARIABLE_TYPE> values;
+        values.reserve(m_BSE_Detailed_Rec.size() + m_BSE_Detailed_Notes.size() + 1);
+
+        for (auto &property : m_BSE_Detailed_Rec) {                                                                         // for each property to be included in the record
+            if (boost::apply_visitor(VariantPropertyType(), property) == ANY_PROPERTY_TYPE::T_PROGRAM_OPTION &&
+                boost::get<PROGRAM_OPTION>(property) == PROGRAM_OPTION::NOTES) {                                            // PROGRAM_OPTION::NOTES?
+                for (size_t idx = 0; idx < m_BSE_Detailed_Notes.size(); idx++) {                                            // yes - for each user-specified annotation
+                    if (m_BSE_Detailed_Notes[idx]) values.push_back(OPTIONS->Notes(idx));                                   // add it if required
+                }
+            }
+            else {                                                                                                          // not NOTES
+                std::tie(ok, value) = p_Binary->PropertyValue(property);                                                    // get property flag and value
+                if (!ok) {                                                                                                  // unknown property type - should never happen
+                    Squawk(ERR_MSG(ERROR::UNKNOWN_PROPERTY_TYPE));                                                          // show warning
+                    return false;
+                }
+                values.push_back(value);
+            }
+        }
+        values.push_back(p_RecordType);                                                                                     // record type column
+
+        ok = m_BSEDetailedTimeline.Append(p_Id, values);
+        if (!ok) Squawk(ERR_MSG(ERROR::FILE_WRITE_ERROR) + " while writing to compact detailed output file");              // show warning if record not written ok
+
+        return ok;
+    }
+
+    bool FlushBSEDetailedTimeline()                                                 { return m_BSEDetailedTimeline.IsOpen() ? m_BSEDetailedTimeline.Flush() : true; }
 
     template <class T>
     bool LogBSEPulsarEvolutionParameters(const T* const p_Binary,
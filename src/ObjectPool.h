@@ -0,0 +1,104 @@
+#ifndef __ObjectPool_h__
+#define __ObjectPool_h__
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+
+/*
+ * Object pools: slab allocation for the objects constructed and destroyed for every star/binary
+ *
+ * EvolveBinaryStars() constructs a BinaryStar for each binary evolved - which constructs a
+ * BaseBinaryStar, which constructs two BinaryConstituentStars (and reconstructs them for
+ * equal-mass binaries) - and destroys them all when the binary has been evolved.  The binary
+ * saved for rewinding, the fork point snapshots of --fork-variations and the donor copies
+ * made to test mass transfer stability add more of the same objects.  At millions of binaries
+ * the general-purpose heap spends a measurable amount of time on these (large) allocations,
+ * and the process RSS creeps up as the heap fragments.
+ *
+ * Classes that declare POOLED_ALLOCATION(ClassName) in their class definition allocate their
+ * objects from a pool dedicated to the class instead of the heap:
+ *
+ *    - the pool carves fixed-size blocks (of sizeof(ClassName) bytes) from slabs of
+ *      POOL_SLAB_BLOCKS blocks, allocating a new slab only when all blocks are in use
+ *    - deleted objects return their block to the pool's free list, from which the next object
+ *      constructed takes its block - so the blocks released by one binary are reused by the next,
+ *      and after the first few binaries there is no further allocation at all
+ *    - slabs are never released, so the pool holds the high-water mark of live objects (a
+ *      handful of objects for EvolveBinaryStars())
+ *
+ * Objects of classes derived from a pooled class that don't declare their own pool are larger
+ * than the pool's blocks, and are allocated from (and deleted to) the heap as usual.
+ *
+ * The underlying star objects (MS_gt_07, HG, etc.) are not pooled: Star holds them in place
+ * (see Star.h), so stellar type switches and clones already don't allocate.
+ *
+ * The pools are not thread-safe - COMPAS evolves one star/binary at a time.
+ */
+
+
+#define POOL_SLAB_BLOCKS 16                                                                                 // blocks per slab
+
+#define POOLED_ALLOCATION(className)                                                                        \
+    static void* operator new(std::size_t p_Size)                 { return ObjectPool<className>::Allocate(p_Size); } \
+    static void  operator delete(void* p_Ptr, std::size_t p_Size) { ObjectPool<className>::Free(p_Ptr, p_Size); }
+
+
+template <typename T>
+class ObjectPool {
+
+public:
+
+    static void* Allocate(const std::size_t p_Size) {
+
+        if (p_Size != sizeof(T)) return ::operator new(p_Size);                                             // derived class object - use the heap
+
+        if (!m_FreeList) NewSlab();                                                                         // no free blocks - add a slab
+
+        FreeBlockT* block = m_FreeList;                                                                     // take the first free block
+        m_FreeList        = block->next;
+        return block;
+    }
+
+    static void Free(void* p_Ptr, const std::size_t p_Size) {
+
+        if (!p_Ptr) return;
+
+        if (p_Size != sizeof(T)) { ::operator delete(p_Ptr); return; }                                      // derived class object - was allocated from the heap
+
+        FreeBlockT* block = static_cast<FreeBlockT*>(p_Ptr);                                                // return the block to the free list
+        block->next       = m_FreeList;
+        m_FreeList        = block;
+    }
+
+private:
+
+    typedef struct FreeBlock {                                                                              // free blocks hold the free list link
+        struct FreeBlock* next;
+    } FreeBlockT;
+
+    static_assert(sizeof(T) >= sizeof(FreeBlockT), "ObjectPool: objects too small to pool");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "ObjectPool: objects over-aligned");
+
+    static constexpr std::size_t BLOCK_SIZE = (sizeof(T) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    static void NewSlab() {
+
+        char* slab = static_cast<char*>(::operator new(BLOCK_SIZE * POOL_SLAB_BLOCKS));                     // suitably aligned for any type
+        m_Slabs.push_back(slab);
+
+        for (std::size_t block = POOL_SLAB_BLOCKS; block > 0; block--) {                                    // thread the blocks onto the free list
+            Free(slab + (block - 1) * BLOCK_SIZE, sizeof(T));                                               // in reverse, so they're handed out in address order
+        }
+    }
+
+    static FreeBlockT*        m_FreeList;                                                                   // free blocks
+    static std::vector<char*> m_Slabs;                                                                      // slabs allocated (never released)
+};
+
+template <typename T> typename ObjectPool<T>::FreeBlockT* ObjectPool<T>::m_FreeList = nullptr;
+template <typename T> std::vector<char*>                  ObjectPool<T>::m_Slabs;
+
+
+#endif // __ObjectPool_h__
@@ -72,6 +72,8 @@
 /*         m_RangeExcluded   : option strings for which a range may not be specified      */
 /*         m_SetExcluded     : option strings for which a set may not be specified        */
 /*                                                                                        */
+/*         m_ForkVariationsAllowed: options that may be varied with fork-variations       */
+/*                                                                                        */
 /*     Read the explanations for each of the vectors in Options.h to get a better idea of */
 /*     what they are for and where the new option should go.                              */
 /*                                                                                        */
@@ -161,14 +163,25 @@ void Options::OptionValues::Initialise() {
     m_EvolvePulsars                                                 = false;
 	m_EvolveUnboundSystems                                          = false;
 
+    m_ForkVariations                                                = false;
+
+    m_ImportanceSampling                                            = false;
+    m_ImportanceSamplingBatchSize                                   = 1000;
+    m_ImportanceSamplingExplorationFraction                         = 0.1;
+
     m_DetailedOutput                                                = false;
+    m_DetailedOutputCompact                                         = false;
     m_PopulationDataPrinting                                        = false;
+    m_PopulationSummary.clear();
+    m_PopulationSummaryOnly                                         = false;
     m_PrintBoolAsString                                             = false;
     m_Quiet                                                         = false;
     m_RlofPrinting                                                  = true;
 
     m_ShortHelp                                                     = true;
 
+    m_StartupTiming                                                 = false;
+
     m_StoreInputFiles                                               = true;
 
     m_SwitchLog                                                     = false;
@@ -191,6 +204,11 @@ void Options::OptionValues::Initialise() {
 
     // Specify how long to evolve for
     m_MaxEvolutionTime                                              = 13700.0;
+
+    // Early termination of binaries that can no longer reach the evolution target
+    m_EvolutionTarget.type                                          = EVOLUTION_TARGET::ALL;
+    m_EvolutionTarget.typeString                                    = EVOLUTION_TARGET_LABEL.at(m_EvolutionTarget.type);
+    m_EvolutionTargetMinimumMass                                    = 0.0;
     m_MaxNumberOfTimestepIterations                                 = 99999;
     m_TimestepMultiplier                                            = 1.0;
 
@@ -538,6 +556,8 @@ void Options::OptionValues::Initialise() {
     m_LogfileNamePrefix                                             = "";
     m_LogfileType.type                                              = LOGFILETYPE::HDF5;
     m_LogfileType.typeString                                        = LOGFILETYPELabel.at(m_LogfileType.type);
+    m_LogfileFlush.type                                             = LOGFILE_FLUSH::OBJECT;
+    m_LogfileFlush.typeString                                       = LOGFILE_FLUSH_LABEL.at(m_LogfileFlush.type);
 
     m_LogfileBeBinaries                                             = std::get<0>(LOGFILE_DESCRIPTOR.at(LOGFILE::BSE_BE_BINARIES));
     m_LogfileBeBinariesRecordTypes                                  = -1;                                                                   // all record types
@@ -562,6 +582,10 @@ void Options::OptionValues::Initialise() {
     
     m_HDF5BufferSize                                                = HDF5_DEFAULT_IO_BUFFER_SIZE;
     m_HDF5ChunkSize                                                 = HDF5_DEFAULT_CHUNK_SIZE;
+    m_HDF5Compression.type                                          = HDF5_COMPRESSION::NONE;
+    m_HDF5Compression.typeString                                    = HDF5_COMPRESSION_LABEL.at(m_HDF5Compression.type);
+    m_HDF5CompressionLevel                                          = HDF5_DEFAULT_COMPRESSION_LEVEL;
+    m_HDF5Shuffle                                                   = false;
 
     // YAML file
 
@@ -587,16 +611,22 @@ void Options::OptionValues::Initialise() {
  * 
  * Note that both parameters are modified here.
  * 
+ * The option descriptions are only needed to show help - they are a few hundred strings, most of
+ * them constructed from default and allowed values, so they are only constructed if p_Descriptions
+ * is true (otherwise the descriptions are empty strings).
+ * 
  * 
- * bool AddOptions(OptionValues *p_Options, po::options_description *p_OptionsDescription)
+ * bool AddOptions(OptionValues *p_Options, po::options_description *p_OptionsDescription, const bool p_Descriptions)
  * 
  * @param   [IN/OUT]    p_Options                   Object containing option values
  * @param   [IN/OUT]    p_OptionsDescription        options_description onject
+ * @param   [IN]        p_Descriptions              Construct the option descriptions?
  * @return                                          Boolean result:
  *                                                      true  if options added ok
  *                                                      false if an error occurred
  */
-bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_OptionsDescription) {
+bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_OptionsDescription, const bool p_Descriptions) {
+#define DESCRIPTION(description) (p_Descriptions ? (description) : "")     // for convenience and readability - undefined at end of function
 
     bool ok = true;                             // status - unless a problem occurs
 
@@ -634,6 +664,14 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
     if (defaultNotesHdrs.length() > 0) defaultNotesHdrs.erase(defaultNotesHdrs.length() - 1);
     defaultNotesHdrs = "{" + defaultNotesHdrs + "}";
 
+    // population summary reducers
+    std::string defaultPopulationSummary;
+    std::ostringstream ss5;
+    for (auto reducer = p_Options->m_PopulationSummary.begin(); reducer != p_Options->m_PopulationSummary.end(); ++reducer) ss5 << *reducer << ",";
+    defaultPopulationSummary = ss5.str();
+    if (defaultPopulationSummary.length() > 0) defaultPopulationSummary.erase(defaultPopulationSummary.length() - 1);
+    defaultPopulationSummary = "{" + defaultPopulationSummary + "}";
+
 
     // add options
 
@@ -652,11 +690,11 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
 
         (
             "help,h",                                                      
-            po::bool_switch(), "Print this help message"
+            po::bool_switch(), DESCRIPTION("Print this help message")
         )
         (
             "version,v",                                                   
-            po::bool_switch(), "Print COMPAS version string"
+            po::bool_switch(), DESCRIPTION("Print COMPAS version string")
         )
 
 
@@ -665,179 +703,209 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
         (
             "allow-non-stripped-ECSN",
             po::value<bool>(&p_Options->m_AllowNonStrippedECSN)->default_value(p_Options->m_AllowNonStrippedECSN)->implicit_value(true),                                                                  
-            ("Allow ECSN to occur in unstripped progenitors (default = " + std::string(p_Options->m_AllowNonStrippedECSN ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Allow ECSN to occur in unstripped progenitors (default = " + std::string(p_Options->m_AllowNonStrippedECSN ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "allow-rlof-at-birth",                                         
             po::value<bool>(&p_Options->m_AllowRLOFAtBirth)->default_value(p_Options->m_AllowRLOFAtBirth)->implicit_value(true),                                                                  
-            ("Allow binaries that have one or both stars in RLOF at birth to evolve (default = " + std::string(p_Options->m_AllowRLOFAtBirth ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Allow binaries that have one or both stars in RLOF at birth to evolve (default = " + std::string(p_Options->m_AllowRLOFAtBirth ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "allow-touching-at-birth",                                     
             po::value<bool>(&p_Options->m_AllowTouchingAtBirth)->default_value(p_Options->m_AllowTouchingAtBirth)->implicit_value(true),                                                          
-            ("Allow binaries that are touching at birth to evolve (default = " + std::string(p_Options->m_AllowTouchingAtBirth ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Allow binaries that are touching at birth to evolve (default = " + std::string(p_Options->m_AllowTouchingAtBirth ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "angular-momentum-conservation-during-circularisation",            
             po::value<bool>(&p_Options->m_AngularMomentumConservationDuringCircularisation)->default_value(p_Options->m_AngularMomentumConservationDuringCircularisation)->implicit_value(true),  
-            ("Conserve angular momentum when binary is circularised when entering a Mass Transfer episode (default = " + std::string(p_Options->m_AngularMomentumConservationDuringCircularisation ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Conserve angular momentum when binary is circularised when entering a Mass Transfer episode (default = " + std::string(p_Options->m_AngularMomentumConservationDuringCircularisation ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         /*
         (
             "BE-binaries",                                                  
             po::value<bool>(&p_Options->m_BeBinaries)->default_value(p_Options->m_BeBinaries)->implicit_value(true),                                                                              
-            ("Enable Be Binaries study (default = " + std::string(p_Options->m_BeBinaries ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Enable Be Binaries study (default = " + std::string(p_Options->m_BeBinaries ? "TRUE" : "FALSE") + ")").c_str())
         )
         */
         (
             "check-photon-tiring-limit",
             po::value<bool>(&p_Options->m_CheckPhotonTiringLimit)->default_value(p_Options->m_CheckPhotonTiringLimit)->implicit_value(true),                            
-            ("Check the photon tiring limit hasn't been exceeded by wind mass loss (default = " + std::string(p_Options->m_CheckPhotonTiringLimit ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Check the photon tiring limit hasn't been exceeded by wind mass loss (default = " + std::string(p_Options->m_CheckPhotonTiringLimit ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "circularise-binary-during-mass-transfer",                         
             po::value<bool>(&p_Options->m_CirculariseBinaryDuringMassTransfer)->default_value(p_Options->m_CirculariseBinaryDuringMassTransfer)->implicit_value(true),                            
-            ("Circularise binary when it enters a Mass Transfer episode (default = " + std::string(p_Options->m_CirculariseBinaryDuringMassTransfer ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Circularise binary when it enters a Mass Transfer episode (default = " + std::string(p_Options->m_CirculariseBinaryDuringMassTransfer ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "common-envelope-allow-immediate-RLOF-post-CE-survive",
             po::value<bool>(&p_Options->m_AllowImmediateRLOFpostCEToSurviveCommonEnvelope)->default_value(p_Options->m_AllowImmediateRLOFpostCEToSurviveCommonEnvelope)->implicit_value(true),
-            ("Allow immediate post CE RLOF to survive common envelope evolution (default = " + std::string(p_Options->m_AllowImmediateRLOFpostCEToSurviveCommonEnvelope ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Allow immediate post CE RLOF to survive common envelope evolution (default = " + std::string(p_Options->m_AllowImmediateRLOFpostCEToSurviveCommonEnvelope ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "common-envelope-allow-main-sequence-survive",                 
             po::value<bool>(&p_Options->m_AllowMainSequenceStarToSurviveCommonEnvelope)->default_value(p_Options->m_AllowMainSequenceStarToSurviveCommonEnvelope)->implicit_value(true),          
-            ("Allow main sequence stars to survive common envelope evolution (default = " + std::string(p_Options->m_AllowMainSequenceStarToSurviveCommonEnvelope ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Allow main sequence stars to survive common envelope evolution (default = " + std::string(p_Options->m_AllowMainSequenceStarToSurviveCommonEnvelope ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "common-envelope-lambda-nanjing-enhanced",
             po::value<bool>(&p_Options->m_CommonEnvelopeLambdaNanjingEnhanced)->default_value(p_Options->m_CommonEnvelopeLambdaNanjingEnhanced)->implicit_value(true),
-            ("Use Nanjing lambda's with enhanced extrapolation in stellar radius (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingEnhanced ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Use Nanjing lambda's with enhanced extrapolation in stellar radius (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingEnhanced ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "common-envelope-lambda-nanjing-interpolate-in-mass",
             po::value<bool>(&p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMass)->default_value(p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMass)->implicit_value(true),
-            ("Use Nanjing lambda's with mass interpolation (only used when using enhanced Nanjing lambda's) (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMass ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Use Nanjing lambda's with mass interpolation (only used when using enhanced Nanjing lambda's) (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMass ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "common-envelope-lambda-nanjing-interpolate-in-metallicity",
             po::value<bool>(&p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMetallicity)->default_value(p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMetallicity)->implicit_value(true),
-            ("Use Nanjing lambda's with metallicity interpolation (only used when using enhanced Nanjing lambda's) (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMetallicity ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Use Nanjing lambda's with metallicity interpolation (only used when using enhanced Nanjing lambda's) (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingInterpolateInMetallicity ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "common-envelope-lambda-nanjing-use-rejuvenated-mass",
             po::value<bool>(&p_Options->m_CommonEnvelopeLambdaNanjingUseRejuvenatedMass)->default_value(p_Options->m_CommonEnvelopeLambdaNanjingUseRejuvenatedMass)->implicit_value(true),
-            ("Use rejuvenated mass to calculate Nanjing lambda's (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingUseRejuvenatedMass ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Use rejuvenated mass to calculate Nanjing lambda's (default = " + std::string(p_Options->m_CommonEnvelopeLambdaNanjingUseRejuvenatedMass ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "common-envelope-allow-radiative-envelope-survive",
             po::value<bool>(&p_Options->m_AllowRadiativeEnvelopeStarToSurviveCommonEnvelope)->default_value(p_Options->m_AllowRadiativeEnvelopeStarToSurviveCommonEnvelope)->implicit_value(true),
-            ("Allow radiative envelope stars to survive common envelope evolution (default = " + std::string(p_Options->m_AllowRadiativeEnvelopeStarToSurviveCommonEnvelope ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Allow radiative envelope stars to survive common envelope evolution (default = " + std::string(p_Options->m_AllowRadiativeEnvelopeStarToSurviveCommonEnvelope ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         (
             "debug-to-file",                                               
             po::value<bool>(&p_Options->m_DebugToFile)->default_value(p_Options->m_DebugToFile)->implicit_value(true),                                                                            
-            ("Write debug statements to file (default = " + std::string(p_Options->m_DebugToFile ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Write debug statements to file (default = " + std::string(p_Options->m_DebugToFile ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "detailed-output",                                              
             po::value<bool>(&p_Options->m_DetailedOutput)->default_value(p_Options->m_DetailedOutput)->implicit_value(true),                                                                      
-            ("Print detailed output to file (default = " + std::string(p_Options->m_DetailedOutput ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Print detailed output to file (default = " + std::string(p_Options->m_DetailedOutput ? "TRUE" : "FALSE") + ")").c_str())
+        )
+        (
+            "detailed-output-compact",                                              
+            po::value<bool>(&p_Options->m_DetailedOutputCompact)->default_value(p_Options->m_DetailedOutputCompact)->implicit_value(true),                                                        
+            DESCRIPTION(("Write BSE detailed output as compact (run-length/delta encoded) per-binary blocks in a single file (default = " + std::string(p_Options->m_DetailedOutputCompact ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         (
             "enable-warnings",                                             
             po::value<bool>(&p_Options->m_EnableWarnings)->default_value(p_Options->m_EnableWarnings)->implicit_value(true),                                                                      
-            ("Display warning messages to stdout (default = " + std::string(p_Options->m_EnableWarnings ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Display warning messages to stdout (default = " + std::string(p_Options->m_EnableWarnings ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "errors-to-file",                                              
             po::value<bool>(&p_Options->m_ErrorsToFile)->default_value(p_Options->m_ErrorsToFile)->implicit_value(true),                                                                          
-            ("Write error messages to file (default = " + std::string(p_Options->m_ErrorsToFile ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Write error messages to file (default = " + std::string(p_Options->m_ErrorsToFile ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "evolve-pulsars",                                              
             po::value<bool>(&p_Options->m_EvolvePulsars)->default_value(p_Options->m_EvolvePulsars)->implicit_value(true),                                                                        
-            ("Evolve pulsars (default = " + std::string(p_Options->m_EvolvePulsars ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Evolve pulsars (default = " + std::string(p_Options->m_EvolvePulsars ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "evolve-unbound-systems",                                      
             po::value<bool>(&p_Options->m_EvolveUnboundSystems)->default_value(p_Options->m_EvolveUnboundSystems)->implicit_value(true),                                                          
-            ("Continue evolving stars even if the binary is disrupted (default = " + std::string(p_Options->m_EvolveUnboundSystems ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Continue evolving stars even if the binary is disrupted (default = " + std::string(p_Options->m_EvolveUnboundSystems ? "TRUE" : "FALSE") + ")").c_str())
+        )
+        (
+            "fork-variations",
+            po::value<bool>(&p_Options->m_ForkVariations)->default_value(p_Options->m_ForkVariations)->implicit_value(true),
+            DESCRIPTION(("Share initial conditions across command-line variations and resume each variation after the first from a fork point before the first CE or SN event (BSE only) (default = " + std::string(p_Options->m_ForkVariations ? "TRUE" : "FALSE") + ")").c_str())
         )
 
+        (
+            "hdf5-shuffle",
+            po::value<bool>(&p_Options->m_HDF5Shuffle)->default_value(p_Options->m_HDF5Shuffle)->implicit_value(true),
+            DESCRIPTION(("Apply the HDF5 shuffle filter before compressing HDF5 file datasets (ignored if --hdf5-compression is NONE) (default = " + std::string(p_Options->m_HDF5Shuffle ? "TRUE" : "FALSE") + ")").c_str())
+        )
         (
             "hmxr-binaries",
             po::value<bool>(&p_Options->m_HMXRBinaries)->default_value(p_Options->m_HMXRBinaries)->implicit_value(true),
-            ("Store HMXRB candidates in BSE_RLOF output file (default = " + std::string(p_Options->m_HMXRBinaries ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Store HMXRB candidates in BSE_RLOF output file (default = " + std::string(p_Options->m_HMXRBinaries ? "TRUE" : "FALSE") + ")").c_str())
+        )
+        (
+            "importance-sampling",
+            po::value<bool>(&p_Options->m_ImportanceSampling)->default_value(p_Options->m_ImportanceSampling)->implicit_value(true),
+            DESCRIPTION(("Adaptively importance sample initial mass, mass ratio and semi-major axis around binaries that reach the evolution target (BSE only) (default = " + std::string(p_Options->m_ImportanceSampling ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         (
             "mass-transfer",                                                
             po::value<bool>(&p_Options->m_UseMassTransfer)->default_value(p_Options->m_UseMassTransfer)->implicit_value(true),                                                                    
-            ("Enable mass transfer (default = " + std::string(p_Options->m_UseMassTransfer ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Enable mass transfer (default = " + std::string(p_Options->m_UseMassTransfer ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         (
             "pair-instability-supernovae",                                 
             po::value<bool>(&p_Options->m_UsePairInstabilitySupernovae)->default_value(p_Options->m_UsePairInstabilitySupernovae)->implicit_value(true),                                          
-            ("Enable pair instability supernovae (PISN) (default = " + std::string(p_Options->m_UsePairInstabilitySupernovae ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Enable pair instability supernovae (PISN) (default = " + std::string(p_Options->m_UsePairInstabilitySupernovae ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "population-data-printing",                                      
             po::value<bool>(&p_Options->m_PopulationDataPrinting)->default_value(p_Options->m_PopulationDataPrinting)->implicit_value(true),                                                      
-            ("Print details of population (default = " + std::string(p_Options->m_PopulationDataPrinting ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Print details of population (default = " + std::string(p_Options->m_PopulationDataPrinting ? "TRUE" : "FALSE") + ")").c_str())
+        )
+        (
+            "population-summary-only",                                      
+            po::value<bool>(&p_Options->m_PopulationSummaryOnly)->default_value(p_Options->m_PopulationSummaryOnly)->implicit_value(true),                                                        
+            DESCRIPTION(("Write only the population summary - skip the per-system BSE logfiles (default = " + std::string(p_Options->m_PopulationSummaryOnly ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "print-bool-as-string",                                        
             po::value<bool>(&p_Options->m_PrintBoolAsString)->default_value(p_Options->m_PrintBoolAsString)->implicit_value(true),                                                                
-            ("Print boolean properties as 'TRUE' or 'FALSE' (default = " + std::string(p_Options->m_PrintBoolAsString ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Print boolean properties as 'TRUE' or 'FALSE' (default = " + std::string(p_Options->m_PrintBoolAsString ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "pulsational-pair-instability",                                
             po::value<bool>(&p_Options->m_UsePulsationalPairInstability)->default_value(p_Options->m_UsePulsationalPairInstability)->implicit_value(true),                                        
-            ("Enable mass loss due to pulsational-pair-instability (PPI) (default = " + std::string(p_Options->m_UsePulsationalPairInstability ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Enable mass loss due to pulsational-pair-instability (PPI) (default = " + std::string(p_Options->m_UsePulsationalPairInstability ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         (
             "quiet",                                                       
             po::value<bool>(&p_Options->m_Quiet)->default_value(p_Options->m_Quiet)->implicit_value(true),                                                                                        
-            ("Suppress printing (default = " + std::string(p_Options->m_Quiet ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Suppress printing (default = " + std::string(p_Options->m_Quiet ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         (
             "retain-core-mass-during-caseA-mass-transfer",
             po::value<bool>(&p_Options->m_RetainCoreMassDuringCaseAMassTransfer)->default_value(p_Options->m_RetainCoreMassDuringCaseAMassTransfer)->implicit_value(true),
-            ("Retain approximate core mass of a case A donor as a minimum core at end of MS or HeMS (default = " + std::string(p_Options->m_RetainCoreMassDuringCaseAMassTransfer ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Retain approximate core mass of a case A donor as a minimum core at end of MS or HeMS (default = " + std::string(p_Options->m_RetainCoreMassDuringCaseAMassTransfer ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "revised-energy-formalism-nandez-ivanova",                     
             po::value<bool>(&p_Options->m_RevisedEnergyFormalismNandezIvanova)->default_value(p_Options->m_RevisedEnergyFormalismNandezIvanova)->implicit_value(true),                            
-            ("Enable revised energy formalism (default = " + std::string(p_Options->m_RevisedEnergyFormalismNandezIvanova ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Enable revised energy formalism (default = " + std::string(p_Options->m_RevisedEnergyFormalismNandezIvanova ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "rlof-printing",                                                
             po::value<bool>(&p_Options->m_RlofPrinting)->default_value(p_Options->m_RlofPrinting)->implicit_value(true),                                                                          
-            ("Enable output parameters before/after RLOF (default = " + std::string(p_Options->m_RlofPrinting ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Enable output parameters before/after RLOF (default = " + std::string(p_Options->m_RlofPrinting ? "TRUE" : "FALSE") + ")").c_str())
         )
 
+        (
+            "startup-timing",                                                
+            po::value<bool>(&p_Options->m_StartupTiming)->default_value(p_Options->m_StartupTiming)->implicit_value(true),                                                                          
+            DESCRIPTION(("Report the time spent in each phase of program startup (default = " + std::string(p_Options->m_StartupTiming ? "TRUE" : "FALSE") + ")").c_str())
+        )
         (
             "store-input-files",                                                
             po::value<bool>(&p_Options->m_StoreInputFiles)->default_value(p_Options->m_StoreInputFiles)->implicit_value(true),                                                                          
-            ("Store input files in output container (default = " + std::string(p_Options->m_StoreInputFiles ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Store input files in output container (default = " + std::string(p_Options->m_StoreInputFiles ? "TRUE" : "FALSE") + ")").c_str())
         )
         (
             "switch-log",                                                
             po::value<bool>(&p_Options->m_SwitchLog)->default_value(p_Options->m_SwitchLog)->implicit_value(true),                                                                          
-            ("Print switch log to file (default = " + std::string(p_Options->m_SwitchLog ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Print switch log to file (default = " + std::string(p_Options->m_SwitchLog ? "TRUE" : "FALSE") + ")").c_str())
         )
 
         (
             "use-mass-loss",                                               
             po::value<bool>(&p_Options->m_UseMassLoss)->default_value(p_Options->m_UseMassLoss)->implicit_value(true),                                                                            
-            ("Enable mass loss (default = " + std::string(p_Options->m_UseMassLoss ? "TRUE" : "FALSE") + ")").c_str()
+            DESCRIPTION(("Enable mass loss (default = " + std::string(p_Options->m_UseMassLoss ? "TRUE" : "FALSE") + ")").c_str())
         )
 
 
@@ -849,7 +917,7 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
         (
             "random-seed",                                                 
             po::value<unsigned long>(&p_Options->m_RandomSeed)->default_value(p_Options->m_RandomSeed),                                                                                           
-            ("Random seed to use (default = " + std::to_string(p_Options->m_RandomSeed) + ")").c_str()
+            DESCRIPTION(("Random seed to use (default = " + std::to_string(p_Options->m_RandomSeed) + ")").c_str())
         )
 
 
@@ -858,89 +926,100 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
         (
             "debug-level",                                                 
             po::value<int>(&p_Options->m_DebugLevel)->default_value(p_Options->m_DebugLevel),                                                                                                     
-            ("Determines which print statements are displayed for debugging (default = " + std::to_string(p_Options->m_DebugLevel) + ")").c_str()
+            DESCRIPTION(("Determines which print statements are displayed for debugging (default = " + std::to_string(p_Options->m_DebugLevel) + ")").c_str())
         )
 
         (
             "grid-start-line",                                                 
             po::value<std::streamsize>(&p_Options->m_GridStartLine)->default_value(p_Options->m_GridStartLine),                                                                                                     
-            ("Specifies which line of the grid file is processed first (0-based) (default = " + std::to_string(p_Options->m_GridStartLine) + ")").c_str()
+            DESCRIPTION(("Specifies which line of the grid file is processed first (0-based) (default = " + std::to_string(p_Options->m_GridStartLine) + ")").c_str())
         )
         (
             "grid-lines-to-process",                                                 
             po::value<std::streamsize>(&p_Options->m_GridLinesToProcess)->default_value(p_Options->m_GridLinesToProcess),                                                                                                     
-            ("Specifies how many grid lines should be processed (from the start line - see grid-start-line) (default = " + (p_Options->m_GridLinesToProcess == std::numeric_limits<std::streamsize>::max() ? "Process to EOF" : std::to_string(p_Options->m_GridLinesToProcess)) + ")").c_str()
+            DESCRIPTION(("Specifies how many grid lines should be processed (from the start line - see grid-start-line) (default = " + (p_Options->m_GridLinesToProcess == std::numeric_limits<std::streamsize>::max() ? "Process to EOF" : std::to_string(p_Options->m_GridLinesToProcess)) + ")").c_str())
         )
 
         (
             "hdf5-chunk-size",                                                 
             po::value<int>(&p_Options->m_HDF5ChunkSize)->default_value(p_Options->m_HDF5ChunkSize),                                                                                                     
-            ("HDF5 file dataset chunk size (number of dataset entries, default = " + std::to_string(p_Options->m_HDF5ChunkSize) + ")").c_str()
+            DESCRIPTION(("HDF5 file dataset chunk size (number of dataset entries, default = " + std::to_string(p_Options->m_HDF5ChunkSize) + ")").c_str())
         )
         (
             "hdf5-buffer-size",                                                 
             po::value<int>(&p_Options->m_HDF5BufferSize)->default_value(p_Options->m_HDF5BufferSize),                                                                                                     
-            ("HDF5 file dataset IO buffer size (number of chunks, default = " + std::to_string(p_Options->m_HDF5BufferSize) + ")").c_str()
+            DESCRIPTION(("HDF5 file dataset IO buffer size (number of chunks, default = " + std::to_string(p_Options->m_HDF5BufferSize) + ")").c_str())
+        )
+        (
+            "hdf5-compression-level",
+            po::value<int>(&p_Options->m_HDF5CompressionLevel)->default_value(p_Options->m_HDF5CompressionLevel),
+            DESCRIPTION(("HDF5 file dataset deflate compression level (1 = fastest .. 9 = smallest, default = " + std::to_string(p_Options->m_HDF5CompressionLevel) + ")").c_str())
+        )
+
+        (
+            "importance-sampling-batch-size",
+            po::value<int>(&p_Options->m_ImportanceSamplingBatchSize)->default_value(p_Options->m_ImportanceSamplingBatchSize),
+            DESCRIPTION(("Number of binaries evolved between refits of the importance sampling proposal (default = " + std::to_string(p_Options->m_ImportanceSamplingBatchSize) + ")").c_str())
         )
 
         /*
         (
             "logfile-BE-binaries-record-types",                                     
             po::value<int>(&p_Options->m_LogfileBeBinariesRecordTypes)->default_value(p_Options->m_LogfileBeBinariesRecordTypes),                                                                              
-            ("Enabled record types for BSE Be Binaries logfile (default = " + std::to_string(p_Options->m_LogfileBeBinariesRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for BSE Be Binaries logfile (default = " + std::to_string(p_Options->m_LogfileBeBinariesRecordTypes) + ")").c_str())
         )
         */
         (
             "logfile-common-envelopes-record-types",                                
             po::value<int>(&p_Options->m_LogfileCommonEnvelopesRecordTypes)->default_value(p_Options->m_LogfileCommonEnvelopesRecordTypes),                                                                    
-            ("Enabled record types for BSE Common Envelopes logfile (default = " + std::to_string(p_Options->m_LogfileCommonEnvelopesRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for BSE Common Envelopes logfile (default = " + std::to_string(p_Options->m_LogfileCommonEnvelopesRecordTypes) + ")").c_str())
         )
         (
             "logfile-detailed-output-record-types",                                 
             po::value<int>(&p_Options->m_LogfileDetailedOutputRecordTypes)->default_value(p_Options->m_LogfileDetailedOutputRecordTypes),                                                                      
-            ("Enabled record types for BSE Detailed Output logfile (default = " + std::to_string(p_Options->m_LogfileDetailedOutputRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for BSE Detailed Output logfile (default = " + std::to_string(p_Options->m_LogfileDetailedOutputRecordTypes) + ")").c_str())
         )
         (
             "logfile-double-compact-objects-record-types",                          
             po::value<int>(&p_Options->m_LogfileDoubleCompactObjectsRecordTypes)->default_value(p_Options->m_LogfileDoubleCompactObjectsRecordTypes),                                                          
-            ("Enabled record types for Double Compact Objects logfile (default = " + std::to_string(p_Options->m_LogfileDoubleCompactObjectsRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for Double Compact Objects logfile (default = " + std::to_string(p_Options->m_LogfileDoubleCompactObjectsRecordTypes) + ")").c_str())
         )
         (
             "logfile-pulsar-evolution-record-types",                                
             po::value<int>(&p_Options->m_LogfilePulsarEvolutionRecordTypes)->default_value(p_Options->m_LogfilePulsarEvolutionRecordTypes),                                                                    
-            ("Enabled record types for Pulsar Evolution logfile (default = " + std::to_string(p_Options->m_LogfilePulsarEvolutionRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for Pulsar Evolution logfile (default = " + std::to_string(p_Options->m_LogfilePulsarEvolutionRecordTypes) + ")").c_str())
         )
         (
             "logfile-rlof-parameters-record-types",                                 
             po::value<int>(&p_Options->m_LogfileRLOFParametersRecordTypes)->default_value(p_Options->m_LogfileRLOFParametersRecordTypes),                                                                      
-            ("Enabled record types for BSE RLOF Parameters logfile ( default = " + std::to_string(p_Options->m_LogfileRLOFParametersRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for BSE RLOF Parameters logfile ( default = " + std::to_string(p_Options->m_LogfileRLOFParametersRecordTypes) + ")").c_str())
         )
         (
             "logfile-supernovae-record-types",                                      
             po::value<int>(&p_Options->m_LogfileSupernovaeRecordTypes)->default_value(p_Options->m_LogfileSupernovaeRecordTypes),                                                                              
-            ("Enabled record types for Supernovae logfile (default = " + std::to_string(p_Options->m_LogfileSupernovaeRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for Supernovae logfile (default = " + std::to_string(p_Options->m_LogfileSupernovaeRecordTypes) + ")").c_str())
         )
         (
             "logfile-system-parameters-record-types",                               
             po::value<int>(&p_Options->m_LogfileSystemParametersRecordTypes)->default_value(p_Options->m_LogfileSystemParametersRecordTypes),                                                                  
-            ("Enabled record types for System Parameters logfile (default = " + std::to_string(p_Options->m_LogfileSystemParametersRecordTypes) + ")").c_str()
+            DESCRIPTION(("Enabled record types for System Parameters logfile (default = " + std::to_string(p_Options->m_LogfileSystemParametersRecordTypes) + ")").c_str())
         )
         (
             "log-level",                                                   
             po::value<int>(&p_Options->m_LogLevel)->default_value(p_Options->m_LogLevel),                                                                                                         
-            ("Determines which print statements are included in the logfile (default = " + std::to_string(p_Options->m_LogLevel) + ")").c_str()
+            DESCRIPTION(("Determines which print statements are included in the logfile (default = " + std::to_string(p_Options->m_LogLevel) + ")").c_str())
         )
 
         (
             "maximum-number-timestep-iterations",                          
             po::value<int>(&p_Options->m_MaxNumberOfTimestepIterations)->default_value(p_Options->m_MaxNumberOfTimestepIterations),                                                               
-            ("Maximum number of timesteps to evolve binary before giving up (default = " + std::to_string(p_Options->m_MaxNumberOfTimestepIterations) + ")").c_str()
+            DESCRIPTION(("Maximum number of timesteps to evolve binary before giving up (default = " + std::to_string(p_Options->m_MaxNumberOfTimestepIterations) + ")").c_str())
         )
 
         (
             "number-of-systems,n",                                        
             po::value<int>(&p_Options->m_ObjectsToEvolve)->default_value(p_Options->m_ObjectsToEvolve),                                                                                                       
-            ("Specify the number of systems to simulate (SSE) (default = " + std::to_string(p_Options->m_ObjectsToEvolve) + ")").c_str()
+            DESCRIPTION(("Specify the number of systems to simulate (SSE) (default = " + std::to_string(p_Options->m_ObjectsToEvolve) + ")").c_str())
         )
 
 
@@ -949,541 +1028,551 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
         (
             "common-envelope-alpha",                                       
             po::value<double>(&p_Options->m_CommonEnvelopeAlpha)->default_value(p_Options->m_CommonEnvelopeAlpha),                                                                                
-            ("Common Envelope efficiency alpha (default = " + std::to_string(p_Options->m_CommonEnvelopeAlpha) + ")").c_str()
+            DESCRIPTION(("Common Envelope efficiency alpha (default = " + std::to_string(p_Options->m_CommonEnvelopeAlpha) + ")").c_str())
         )
         (
             "common-envelope-alpha-thermal",                               
             po::value<double>(&p_Options->m_CommonEnvelopeAlphaThermal)->default_value(p_Options->m_CommonEnvelopeAlphaThermal),                                                                  
-            ("Defined such that lambda = alpha_th * lambda_b + (1.0 - alpha_th) * lambda_g (default = " + std::to_string(p_Options->m_CommonEnvelopeAlphaThermal) + ")").c_str()
+            DESCRIPTION(("Defined such that lambda = alpha_th * lambda_b + (1.0 - alpha_th) * lambda_g (default = " + std::to_string(p_Options->m_CommonEnvelopeAlphaThermal) + ")").c_str())
         )
         (
             "common-envelope-lambda",                                      
             po::value<double>(&p_Options->m_CommonEnvelopeLambda)->default_value(p_Options->m_CommonEnvelopeLambda),                                                                              
-            ("Common Envelope lambda (default = " + std::to_string(p_Options->m_CommonEnvelopeLambda) + ")").c_str()
+            DESCRIPTION(("Common Envelope lambda (default = " + std::to_string(p_Options->m_CommonEnvelopeLambda) + ")").c_str())
         )
         (
             "common-envelope-lambda-multiplier",                           
             po::value<double>(&p_Options->m_CommonEnvelopeLambdaMultiplier)->default_value(p_Options->m_CommonEnvelopeLambdaMultiplier),                                                          
-            ("Multiply lambda by some constant (default = " + std::to_string(p_Options->m_CommonEnvelopeLambdaMultiplier) + ")").c_str()
+            DESCRIPTION(("Multiply lambda by some constant (default = " + std::to_string(p_Options->m_CommonEnvelopeLambdaMultiplier) + ")").c_str())
         )
         (
             "common-envelope-mass-accretion-constant",                     
             po::value<double>(&p_Options->m_CommonEnvelopeMassAccretionConstant)->default_value(p_Options->m_CommonEnvelopeMassAccretionConstant),                                                
-            ("Value of mass accreted by NS/BH, in Msol, during common envelope evolution, assuming all NS/BH accrete same amount of mass (common-envelope-mass-accretion-prescription CONSTANT). Ignored otherwise (default = " + std::to_string(p_Options->m_CommonEnvelopeMassAccretionConstant) + ")").c_str()
+            DESCRIPTION(("Value of mass accreted by NS/BH, in Msol, during common envelope evolution, assuming all NS/BH accrete same amount of mass (common-envelope-mass-accretion-prescription CONSTANT). Ignored otherwise (default = " + std::to_string(p_Options->m_CommonEnvelopeMassAccretionConstant) + ")").c_str())
         )
         (
             "common-envelope-mass-accretion-max",                          
             po::value<double>(&p_Options->m_CommonEnvelopeMassAccretionMax)->default_value(p_Options->m_CommonEnvelopeMassAccretionMax),                                                          
-            ("Maximum amount of mass accreted by NS/BHs, in Msol, during common envelope evolution in Msol (default = " + std::to_string(p_Options->m_CommonEnvelopeMassAccretionMax) + ")").c_str()
+            DESCRIPTION(("Maximum amount of mass accreted by NS/BHs, in Msol, during common envelope evolution in Msol (default = " + std::to_string(p_Options->m_CommonEnvelopeMassAccretionMax) + ")").c_str())
         )
         (
             "common-envelope-mass-accretion-min",                          
             po::value<double>(&p_Options->m_CommonEnvelopeMassAccretionMin)->default_value(p_Options->m_CommonEnvelopeMassAccretionMin),                                                          
-            ("Minimum amount of mass accreted by NS/BHs, in Msol, during common envelope evolution in Msol (default = " + std::to_string(p_Options->m_CommonEnvelopeMassAccretionMin) + ")").c_str()
+            DESCRIPTION(("Minimum amount of mass accreted by NS/BHs, in Msol, during common envelope evolution in Msol (default = " + std::to_string(p_Options->m_CommonEnvelopeMassAccretionMin) + ")").c_str())
         )
         (
             "common-envelope-recombination-energy-density",                
             po::value<double>(&p_Options->m_CommonEnvelopeRecombinationEnergyDensity)->default_value(p_Options->m_CommonEnvelopeRecombinationEnergyDensity),                                      
-            ("Recombination energy density, in erg/g (default = " + std::to_string(p_Options->m_CommonEnvelopeRecombinationEnergyDensity) + ")").c_str()
+            DESCRIPTION(("Recombination energy density, in erg/g (default = " + std::to_string(p_Options->m_CommonEnvelopeRecombinationEnergyDensity) + ")").c_str())
         )
         (
             "common-envelope-slope-kruckow",                               
             po::value<double>(&p_Options->m_CommonEnvelopeSlopeKruckow)->default_value(p_Options->m_CommonEnvelopeSlopeKruckow),                                                                  
-            ("Common Envelope slope for Kruckow lambda (default = " + std::to_string(p_Options->m_CommonEnvelopeSlopeKruckow) + ")").c_str()
+            DESCRIPTION(("Common Envelope slope for Kruckow lambda (default = " + std::to_string(p_Options->m_CommonEnvelopeSlopeKruckow) + ")").c_str())
         )
         (
             "convective-envelope-temperature-threshold",                               
             po::value<double>(&p_Options->m_ConvectiveEnvelopeTemperatureThreshold)->default_value(p_Options->m_ConvectiveEnvelopeTemperatureThreshold),                                                                  
-            ("Temperature [K] threshold, below which the envelopes of giants are convective. Only used for --envelope-state-prescription = FIXED_TEMPERATURE, ignored otherwise. (default = " + std::to_string(p_Options->m_ConvectiveEnvelopeTemperatureThreshold) + ")").c_str()
+            DESCRIPTION(("Temperature [K] threshold, below which the envelopes of giants are convective. Only used for --envelope-state-prescription = FIXED_TEMPERATURE, ignored otherwise. (default = " + std::to_string(p_Options->m_ConvectiveEnvelopeTemperatureThreshold) + ")").c_str())
         )
         (
             "cool-wind-mass-loss-multiplier",                           
             po::value<double>(&p_Options->m_CoolWindMassLossMultiplier)->default_value(p_Options->m_CoolWindMassLossMultiplier),                                                                  
-            ("Multiplicative constant for wind mass loss of cool stars (default = " + std::to_string(p_Options->m_CoolWindMassLossMultiplier)+ ")").c_str()
+            DESCRIPTION(("Multiplicative constant for wind mass loss of cool stars (default = " + std::to_string(p_Options->m_CoolWindMassLossMultiplier)+ ")").c_str())
         )
         (
             "critical-mass-ratio-giant-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioGiantDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioGiantDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a giant star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioGiantDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a giant star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioGiantDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-giant-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioGiantNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioGiantNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a giant star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioGiantNonDegenerateAccretor) + ", which triggers a call to a function of the core mass ratio [Claeys+2014]).\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()  
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a giant star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioGiantNonDegenerateAccretor) + ", which triggers a call to a function of the core mass ratio [Claeys+2014]).\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-helium-giant-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHeliumGiantDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHeliumGiantDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a helium giant star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumGiantDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a helium giant star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumGiantDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-helium-giant-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHeliumGiantNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHeliumGiantNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a helium giant star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumGiantNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a helium giant star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumGiantNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-helium-HG-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHeliumHGDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHeliumHGDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a helium HG star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumHGDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a helium HG star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumHGDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-helium-HG-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHeliumHGNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHeliumHGNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a helium HG star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumHGNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a helium HG star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumHGNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-helium-MS-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHeliumMSDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHeliumMSDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a helium MS star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumMSDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a helium MS star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumMSDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-helium-MS-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHeliumMSNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHeliumMSNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a helium MS star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumMSNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a helium MS star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHeliumMSNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-HG-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHGDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHGDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a HG star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHGDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a HG star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHGDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-HG-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioHGNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioHGNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a HG star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHGNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a HG star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioHGNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-MS-high-mass-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioMSHighMassDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioMSHighMassDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a MS star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSHighMassDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a MS star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSHighMassDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-MS-high-mass-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioMSHighMassNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioMSHighMassNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a MS star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSHighMassNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a MS star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSHighMassNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-MS-low-mass-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioMSLowMassDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioMSLowMassDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a MS star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSLowMassDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a MS star to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSLowMassDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-MS-low-mass-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioMSLowMassNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioMSLowMassNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a MS star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSLowMassNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a MS star to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioMSLowMassNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-white-dwarf-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioWhiteDwarfDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioWhiteDwarfDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a white dwarf to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioWhiteDwarfDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a white dwarf to a degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioWhiteDwarfDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
         (
             "critical-mass-ratio-white-dwarf-non-degenerate-accretor",
             po::value<double>(&p_Options->m_MassTransferCriticalMassRatioWhiteDwarfNonDegenerateAccretor)->default_value(p_Options->m_MassTransferCriticalMassRatioWhiteDwarfNonDegenerateAccretor),
-            ("Critical mass ratio (mA/mD) for MT from a white dwarf to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioWhiteDwarfNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str()
+            DESCRIPTION(("Critical mass ratio (mA/mD) for MT from a white dwarf to a non-degenerate accretor (default = " + std::to_string(p_Options->m_MassTransferCriticalMassRatioWhiteDwarfNonDegenerateAccretor) + ")\n  0 is always stable, <0 is disabled.\n  Only used for --critical-mass-ratio-prescription CLAEYS, ignored otherwise.").c_str())
         )
 
         (
             "eccentricity,e",                                            
             po::value<double>(&p_Options->m_Eccentricity)->default_value(p_Options->m_Eccentricity),                                                                
-            ("Eccentricity, e (default = " + std::to_string(p_Options->m_Eccentricity) + ")").c_str()
+            DESCRIPTION(("Eccentricity, e (default = " + std::to_string(p_Options->m_Eccentricity) + ")").c_str())
         )
         (
             "eccentricity-max",                                            
             po::value<double>(&p_Options->m_EccentricityDistributionMax)->default_value(p_Options->m_EccentricityDistributionMax),                                                                
-            ("Maximum eccentricity to generate (default = " + std::to_string(p_Options->m_EccentricityDistributionMax) + ")").c_str()
+            DESCRIPTION(("Maximum eccentricity to generate (default = " + std::to_string(p_Options->m_EccentricityDistributionMax) + ")").c_str())
         )
         (
             "eccentricity-min",                                            
             po::value<double>(&p_Options->m_EccentricityDistributionMin)->default_value(p_Options->m_EccentricityDistributionMin),                                                                
-            ("Minimum eccentricity to generate (default = " + std::to_string(p_Options->m_EccentricityDistributionMin) + ")").c_str()
+            DESCRIPTION(("Minimum eccentricity to generate (default = " + std::to_string(p_Options->m_EccentricityDistributionMin) + ")").c_str())
         )
         (
             "eddington-accretion-factor",                                  
             po::value<double>(&p_Options->m_EddingtonAccretionFactor)->default_value(p_Options->m_EddingtonAccretionFactor),                                                                      
-            ("Multiplication factor for eddington accretion for NS & BH, i.e. >1 is super-eddington and 0. is no accretion (default = " + std::to_string(p_Options->m_EddingtonAccretionFactor) + ")").c_str()
+            DESCRIPTION(("Multiplication factor for eddington accretion for NS & BH, i.e. >1 is super-eddington and 0. is no accretion (default = " + std::to_string(p_Options->m_EddingtonAccretionFactor) + ")").c_str())
+        )
+        (
+            "evolution-target-minimum-mass",
+            po::value<double>(&p_Options->m_EvolutionTargetMinimumMass)->default_value(p_Options->m_EvolutionTargetMinimumMass),
+            DESCRIPTION(("Stop evolving a binary once each star is a white dwarf or less massive than this, in Msol (0 = never stop, default = " + std::to_string(p_Options->m_EvolutionTargetMinimumMass) + ")").c_str())
         )
 
         (
             "fix-dimensionless-kick-magnitude",                            
             po::value<double>(&p_Options->m_FixedUK)->default_value(p_Options->m_FixedUK),                                                                                                        
-            ("Fix dimensionless kick magnitude uk to this value (default = " + std::to_string(p_Options->m_FixedUK) + ", -ve values false, +ve values true)").c_str()
+            DESCRIPTION(("Fix dimensionless kick magnitude uk to this value (default = " + std::to_string(p_Options->m_FixedUK) + ", -ve values false, +ve values true)").c_str())
         )
         (
             "fryer-22-fmix",                                        
             po::value<double>(&p_Options->m_Fryer22fmix)->default_value(p_Options->m_Fryer22fmix),                                                                                  
-            ("paramter describing the mixing growth time when using the 'FRYER2022' remnant mass distribution (default = " + std::to_string(p_Options->m_Fryer22fmix) + ")").c_str()
+            DESCRIPTION(("paramter describing the mixing growth time when using the 'FRYER2022' remnant mass distribution (default = " + std::to_string(p_Options->m_Fryer22fmix) + ")").c_str())
         )
         (
             "fryer-22-mcrit",                                        
             po::value<double>(&p_Options->m_Fryer22Mcrit)->default_value(p_Options->m_Fryer22Mcrit),                                                                                  
-            ("Critical CO core mass for black hole formation when using the 'FRYER2022' remnant mass distribution (default = " + std::to_string(p_Options->m_Fryer22Mcrit) + ")").c_str()
+            DESCRIPTION(("Critical CO core mass for black hole formation when using the 'FRYER2022' remnant mass distribution (default = " + std::to_string(p_Options->m_Fryer22Mcrit) + ")").c_str())
         )
 
+        (
+            "importance-sampling-exploration-fraction",
+            po::value<double>(&p_Options->m_ImportanceSamplingExplorationFraction)->default_value(p_Options->m_ImportanceSamplingExplorationFraction),
+            DESCRIPTION(("Fraction of binaries drawn from the prior once the importance sampling proposal has been fitted (default = " + std::to_string(p_Options->m_ImportanceSamplingExplorationFraction) + ")").c_str())
+        )
         (
             "initial-mass",                                            
             po::value<double>(&p_Options->m_InitialMass)->default_value(p_Options->m_InitialMass),                                                                          
-            ("Initial mass (in Msol) for the star (SSE) (default = " + std::to_string(p_Options->m_InitialMass) + ")").c_str()
+            DESCRIPTION(("Initial mass (in Msol) for the star (SSE) (default = " + std::to_string(p_Options->m_InitialMass) + ")").c_str())
         )
         (
             "initial-mass-1",                                            
             po::value<double>(&p_Options->m_InitialMass1)->default_value(p_Options->m_InitialMass1),                                                                          
-            ("Initial mass (in Msol) for the primary star (BSE) (default = " + std::to_string(p_Options->m_InitialMass1) + ")").c_str()
+            DESCRIPTION(("Initial mass (in Msol) for the primary star (BSE) (default = " + std::to_string(p_Options->m_InitialMass1) + ")").c_str())
         )
         (
             "initial-mass-2",                                            
             po::value<double>(&p_Options->m_InitialMass2)->default_value(p_Options->m_InitialMass2),
-            ("Initial mass (in Msol) for the secondary star (BSE) (default = " + std::to_string(p_Options->m_InitialMass2) + ")").c_str()
+            DESCRIPTION(("Initial mass (in Msol) for the secondary star (BSE) (default = " + std::to_string(p_Options->m_InitialMass2) + ")").c_str())
         )
         (
             "initial-mass-max",                                            
             po::value<double>(&p_Options->m_InitialMassFunctionMax)->default_value(p_Options->m_InitialMassFunctionMax),                                                                          
-            ("Maximum mass (in Msol) to generate using given IMF (default = " + std::to_string(p_Options->m_InitialMassFunctionMax) + ")").c_str()
+            DESCRIPTION(("Maximum mass (in Msol) to generate using given IMF (default = " + std::to_string(p_Options->m_InitialMassFunctionMax) + ")").c_str())
         )
         (
             "initial-mass-min",                                            
             po::value<double>(&p_Options->m_InitialMassFunctionMin)->default_value(p_Options->m_InitialMassFunctionMin),                                                                          
-            ("Minimum mass (in Msol) to generate using given IMF (default = " + std::to_string(p_Options->m_InitialMassFunctionMin) + ")").c_str()
+            DESCRIPTION(("Minimum mass (in Msol) to generate using given IMF (default = " + std::to_string(p_Options->m_InitialMassFunctionMin) + ")").c_str())
         )
         (
             "initial-mass-power",                                          
             po::value<double>(&p_Options->m_InitialMassFunctionPower)->default_value(p_Options->m_InitialMassFunctionPower),                                                                      
-            ("Single power law power to generate primary mass using POWERLAW IMF (default = " + std::to_string(p_Options->m_InitialMassFunctionPower) + ")").c_str()
+            DESCRIPTION(("Single power law power to generate primary mass using POWERLAW IMF (default = " + std::to_string(p_Options->m_InitialMassFunctionPower) + ")").c_str())
         )
 
         (
             "kick-direction-power",                                        
             po::value<double>(&p_Options->m_KickDirectionPower)->default_value(p_Options->m_KickDirectionPower),                                                                                  
-            ("Power for power law kick direction distribution (default = " + std::to_string(p_Options->m_KickDirectionPower) + " = isotropic, +ve = polar, -ve = in plane)").c_str()
+            DESCRIPTION(("Power for power law kick direction distribution (default = " + std::to_string(p_Options->m_KickDirectionPower) + " = isotropic, +ve = polar, -ve = in plane)").c_str())
         )
         (
             "kick-magnitude",                                          
             po::value<double>(&p_Options->m_KickMagnitude)->default_value(p_Options->m_KickMagnitude),                                                      
-            ("The magnitude of the kick velocity, in km/s, that the star receives during the a supernova (default = " + std::to_string(p_Options->m_KickMagnitude) + ")").c_str()
+            DESCRIPTION(("The magnitude of the kick velocity, in km/s, that the star receives during the a supernova (default = " + std::to_string(p_Options->m_KickMagnitude) + ")").c_str())
         )
         (
             "kick-magnitude-1",                                          
             po::value<double>(&p_Options->m_KickMagnitude1)->default_value(p_Options->m_KickMagnitude1),                                                      
-            ("The magnitude of the kick velocity, in km/s, that the primary star receives during the a supernova (default = " + std::to_string(p_Options->m_KickMagnitude1) + ")").c_str()
+            DESCRIPTION(("The magnitude of the kick velocity, in km/s, that the primary star receives during the a supernova (default = " + std::to_string(p_Options->m_KickMagnitude1) + ")").c_str())
         )
         (
             "kick-magnitude-2",                                          
             po::value<double>(&p_Options->m_KickMagnitude2)->default_value(p_Options->m_KickMagnitude2),                                                      
-            ("The magnitude of the kick velocity, in km/s, that the secondary star receives during the a supernova (default = " + std::to_string(p_Options->m_KickMagnitude2) + ")").c_str()
+            DESCRIPTION(("The magnitude of the kick velocity, in km/s, that the secondary star receives during the a supernova (default = " + std::to_string(p_Options->m_KickMagnitude2) + ")").c_str())
         )
         (
             "kick-magnitude-max",                                          
             po::value<double>(&p_Options->m_KickMagnitudeDistributionMaximum)->default_value(p_Options->m_KickMagnitudeDistributionMaximum),                                                      
-            ("Maximum drawn kick magnitude in km/s. Ignored if < 0. Must be > 0 if using kick-magnitude-distribution=FLAT (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionMaximum) + ")").c_str()
+            DESCRIPTION(("Maximum drawn kick magnitude in km/s. Ignored if < 0. Must be > 0 if using kick-magnitude-distribution=FLAT (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionMaximum) + ")").c_str())
         )
         (
             "kick-magnitude-random",                                          
             po::value<double>(&p_Options->m_KickMagnitudeRandom)->default_value(p_Options->m_KickMagnitudeRandom),                                                      
-            "Number used to choose the kick velocity magnitude for the star during the a supernova (default = uniform random number [0.0, 1.0))"
+            DESCRIPTION("Number used to choose the kick velocity magnitude for the star during the a supernova (default = uniform random number [0.0, 1.0))")
         )
         (
             "kick-magnitude-random-1",                                          
             po::value<double>(&p_Options->m_KickMagnitudeRandom1)->default_value(p_Options->m_KickMagnitudeRandom1),                                                      
-            "Number used to choose the kick velocity magnitude for the primary star during the a supernova (default = uniform random number [0.0, 1.0))"
+            DESCRIPTION("Number used to choose the kick velocity magnitude for the primary star during the a supernova (default = uniform random number [0.0, 1.0))")
         )
         (
             "kick-magnitude-random-2",                                          
             po::value<double>(&p_Options->m_KickMagnitudeRandom2)->default_value(p_Options->m_KickMagnitudeRandom2),                                                      
-            "Number used to choose the kick velocity magnitude for the secondary during the a supernova (default = uniform random number [0.0, 1.0))"
+            DESCRIPTION("Number used to choose the kick velocity magnitude for the secondary during the a supernova (default = uniform random number [0.0, 1.0))")
         )
         (
             "kick-magnitude-sigma-CCSN-BH",                                
             po::value<double>(&p_Options->m_KickMagnitudeDistributionSigmaCCSN_BH)->default_value(p_Options->m_KickMagnitudeDistributionSigmaCCSN_BH),                                            
-            ("Sigma for chosen kick magnitude distribution, in km/s, for black holes (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaCCSN_BH) + ")").c_str()
+            DESCRIPTION(("Sigma for chosen kick magnitude distribution, in km/s, for black holes (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaCCSN_BH) + ")").c_str())
         )
         (
             "kick-magnitude-sigma-CCSN-NS",                                
             po::value<double>(&p_Options->m_KickMagnitudeDistributionSigmaCCSN_NS)->default_value(p_Options->m_KickMagnitudeDistributionSigmaCCSN_NS),                                            
-            ("Sigma for chosen kick magnitude distribution, in km/s, for neutron stars (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaCCSN_NS) + ")").c_str()
+            DESCRIPTION(("Sigma for chosen kick magnitude distribution, in km/s, for neutron stars (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaCCSN_NS) + ")").c_str())
         )
         (
             "kick-magnitude-sigma-ECSN",                                   
             po::value<double>(&p_Options->m_KickMagnitudeDistributionSigmaForECSN)->default_value(p_Options->m_KickMagnitudeDistributionSigmaForECSN),                                            
-            ("Sigma for chosen kick magnitude distribution, in km/s, for ECSN (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaForECSN) + ")").c_str()
+            DESCRIPTION(("Sigma for chosen kick magnitude distribution, in km/s, for ECSN (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaForECSN) + ")").c_str())
         )
         (
             "kick-magnitude-sigma-USSN",                                   
             po::value<double>(&p_Options->m_KickMagnitudeDistributionSigmaForUSSN)->default_value(p_Options->m_KickMagnitudeDistributionSigmaForUSSN),                                            
-            ("Sigma for chosen kick magnitude distribution, in km/s, for USSN (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaForUSSN) + ")").c_str()
+            DESCRIPTION(("Sigma for chosen kick magnitude distribution, in km/s, for USSN (default = " + std::to_string(p_Options->m_KickMagnitudeDistributionSigmaForUSSN) + ")").c_str())
         )
         (
             "kick-mean-anomaly-1",
             po::value<double>(&p_Options->m_KickMeanAnomaly1)->default_value(p_Options->m_KickMeanAnomaly1),                                                                                  
-            "Mean anomaly, in rad, for the primary star at instantaneous time of the supernova (default = uniform random number [0.0, 2pi))"
+            DESCRIPTION("Mean anomaly, in rad, for the primary star at instantaneous time of the supernova (default = uniform random number [0.0, 2pi))")
         )
         (
             "kick-mean-anomaly-2",
             po::value<double>(&p_Options->m_KickMeanAnomaly2)->default_value(p_Options->m_KickMeanAnomaly2),                                                                                  
-            "Mean anomaly, in rad, for the secondary star at instantaneous time of the supernova (default = uniform random number [0.0, 2pi))"
+            DESCRIPTION("Mean anomaly, in rad, for the secondary star at instantaneous time of the supernova (default = uniform random number [0.0, 2pi))")
         )
         (
             "kick-phi-1",
             po::value<double>(&p_Options->m_KickPhi1)->default_value(p_Options->m_KickPhi1),                                                                                  
-            "Planar angle, in rad, of the supernova vector, for the primary star (default = drawn from kick direction distribution)"
+            DESCRIPTION("Planar angle, in rad, of the supernova vector, for the primary star (default = drawn from kick direction distribution)")
         )
         (
             "kick-phi-2",
             po::value<double>(&p_Options->m_KickPhi2)->default_value(p_Options->m_KickPhi2),                                                                                  
-            "Planar angle, in rad, of the supernova vector, for the secondary star (default = drawn from kick direction distribution)"
+            DESCRIPTION("Planar angle, in rad, of the supernova vector, for the secondary star (default = drawn from kick direction distribution)")
         )
         (
             "kick-scaling-factor",                                         
             po::value<double>(&p_Options->m_KickScalingFactor)->default_value(p_Options->m_KickScalingFactor),                                                                                    
-            ("Arbitrary factor used to scale kicks (default = " + std::to_string(p_Options->m_KickScalingFactor) + ")").c_str()
+            DESCRIPTION(("Arbitrary factor used to scale kicks (default = " + std::to_string(p_Options->m_KickScalingFactor) + ")").c_str())
         )
         (
             "kick-theta-1",                                        
             po::value<double>(&p_Options->m_KickTheta1)->default_value(p_Options->m_KickTheta1),                                                                                  
-            "Polar angle, in rad, of the supernova vector, for the primary star (default = drawn from kick direction distribution)"
+            DESCRIPTION("Polar angle, in rad, of the supernova vector, for the primary star (default = drawn from kick direction distribution)")
         )
         (
             "kick-theta-2",                                        
             po::value<double>(&p_Options->m_KickTheta2)->default_value(p_Options->m_KickTheta2),                                                                                  
-            "Polar angle, in rad, of the supernova vector, for the secondary star (default = drawn from kick direction distribution)"
+            DESCRIPTION("Polar angle, in rad, of the supernova vector, for the secondary star (default = drawn from kick direction distribution)")
         )
 
         (
             "luminous-blue-variable-multiplier",                           
             po::value<double>(&p_Options->m_LuminousBlueVariableFactor)->default_value(p_Options->m_LuminousBlueVariableFactor),                                                                  
-            ("Multiplicitive constant for LBV mass loss (default = " + std::to_string(p_Options->m_LuminousBlueVariableFactor) + ", use 10 for Mennekens & Vanbeveren 2014)").c_str()
+            DESCRIPTION(("Multiplicitive constant for LBV mass loss (default = " + std::to_string(p_Options->m_LuminousBlueVariableFactor) + ", use 10 for Mennekens & Vanbeveren 2014)").c_str())
         )
 
         (
             "mass-ratio,q",                                              
             po::value<double>(&p_Options->m_MassRatio)->default_value(p_Options->m_MassRatio),                                                                      
-            ("Mass ratio m2/m1 used to determine secondary mass if not specified (default = " + std::to_string(p_Options->m_MassRatio) + ")").c_str()
+            DESCRIPTION(("Mass ratio m2/m1 used to determine secondary mass if not specified (default = " + std::to_string(p_Options->m_MassRatio) + ")").c_str())
         )
         (
             "mass-ratio-max",                                              
             po::value<double>(&p_Options->m_MassRatioDistributionMax)->default_value(p_Options->m_MassRatioDistributionMax),                                                                      
-            ("Maximum mass ratio m2/m1 to generate (default = " + std::to_string(p_Options->m_MassRatioDistributionMax) + ")").c_str()
+            DESCRIPTION(("Maximum mass ratio m2/m1 to generate (default = " + std::to_string(p_Options->m_MassRatioDistributionMax) + ")").c_str())
         )
         (
             "mass-ratio-min",                                              
             po::value<double>(&p_Options->m_MassRatioDistributionMin)->default_value(p_Options->m_MassRatioDistributionMin),                                                                      
-            ("Minimum mass ratio m2/m1 to generate (default = " + std::to_string(p_Options->m_MassRatioDistributionMin) + ")").c_str()
+            DESCRIPTION(("Minimum mass ratio m2/m1 to generate (default = " + std::to_string(p_Options->m_MassRatioDistributionMin) + ")").c_str())
         )
         (
             "mass-transfer-fa",                                            
             po::value<double>(&p_Options->m_MassTransferFractionAccreted)->default_value(p_Options->m_MassTransferFractionAccreted),                                                              
-            ("Mass Transfer fraction accreted in FIXED prescription (default = " + std::to_string(p_Options->m_MassTransferFractionAccreted) + ", fully conservative)").c_str()
+            DESCRIPTION(("Mass Transfer fraction accreted in FIXED prescription (default = " + std::to_string(p_Options->m_MassTransferFractionAccreted) + ", fully conservative)").c_str())
         )
         (
             "mass-transfer-jloss",                                         
             po::value<double>(&p_Options->m_MassTransferJloss)->default_value(p_Options->m_MassTransferJloss),                                                                                    
-            ("Fraction of specific angular momentum which non-accreted matter removes from the system (default = " + std::to_string(p_Options->m_MassTransferJloss) + ")").c_str()
+            DESCRIPTION(("Fraction of specific angular momentum which non-accreted matter removes from the system (default = " + std::to_string(p_Options->m_MassTransferJloss) + ")").c_str())
         )
         (
             "mass-transfer-jloss-macleod-linear-fraction",
             po::value<double>(&p_Options->m_MassTransferJlossMacLeodLinearFraction)->default_value(p_Options->m_MassTransferJlossMacLeodLinearFraction),                                                                                    
-            ("Interpolation fraction for jloss prescription if --mass-transfer-angular-momentum-loss-prescription=MACLEOD_LINEAR. 0 is gamma_acc, 1 is gamma_L2 (default = " + std::to_string(p_Options->m_MassTransferJlossMacLeodLinearFraction) + ")").c_str()
+            DESCRIPTION(("Interpolation fraction for jloss prescription if --mass-transfer-angular-momentum-loss-prescription=MACLEOD_LINEAR. 0 is gamma_acc, 1 is gamma_L2 (default = " + std::to_string(p_Options->m_MassTransferJlossMacLeodLinearFraction) + ")").c_str())
         )
         (
             "mass-transfer-thermal-limit-C",                               
             po::value<double>(&p_Options->m_MassTransferCParameter)->default_value(p_Options->m_MassTransferCParameter),                                                                          
-            ("Mass Transfer Thermal rate factor of the accretor (default = " + std::to_string(p_Options->m_MassTransferCParameter) + ")").c_str()
+            DESCRIPTION(("Mass Transfer Thermal rate factor of the accretor (default = " + std::to_string(p_Options->m_MassTransferCParameter) + ")").c_str())
         )
         (
             "maximum-evolution-time",                                      
             po::value<double>(&p_Options->m_MaxEvolutionTime)->default_value(p_Options->m_MaxEvolutionTime),                                                                                      
-            ("Maximum time to evolve binaries, in Myr (default = " + std::to_string(p_Options->m_MaxEvolutionTime) + ")").c_str()
+            DESCRIPTION(("Maximum time to evolve binaries, in Myr (default = " + std::to_string(p_Options->m_MaxEvolutionTime) + ")").c_str())
         )
         (
             "maximum-mass-donor-nandez-ivanova",                           
             po::value<double>(&p_Options->m_MaximumMassDonorNandezIvanova)->default_value(p_Options->m_MaximumMassDonorNandezIvanova),                                                            
-            ("Maximum donor mass, in Msol, allowed for the revised common envelope formalism in Msol (default = " + std::to_string(p_Options->m_MaximumMassDonorNandezIvanova) + ")").c_str()
+            DESCRIPTION(("Maximum donor mass, in Msol, allowed for the revised common envelope formalism in Msol (default = " + std::to_string(p_Options->m_MaximumMassDonorNandezIvanova) + ")").c_str())
         )
         (
             "maximum-neutron-star-mass",                                   
             po::value<double>(&p_Options->m_MaximumNeutronStarMass)->default_value(p_Options->m_MaximumNeutronStarMass),                                                                          
-            ("Maximum mass of a neutron star, in Msol (default = " + std::to_string(p_Options->m_MaximumNeutronStarMass) + ")").c_str()
+            DESCRIPTION(("Maximum mass of a neutron star, in Msol (default = " + std::to_string(p_Options->m_MaximumNeutronStarMass) + ")").c_str())
         )
         (
             "mcbur1",                                                      
             po::value<double>(&p_Options->m_mCBUR1)->default_value(p_Options->m_mCBUR1),                                                                                                          
-            ("Minimum core mass at BAGB, in Msol, to avoid fully degenerate CO core  (default = " + std::to_string(p_Options->m_mCBUR1) + ")").c_str()
+            DESCRIPTION(("Minimum core mass at BAGB, in Msol, to avoid fully degenerate CO core  (default = " + std::to_string(p_Options->m_mCBUR1) + ")").c_str())
         )
         (
             "metallicity,z",                                               
             po::value<double>(&p_Options->m_Metallicity)->default_value(p_Options->m_Metallicity),                                                                                                
-            ("Metallicity to use (default = " + std::to_string(p_Options->m_Metallicity) + ")").c_str()
+            DESCRIPTION(("Metallicity to use (default = " + std::to_string(p_Options->m_Metallicity) + ")").c_str())
         )
         (
             "metallicity-max",                                            
             po::value<double>(&p_Options->m_MetallicityDistributionMax)->default_value(p_Options->m_MetallicityDistributionMax),                                                                
-            ("Maximum metallicity to generate (default = " + std::to_string(p_Options->m_MetallicityDistributionMax) + ")").c_str()
+            DESCRIPTION(("Maximum metallicity to generate (default = " + std::to_string(p_Options->m_MetallicityDistributionMax) + ")").c_str())
         )
         (
             "metallicity-min",                                            
             po::value<double>(&p_Options->m_MetallicityDistributionMin)->default_value(p_Options->m_MetallicityDistributionMin),                                                                
-            ("Minimum metallicity to generate (default = " + std::to_string(p_Options->m_MetallicityDistributionMin) + ")").c_str()
+            DESCRIPTION(("Minimum metallicity to generate (default = " + std::to_string(p_Options->m_MetallicityDistributionMin) + ")").c_str())
         )
         (
             "minimum-secondary-mass",                                      
             po::value<double>(&p_Options->m_MinimumMassSecondary)->default_value(p_Options->m_MinimumMassSecondary),                                                                              
-            ("Minimum mass of secondary to generate, in Msol (default = " + std::to_string(p_Options->m_MinimumMassSecondary) + ")").c_str()
+            DESCRIPTION(("Minimum mass of secondary to generate, in Msol (default = " + std::to_string(p_Options->m_MinimumMassSecondary) + ")").c_str())
         )
         (
             "muller-mandel-kick-multiplier-BH",                                        
             po::value<double>(&p_Options->m_MullerMandelKickBH)->default_value(p_Options->m_MullerMandelKickBH),                                                                                  
-            ("Scaling prefactor for BH kicks when using the 'MULLERMANDEL' kick magnitude distribution (default = " + std::to_string(p_Options->m_MullerMandelKickBH) + ")").c_str()
+            DESCRIPTION(("Scaling prefactor for BH kicks when using the 'MULLERMANDEL' kick magnitude distribution (default = " + std::to_string(p_Options->m_MullerMandelKickBH) + ")").c_str())
         )
         (
             "muller-mandel-kick-multiplier-NS",                                        
             po::value<double>(&p_Options->m_MullerMandelKickNS)->default_value(p_Options->m_MullerMandelKickNS),                                                                                  
-            ("Scaling prefactor for NS kicks when using the 'MULLERMANDEL' kick magnitude distribution (default = " + std::to_string(p_Options->m_MullerMandelKickNS) + ")").c_str()
+            DESCRIPTION(("Scaling prefactor for NS kicks when using the 'MULLERMANDEL' kick magnitude distribution (default = " + std::to_string(p_Options->m_MullerMandelKickNS) + ")").c_str())
         )
         (
             "muller-mandel-sigma-kick",                                        
             po::value<double>(&p_Options->m_MullerMandelSigmaKick)->default_value(p_Options->m_MullerMandelSigmaKick),                                                                                  
-            ("Kick scatter when using the 'MULLERMANDEL' kick magnitude distribution (default = " + std::to_string(p_Options->m_MullerMandelSigmaKick) + ")").c_str()
+            DESCRIPTION(("Kick scatter when using the 'MULLERMANDEL' kick magnitude distribution (default = " + std::to_string(p_Options->m_MullerMandelSigmaKick) + ")").c_str())
         )
 
         (
             "neutrino-mass-loss-BH-formation-value",                       
             po::value<double>(&p_Options->m_NeutrinoMassLossValueBH)->default_value(p_Options->m_NeutrinoMassLossValueBH),                                                                        
-            ("Amount of BH mass lost due to neutrinos (either fraction or fixed value, depending on --neutrino-mass-loss-BH-formation) (default = " + std::to_string(p_Options->m_NeutrinoMassLossValueBH) + ")").c_str()
+            DESCRIPTION(("Amount of BH mass lost due to neutrinos (either fraction or fixed value, depending on --neutrino-mass-loss-BH-formation) (default = " + std::to_string(p_Options->m_NeutrinoMassLossValueBH) + ")").c_str())
         )
 
         (
             "orbital-period",                                          
             po::value<double>(&p_Options->m_OrbitalPeriod)->default_value(p_Options->m_OrbitalPeriod),                                                                            
-            ("Initial orbital period, in days (default = " + std::to_string(p_Options->m_OrbitalPeriod) + ")").c_str()
+            DESCRIPTION(("Initial orbital period, in days (default = " + std::to_string(p_Options->m_OrbitalPeriod) + ")").c_str())
         )
         (
             "orbital-period-max",                                          
             po::value<double>(&p_Options->m_OrbitalPeriodDistributionMax)->default_value(p_Options->m_OrbitalPeriodDistributionMax),                                                                            
-            ("Maximum period, in days, to generate (default = " + std::to_string(p_Options->m_OrbitalPeriodDistributionMax) + ")").c_str()
+            DESCRIPTION(("Maximum period, in days, to generate (default = " + std::to_string(p_Options->m_OrbitalPeriodDistributionMax) + ")").c_str())
         )
         (
             "orbital-period-min",                                          
             po::value<double>(&p_Options->m_OrbitalPeriodDistributionMin)->default_value(p_Options->m_OrbitalPeriodDistributionMin),                                                                            
-            ("Minimum period, in days, to generate (default = " + std::to_string(p_Options->m_OrbitalPeriodDistributionMin) + ")").c_str()
+            DESCRIPTION(("Minimum period, in days, to generate (default = " + std::to_string(p_Options->m_OrbitalPeriodDistributionMin) + ")").c_str())
         )
         (
             "overall-wind-mass-loss-multiplier",                           
             po::value<double>(&p_Options->m_OverallWindMassLossMultiplier)->default_value(p_Options->m_OverallWindMassLossMultiplier),                                                                  
-            ("Multiplicitive constant for overall wind mass loss (default = " + std::to_string(p_Options->m_OverallWindMassLossMultiplier)+ ")").c_str()
+            DESCRIPTION(("Multiplicitive constant for overall wind mass loss (default = " + std::to_string(p_Options->m_OverallWindMassLossMultiplier)+ ")").c_str())
         )
 
         (
             "PISN-lower-limit",                                            
             po::value<double>(&p_Options->m_PairInstabilityLowerLimit)->default_value(p_Options->m_PairInstabilityLowerLimit),                                                                    
-            ("Minimum core mass for PISN, in Msol (default = " + std::to_string(p_Options->m_PairInstabilityLowerLimit) + ")").c_str()
+            DESCRIPTION(("Minimum core mass for PISN, in Msol (default = " + std::to_string(p_Options->m_PairInstabilityLowerLimit) + ")").c_str())
         )
         (
             "PISN-upper-limit",                                            
             po::value<double>(&p_Options->m_PairInstabilityUpperLimit)->default_value(p_Options->m_PairInstabilityUpperLimit),                                                                    
-            ("Maximum core mass for PISN, in Msol (default = " + std::to_string(p_Options->m_PairInstabilityUpperLimit) + ")").c_str()
+            DESCRIPTION(("Maximum core mass for PISN, in Msol (default = " + std::to_string(p_Options->m_PairInstabilityUpperLimit) + ")").c_str())
         )
         (
             "PPI-lower-limit",                                             
             po::value<double>(&p_Options->m_PulsationalPairInstabilityLowerLimit)->default_value(p_Options->m_PulsationalPairInstabilityLowerLimit),                                              
-            ("Minimum core mass for PPI, in Msol (default = " + std::to_string(p_Options->m_PulsationalPairInstabilityLowerLimit) + ")").c_str()
+            DESCRIPTION(("Minimum core mass for PPI, in Msol (default = " + std::to_string(p_Options->m_PulsationalPairInstabilityLowerLimit) + ")").c_str())
         )
         (
             "PPI-upper-limit",                                             
             po::value<double>(&p_Options->m_PulsationalPairInstabilityUpperLimit)->default_value(p_Options->m_PulsationalPairInstabilityUpperLimit),                                              
-            ("Maximum core mass for PPI, in Msol (default = " + std::to_string(p_Options->m_PulsationalPairInstabilityUpperLimit) + ")").c_str()
+            DESCRIPTION(("Maximum core mass for PPI, in Msol (default = " + std::to_string(p_Options->m_PulsationalPairInstabilityUpperLimit) + ")").c_str())
         )
         (
             "pulsar-birth-magnetic-field-distribution-max",                
             po::value<double>(&p_Options->m_PulsarBirthMagneticFieldDistributionMax)->default_value(p_Options->m_PulsarBirthMagneticFieldDistributionMax),                                        
-            ("Maximum pulsar birth magnetic field, in log10(Gauss) (default = " + std::to_string(p_Options->m_PulsarBirthMagneticFieldDistributionMax) + ")").c_str()
+            DESCRIPTION(("Maximum pulsar birth magnetic field, in log10(Gauss) (default = " + std::to_string(p_Options->m_PulsarBirthMagneticFieldDistributionMax) + ")").c_str())
         )
         (
             "pulsar-birth-magnetic-field-distribution-min",                
             po::value<double>(&p_Options->m_PulsarBirthMagneticFieldDistributionMin)->default_value(p_Options->m_PulsarBirthMagneticFieldDistributionMin),                                        
-            ("Minimum pulsar birth magnetic field, in log10(Gauss) (default = " + std::to_string(p_Options->m_PulsarBirthMagneticFieldDistributionMin) + ")").c_str()
+            DESCRIPTION(("Minimum pulsar birth magnetic field, in log10(Gauss) (default = " + std::to_string(p_Options->m_PulsarBirthMagneticFieldDistributionMin) + ")").c_str())
         )
         (
             "pulsar-birth-spin-period-distribution-max",                   
             po::value<double>(&p_Options->m_PulsarBirthSpinPeriodDistributionMax)->default_value(p_Options->m_PulsarBirthSpinPeriodDistributionMax),                                              
-            ("Maximum pulsar birth spin period, in ms (default = " + std::to_string(p_Options->m_PulsarBirthSpinPeriodDistributionMax) + ")").c_str()
+            DESCRIPTION(("Maximum pulsar birth spin period, in ms (default = " + std::to_string(p_Options->m_PulsarBirthSpinPeriodDistributionMax) + ")").c_str())
         )
         (
             "pulsar-birth-spin-period-distribution-min",                   
             po::value<double>(&p_Options->m_PulsarBirthSpinPeriodDistributionMin)->default_value(p_Options->m_PulsarBirthSpinPeriodDistributionMin),                                              
-            ("Minimum pulsar birth spin period, in ms (default = " + std::to_string(p_Options->m_PulsarBirthSpinPeriodDistributionMin) + ")").c_str()
+            DESCRIPTION(("Minimum pulsar birth spin period, in ms (default = " + std::to_string(p_Options->m_PulsarBirthSpinPeriodDistributionMin) + ")").c_str())
         )
         (
             "pulsar-magnetic-field-decay-massscale",                       
             po::value<double>(&p_Options->m_PulsarMagneticFieldDecayMassscale)->default_value(p_Options->m_PulsarMagneticFieldDecayMassscale),                                                    
-            ("Mass scale on which magnetic field decays during accretion, in Msol (default = " + std::to_string(p_Options->m_PulsarMagneticFieldDecayMassscale) + ")").c_str()
+            DESCRIPTION(("Mass scale on which magnetic field decays during accretion, in Msol (default = " + std::to_string(p_Options->m_PulsarMagneticFieldDecayMassscale) + ")").c_str())
         )
         (
             "pulsar-magnetic-field-decay-timescale",                       
             po::value<double>(&p_Options->m_PulsarMagneticFieldDecayTimescale)->default_value(p_Options->m_PulsarMagneticFieldDecayTimescale),                                                    
-            ("Timescale on which magnetic field decays, in Myrs (default = " + std::to_string(p_Options->m_PulsarMagneticFieldDecayTimescale) + ")").c_str()
+            DESCRIPTION(("Timescale on which magnetic field decays, in Myrs (default = " + std::to_string(p_Options->m_PulsarMagneticFieldDecayTimescale) + ")").c_str())
         )
         (
             "pulsar-minimum-magnetic-field",                               
             po::value<double>(&p_Options->m_PulsarLog10MinimumMagneticField)->default_value(p_Options->m_PulsarLog10MinimumMagneticField),                                                        
-            ("Minimum pulsar magnetic field, in log10(Gauss) (default = " + std::to_string(p_Options->m_PulsarLog10MinimumMagneticField) + ")").c_str()
+            DESCRIPTION(("Minimum pulsar magnetic field, in log10(Gauss) (default = " + std::to_string(p_Options->m_PulsarLog10MinimumMagneticField) + ")").c_str())
         )
 
         (
             "rotational-frequency",                              
             po::value<double>(&p_Options->m_RotationalFrequency)->default_value(p_Options->m_RotationalFrequency),                                                        
-            ("Initial rotational frequency for the star for SSE (Hz) (default = " + std::to_string(p_Options->m_RotationalFrequency) + ")").c_str()
+            DESCRIPTION(("Initial rotational frequency for the star for SSE (Hz) (default = " + std::to_string(p_Options->m_RotationalFrequency) + ")").c_str())
         )        
         (
             "rotational-frequency-1",                              
             po::value<double>(&p_Options->m_RotationalFrequency1)->default_value(p_Options->m_RotationalFrequency1),                                                        
-            ("Initial rotational frequency for the primary star for BSE (Hz) (default = " + std::to_string(p_Options->m_RotationalFrequency1) + ")").c_str()
+            DESCRIPTION(("Initial rotational frequency for the primary star for BSE (Hz) (default = " + std::to_string(p_Options->m_RotationalFrequency1) + ")").c_str())
         )        
         (
             "rotational-frequency-2",                              
             po::value<double>(&p_Options->m_RotationalFrequency2)->default_value(p_Options->m_RotationalFrequency2),                                                        
-            ("Initial rotational frequency for the secondary star for BSE (Hz) (default = " + std::to_string(p_Options->m_RotationalFrequency2) + ")").c_str()
+            DESCRIPTION(("Initial rotational frequency for the secondary star for BSE (Hz) (default = " + std::to_string(p_Options->m_RotationalFrequency2) + ")").c_str())
         )        
 
         (
             "semi-major-axis,a",                              
             po::value<double>(&p_Options->m_SemiMajorAxis)->default_value(p_Options->m_SemiMajorAxis),                                                        
-            ("Initial semi-major axis, in AU (default = " + std::to_string(p_Options->m_SemiMajorAxis) + ")").c_str()
+            DESCRIPTION(("Initial semi-major axis, in AU (default = " + std::to_string(p_Options->m_SemiMajorAxis) + ")").c_str())
         )        
         (
             "semi-major-axis-max",                                         
             po::value<double>(&p_Options->m_SemiMajorAxisDistributionMax)->default_value(p_Options->m_SemiMajorAxisDistributionMax),                                                              
-            ("Maximum semi-major axis, in AU, to generate (default = " + std::to_string(p_Options->m_SemiMajorAxisDistributionMax) + ")").c_str()
+            DESCRIPTION(("Maximum semi-major axis, in AU, to generate (default = " + std::to_string(p_Options->m_SemiMajorAxisDistributionMax) + ")").c_str())
         )
         (
             "semi-major-axis-min",                                         
             po::value<double>(&p_Options->m_SemiMajorAxisDistributionMin)->default_value(p_Options->m_SemiMajorAxisDistributionMin),                                                              
-            ("Minimum semi-major axis, in AU, to generate (default = " + std::to_string(p_Options->m_SemiMajorAxisDistributionMin) + ")").c_str()
+            DESCRIPTION(("Minimum semi-major axis, in AU, to generate (default = " + std::to_string(p_Options->m_SemiMajorAxisDistributionMin) + ")").c_str())
         )
 
         (
             "timestep-multiplier",
             po::value<double>(&p_Options->m_TimestepMultiplier)->default_value(p_Options->m_TimestepMultiplier),
-            ("Timestep multiplier for SSE and BSE (default = " + std::to_string(p_Options->m_TimestepMultiplier) + ")").c_str()
+            DESCRIPTION(("Timestep multiplier for SSE and BSE (default = " + std::to_string(p_Options->m_TimestepMultiplier) + ")").c_str())
         )
 
         (
             "wolf-rayet-multiplier",                                       
             po::value<double>(&p_Options->m_WolfRayetFactor)->default_value(p_Options->m_WolfRayetFactor),                                                                                        
-            ("Multiplicitive constant for WR winds (default = " + std::to_string(p_Options->m_WolfRayetFactor) + ")").c_str()
+            DESCRIPTION(("Multiplicitive constant for WR winds (default = " + std::to_string(p_Options->m_WolfRayetFactor) + ")").c_str())
         )
 
         (
             "zeta-adiabatic-arbitrary",                                    
             po::value<double>(&p_Options->m_ZetaAdiabaticArbitrary)->default_value(p_Options->m_ZetaAdiabaticArbitrary),                                                                          
-            ("Value of mass-radius exponent zeta adiabatic (default = " + std::to_string(p_Options->m_ZetaAdiabaticArbitrary) + ")").c_str()
+            DESCRIPTION(("Value of mass-radius exponent zeta adiabatic (default = " + std::to_string(p_Options->m_ZetaAdiabaticArbitrary) + ")").c_str())
         )
         (
             "zeta-main-sequence",                                          
             po::value<double>(&p_Options->m_ZetaMainSequence)->default_value(p_Options->m_ZetaMainSequence),                                                                                      
-            ("Value of mass-radius exponent zeta on the main sequence (default = " + std::to_string(p_Options->m_ZetaMainSequence) + ")").c_str()
+            DESCRIPTION(("Value of mass-radius exponent zeta on the main sequence (default = " + std::to_string(p_Options->m_ZetaMainSequence) + ")").c_str())
         )
         (
             "zeta-radiative-envelope-giant",                               
             po::value<double>(&p_Options->m_ZetaRadiativeEnvelopeGiant)->default_value(p_Options->m_ZetaRadiativeEnvelopeGiant),                                                                  
-            ("Value of mass-radius exponent zeta for radiative envelope giants (default = " + std::to_string(p_Options->m_ZetaRadiativeEnvelopeGiant) + ")").c_str()
+            DESCRIPTION(("Value of mass-radius exponent zeta for radiative envelope giants (default = " + std::to_string(p_Options->m_ZetaRadiativeEnvelopeGiant) + ")").c_str())
         )
 
 
@@ -1492,270 +1581,286 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
         (
             "add-options-to-sysparms",                                            
             po::value<std::string>(&p_Options->m_AddOptionsToSysParms.typeString)->default_value(p_Options->m_AddOptionsToSysParms.typeString),                                                                              
-            ("Add program options columns to BSE/SSE SysParms file (" + AllowedOptionValuesFormatted("add-options-to-sysparms") + ", default = '" + p_Options->m_AddOptionsToSysParms.typeString + "')").c_str()
+            DESCRIPTION(("Add program options columns to BSE/SSE SysParms file (" + AllowedOptionValuesFormatted("add-options-to-sysparms") + ", default = '" + p_Options->m_AddOptionsToSysParms.typeString + "')").c_str())
         )
 
         (
             "black-hole-kicks",                                            
             po::value<std::string>(&p_Options->m_BlackHoleKicks.typeString)->default_value(p_Options->m_BlackHoleKicks.typeString),                                                                              
-            ("Black hole kicks relative to NS kicks (" + AllowedOptionValuesFormatted("black-hole-kicks") + ", default = '" + p_Options->m_BlackHoleKicks.typeString + "')").c_str()
+            DESCRIPTION(("Black hole kicks relative to NS kicks (" + AllowedOptionValuesFormatted("black-hole-kicks") + ", default = '" + p_Options->m_BlackHoleKicks.typeString + "')").c_str())
         )
 
         (
             "case-BB-stability-prescription",                              
             po::value<std::string>(&p_Options->m_CaseBBStabilityPrescription.typeString)->default_value(p_Options->m_CaseBBStabilityPrescription.typeString),                                                    
-            ("Case BB/BC mass transfer stability prescription (" + AllowedOptionValuesFormatted("case-BB-stability-prescription") + ", default = '" + p_Options->m_CaseBBStabilityPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Case BB/BC mass transfer stability prescription (" + AllowedOptionValuesFormatted("case-BB-stability-prescription") + ", default = '" + p_Options->m_CaseBBStabilityPrescription.typeString + "')").c_str())
         )
         (
             "chemically-homogeneous-evolution",                            
             po::value<std::string>(&p_Options->m_CheMode.typeString)->default_value(p_Options->m_CheMode.typeString),                                                                                                    
-            ("Chemically Homogeneous Evolution (" + AllowedOptionValuesFormatted("chemically-homogeneous-evolution") + ", default = '" + p_Options->m_CheMode.typeString + "')").c_str()
+            DESCRIPTION(("Chemically Homogeneous Evolution (" + AllowedOptionValuesFormatted("chemically-homogeneous-evolution") + ", default = '" + p_Options->m_CheMode.typeString + "')").c_str())
         )
         (
             "common-envelope-formalism",
             po::value<std::string>(&p_Options->m_CommonEnvelopeFormalism.typeString)->default_value(p_Options->m_CommonEnvelopeFormalism.typeString),
-            ("Common envelope formalism (" + AllowedOptionValuesFormatted("common-envelope-formalism") + ", default = '" + p_Options->m_CommonEnvelopeFormalism.typeString + "')").c_str()
+            DESCRIPTION(("Common envelope formalism (" + AllowedOptionValuesFormatted("common-envelope-formalism") + ", default = '" + p_Options->m_CommonEnvelopeFormalism.typeString + "')").c_str())
         )
         (
             "common-envelope-lambda-prescription",                         
             po::value<std::string>(&p_Options->m_CommonEnvelopeLambdaPrescription.typeString)->default_value(p_Options->m_CommonEnvelopeLambdaPrescription.typeString),                                          
-            ("CE lambda prescription (" + AllowedOptionValuesFormatted("common-envelope-lambda-prescription") + ", default = '" + p_Options->m_CommonEnvelopeLambdaPrescription.typeString + "')").c_str()
+            DESCRIPTION(("CE lambda prescription (" + AllowedOptionValuesFormatted("common-envelope-lambda-prescription") + ", default = '" + p_Options->m_CommonEnvelopeLambdaPrescription.typeString + "')").c_str())
         )
         (
             "common-envelope-mass-accretion-prescription",                 
             po::value<std::string>(&p_Options->m_CommonEnvelopeMassAccretionPrescription.typeString)->default_value(p_Options->m_CommonEnvelopeMassAccretionPrescription.typeString),                            
-            ("Assumption about whether NS/BHs can accrete mass during common envelope evolution (" + AllowedOptionValuesFormatted("common-envelope-mass-accretion-prescription") + ", default = '" + p_Options->m_CommonEnvelopeMassAccretionPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Assumption about whether NS/BHs can accrete mass during common envelope evolution (" + AllowedOptionValuesFormatted("common-envelope-mass-accretion-prescription") + ", default = '" + p_Options->m_CommonEnvelopeMassAccretionPrescription.typeString + "')").c_str())
         )
         (
             "create-YAML-file",                           
             po::value<std::string>(&p_Options->m_YAMLfilename)->default_value(p_Options->m_YAMLfilename),                                                                  
-            ("Create YAML file (default = " + p_Options->m_YAMLfilename + ")").c_str()
+            DESCRIPTION(("Create YAML file (default = " + p_Options->m_YAMLfilename + ")").c_str())
         )
         (
             "critical-mass-ratio-prescription",                                 
             po::value<std::string>(&p_Options->m_QCritPrescription.typeString)->default_value(p_Options->m_QCritPrescription.typeString),
-            ("Prescription for which critical mass ratio prescription to use, if any (" + AllowedOptionValuesFormatted("critical-mass-ratio-prescription") + ", default = '" + p_Options->m_QCritPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Prescription for which critical mass ratio prescription to use, if any (" + AllowedOptionValuesFormatted("critical-mass-ratio-prescription") + ", default = '" + p_Options->m_QCritPrescription.typeString + "')").c_str())
         )
         
         (
             "eccentricity-distribution",                                 
             po::value<std::string>(&p_Options->m_EccentricityDistribution.typeString)->default_value(p_Options->m_EccentricityDistribution.typeString),                                                          
-            ("Initial eccentricity distribution (" + AllowedOptionValuesFormatted("eccentricity-distribution") + ", default = '" + p_Options->m_EccentricityDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Initial eccentricity distribution (" + AllowedOptionValuesFormatted("eccentricity-distribution") + ", default = '" + p_Options->m_EccentricityDistribution.typeString + "')").c_str())
         )
         (
             "envelope-state-prescription",                                 
             po::value<std::string>(&p_Options->m_EnvelopeStatePrescription.typeString)->default_value(p_Options->m_EnvelopeStatePrescription.typeString),                                                        
-            ("Prescription for whether the envelope is radiative or convective (" + AllowedOptionValuesFormatted("envelope-state-prescription") + ", default = '" + p_Options->m_EnvelopeStatePrescription.typeString + "')").c_str()
+            DESCRIPTION(("Prescription for whether the envelope is radiative or convective (" + AllowedOptionValuesFormatted("envelope-state-prescription") + ", default = '" + p_Options->m_EnvelopeStatePrescription.typeString + "')").c_str())
+        )
+        (
+            "evolution-target",
+            po::value<std::string>(&p_Options->m_EvolutionTarget.typeString)->default_value(p_Options->m_EvolutionTarget.typeString),
+            DESCRIPTION(("Stop evolving binaries that can no longer reach this target (" + AllowedOptionValuesFormatted("evolution-target") + ", default = '" + p_Options->m_EvolutionTarget.typeString + "')").c_str())
         )
 
         (
             "fryer-supernova-engine",                                      
             po::value<std::string>(&p_Options->m_FryerSupernovaEngine.typeString)->default_value(p_Options->m_FryerSupernovaEngine.typeString),                                                                  
-            ("If using Fryer et al 2012 fallback prescription (" + AllowedOptionValuesFormatted("fryer-supernova-engine") + ", default = '" + p_Options->m_FryerSupernovaEngine.typeString + "')").c_str()
+            DESCRIPTION(("If using Fryer et al 2012 fallback prescription (" + AllowedOptionValuesFormatted("fryer-supernova-engine") + ", default = '" + p_Options->m_FryerSupernovaEngine.typeString + "')").c_str())
         )
 
         (
             "grid",                                                        
             po::value<std::string>(&p_Options->m_GridFilename)->default_value(p_Options->m_GridFilename)->implicit_value(""),
-            ("Grid filename (default = " + p_Options->m_GridFilename + ")").c_str()
+            DESCRIPTION(("Grid filename (default = " + p_Options->m_GridFilename + ")").c_str())
+        )
+
+        (
+            "hdf5-compression",
+            po::value<std::string>(&p_Options->m_HDF5Compression.typeString)->default_value(p_Options->m_HDF5Compression.typeString),
+            DESCRIPTION(("HDF5 file dataset compression (" + AllowedOptionValuesFormatted("hdf5-compression") + ", default = '" + p_Options->m_HDF5Compression.typeString + "')").c_str())
         )
 
         (
             "initial-mass-function,i",                                     
             po::value<std::string>(&p_Options->m_InitialMassFunction.typeString)->default_value(p_Options->m_InitialMassFunction.typeString),                                                                    
-            ("Initial mass function (" + AllowedOptionValuesFormatted("initial-mass-function") + ", default = '" + p_Options->m_InitialMassFunction.typeString + "')").c_str()
+            DESCRIPTION(("Initial mass function (" + AllowedOptionValuesFormatted("initial-mass-function") + ", default = '" + p_Options->m_InitialMassFunction.typeString + "')").c_str())
         )
 
         (
             "kick-direction",                                              
             po::value<std::string>(&p_Options->m_KickDirectionDistribution.typeString)->default_value(p_Options->m_KickDirectionDistribution.typeString),                                                        
-            ("Natal kick direction distribution (" + AllowedOptionValuesFormatted("kick-direction") + ", default = '" + p_Options->m_KickDirectionDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Natal kick direction distribution (" + AllowedOptionValuesFormatted("kick-direction") + ", default = '" + p_Options->m_KickDirectionDistribution.typeString + "')").c_str())
         )
         (
             "kick-magnitude-distribution",                                 
             po::value<std::string>(&p_Options->m_KickMagnitudeDistribution.typeString)->default_value(p_Options->m_KickMagnitudeDistribution.typeString),                                                        
-            ("Natal kick magnitude distribution (" + AllowedOptionValuesFormatted("kick-magnitude-distribution") + ", default = '" + p_Options->m_KickMagnitudeDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Natal kick magnitude distribution (" + AllowedOptionValuesFormatted("kick-magnitude-distribution") + ", default = '" + p_Options->m_KickMagnitudeDistribution.typeString + "')").c_str())
         )
 
         /*
         (
             "logfile-BE-binaries",                                     
             po::value<std::string>(&p_Options->m_LogfileBeBinaries)->default_value(p_Options->m_LogfileBeBinaries),                                                                              
-            ("Filename for BSE Be Binaries logfile (default = " + p_Options->m_LogfileBeBinaries + ")").c_str()
+            DESCRIPTION(("Filename for BSE Be Binaries logfile (default = " + p_Options->m_LogfileBeBinaries + ")").c_str())
         )
         */
 
         (
             "logfile-rlof-parameters",                                 
             po::value<std::string>(&p_Options->m_LogfileRLOFParameters)->default_value(p_Options->m_LogfileRLOFParameters),                                                                      
-            ("Filename for BSE RLOF Parameters logfile ( default = " + p_Options->m_LogfileRLOFParameters + ")").c_str()
+            DESCRIPTION(("Filename for BSE RLOF Parameters logfile ( default = " + p_Options->m_LogfileRLOFParameters + ")").c_str())
         )
         (
             "logfile-common-envelopes",                                
             po::value<std::string>(&p_Options->m_LogfileCommonEnvelopes)->default_value(p_Options->m_LogfileCommonEnvelopes),                                                                    
-            ("Filename for BSE Common Envelopes logfile (default = " + p_Options->m_LogfileCommonEnvelopes + ")").c_str()
+            DESCRIPTION(("Filename for BSE Common Envelopes logfile (default = " + p_Options->m_LogfileCommonEnvelopes + ")").c_str())
         )
         (
             "logfile-detailed-output",                                 
             po::value<std::string>(&p_Options->m_LogfileDetailedOutput)->default_value(p_Options->m_LogfileDetailedOutput),                                                                      
-            ("Filename for BSE Detailed Output logfile (default = " + p_Options->m_LogfileDetailedOutput + ")").c_str()
+            DESCRIPTION(("Filename for BSE Detailed Output logfile (default = " + p_Options->m_LogfileDetailedOutput + ")").c_str())
         )
         (
             "logfile-double-compact-objects",                          
             po::value<std::string>(&p_Options->m_LogfileDoubleCompactObjects)->default_value(p_Options->m_LogfileDoubleCompactObjects),                                                          
-            ("Filename for Double Compact Objects logfile (default = " + p_Options->m_LogfileDoubleCompactObjects + ")").c_str()
+            DESCRIPTION(("Filename for Double Compact Objects logfile (default = " + p_Options->m_LogfileDoubleCompactObjects + ")").c_str())
         )
         (
             "logfile-pulsar-evolution",                                
             po::value<std::string>(&p_Options->m_LogfilePulsarEvolution)->default_value(p_Options->m_LogfilePulsarEvolution),                                                                    
-            ("Filename for Pulsar Evolution logfile (default = " + p_Options->m_LogfilePulsarEvolution + ")").c_str()
+            DESCRIPTION(("Filename for Pulsar Evolution logfile (default = " + p_Options->m_LogfilePulsarEvolution + ")").c_str())
         )
         (
             "logfile-supernovae",                                      
             po::value<std::string>(&p_Options->m_LogfileSupernovae)->default_value(p_Options->m_LogfileSupernovae),                                                                              
-            ("Filename for Supernovae logfile (default = " + p_Options->m_LogfileSupernovae + ")").c_str()
+            DESCRIPTION(("Filename for Supernovae logfile (default = " + p_Options->m_LogfileSupernovae + ")").c_str())
         )
         (
             "logfile-system-parameters",                               
             po::value<std::string>(&p_Options->m_LogfileSystemParameters)->default_value(p_Options->m_LogfileSystemParameters),                                                                  
-            ("Filename for System Parameters logfile (default = " + p_Options->m_LogfileSystemParameters + ")").c_str()
+            DESCRIPTION(("Filename for System Parameters logfile (default = " + p_Options->m_LogfileSystemParameters + ")").c_str())
         )
         (
             "logfile-definitions",                                         
             po::value<std::string>(&p_Options->m_LogfileDefinitionsFilename)->default_value(p_Options->m_LogfileDefinitionsFilename)->implicit_value(""),                                              
-            ("Filename for logfile record definitions (default = " + p_Options->m_LogfileDefinitionsFilename + ")").c_str()
+            DESCRIPTION(("Filename for logfile record definitions (default = " + p_Options->m_LogfileDefinitionsFilename + ")").c_str())
+        )
+        (
+            "logfile-flush",
+            po::value<std::string>(&p_Options->m_LogfileFlush.typeString)->default_value(p_Options->m_LogfileFlush.typeString),
+            DESCRIPTION(("When to flush CSV, TSV and TXT logfiles (" + AllowedOptionValuesFormatted("logfile-flush") + ", default = '" + p_Options->m_LogfileFlush.typeString + "')").c_str())
         )
         (
             "logfile-name-prefix",                                         
             po::value<std::string>(&p_Options->m_LogfileNamePrefix)->default_value(p_Options->m_LogfileNamePrefix)->implicit_value(""),                                                                
-            ("Prefix for logfile names (default = " + p_Options->m_LogfileNamePrefix + ")").c_str()
+            DESCRIPTION(("Prefix for logfile names (default = " + p_Options->m_LogfileNamePrefix + ")").c_str())
         )
         (
             "logfile-switch-log",                                      
             po::value<std::string>(&p_Options->m_LogfileSwitchLog)->default_value(p_Options->m_LogfileSwitchLog),                                                                                
-            ("Filename for Switch Log logfile (default = " + p_Options->m_LogfileSwitchLog + ")").c_str()
+            DESCRIPTION(("Filename for Switch Log logfile (default = " + p_Options->m_LogfileSwitchLog + ")").c_str())
         )
         (
             "logfile-type",                                           
             po::value<std::string>(&p_Options->m_LogfileType.typeString)->default_value(p_Options->m_LogfileType.typeString),                                                                          
-            ("File type for logfiles (" + AllowedOptionValuesFormatted("logfile-type") + ", default = '" + p_Options->m_LogfileType.typeString + "')").c_str()
+            DESCRIPTION(("File type for logfiles (" + AllowedOptionValuesFormatted("logfile-type") + ", default = '" + p_Options->m_LogfileType.typeString + "')").c_str())
         )
         (
             "luminous-blue-variable-prescription",                                      
             po::value<std::string>(&p_Options->m_LuminousBlueVariablePrescription.typeString)->default_value(p_Options->m_LuminousBlueVariablePrescription.typeString),                                                                  
-            ("LBV Mass loss prescription (" + AllowedOptionValuesFormatted("luminous-blue-variable-prescription") + ", default = '" + p_Options->m_LuminousBlueVariablePrescription.typeString + "')").c_str()
+            DESCRIPTION(("LBV Mass loss prescription (" + AllowedOptionValuesFormatted("luminous-blue-variable-prescription") + ", default = '" + p_Options->m_LuminousBlueVariablePrescription.typeString + "')").c_str())
         )
 
         (
             "mass-loss-prescription",                                      
             po::value<std::string>(&p_Options->m_MassLossPrescription.typeString)->default_value(p_Options->m_MassLossPrescription.typeString),                                                                  
-            ("Mass loss prescription (" + AllowedOptionValuesFormatted("mass-loss-prescription") + ", default = '" + p_Options->m_MassLossPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Mass loss prescription (" + AllowedOptionValuesFormatted("mass-loss-prescription") + ", default = '" + p_Options->m_MassLossPrescription.typeString + "')").c_str())
         )
         (
             "mass-ratio-distribution",                                   
             po::value<std::string>(&p_Options->m_MassRatioDistribution.typeString)->default_value(p_Options->m_MassRatioDistribution.typeString),                                                                
-            ("Initial mass ratio distribution for q=m2/m1 (" + AllowedOptionValuesFormatted("mass-ratio-distribution") + ", default = '" + p_Options->m_MassRatioDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Initial mass ratio distribution for q=m2/m1 (" + AllowedOptionValuesFormatted("mass-ratio-distribution") + ", default = '" + p_Options->m_MassRatioDistribution.typeString + "')").c_str())
         )
         (
             "mass-transfer-accretion-efficiency-prescription",             
             po::value<std::string>(&p_Options->m_MassTransferAccretionEfficiencyPrescription.typeString)->default_value(p_Options->m_MassTransferAccretionEfficiencyPrescription.typeString),                    
-            ("Mass Transfer Accretion Efficiency prescription (" + AllowedOptionValuesFormatted("mass-transfer-accretion-efficiency-prescription") + ", default = '" + p_Options->m_MassTransferAccretionEfficiencyPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Mass Transfer Accretion Efficiency prescription (" + AllowedOptionValuesFormatted("mass-transfer-accretion-efficiency-prescription") + ", default = '" + p_Options->m_MassTransferAccretionEfficiencyPrescription.typeString + "')").c_str())
         )
         (
             "mass-transfer-angular-momentum-loss-prescription",            
             po::value<std::string>(&p_Options->m_MassTransferAngularMomentumLossPrescription.typeString)->default_value(p_Options->m_MassTransferAngularMomentumLossPrescription.typeString),                    
-            ("Mass Transfer Angular Momentum Loss prescription (" + AllowedOptionValuesFormatted("mass-transfer-angular-momentum-loss-prescription") + ", default = '" + p_Options->m_MassTransferAngularMomentumLossPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Mass Transfer Angular Momentum Loss prescription (" + AllowedOptionValuesFormatted("mass-transfer-angular-momentum-loss-prescription") + ", default = '" + p_Options->m_MassTransferAngularMomentumLossPrescription.typeString + "')").c_str())
         )
         (
             "mass-transfer-rejuvenation-prescription",                     
             po::value<std::string>(&p_Options->m_MassTransferRejuvenationPrescription.typeString)->default_value(p_Options->m_MassTransferRejuvenationPrescription.typeString),                                  
-            ("Mass Transfer Rejuvenation prescription (" + AllowedOptionValuesFormatted("mass-transfer-rejuvenation-prescription") + ", default = '" + p_Options->m_MassTransferRejuvenationPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Mass Transfer Rejuvenation prescription (" + AllowedOptionValuesFormatted("mass-transfer-rejuvenation-prescription") + ", default = '" + p_Options->m_MassTransferRejuvenationPrescription.typeString + "')").c_str())
         )
         (
             "mass-transfer-thermal-limit-accretor",                        
             po::value<std::string>(&p_Options->m_MassTransferThermallyLimitedVariation.typeString)->default_value(p_Options->m_MassTransferThermallyLimitedVariation.typeString),                                
-            ("Mass Transfer Thermal Accretion limit (" + AllowedOptionValuesFormatted("mass-transfer-thermal-limit-accretor") + ", default = '" + p_Options->m_MassTransferThermallyLimitedVariation.typeString + "')").c_str()
+            DESCRIPTION(("Mass Transfer Thermal Accretion limit (" + AllowedOptionValuesFormatted("mass-transfer-thermal-limit-accretor") + ", default = '" + p_Options->m_MassTransferThermallyLimitedVariation.typeString + "')").c_str())
         )
         (
             "metallicity-distribution",                                 
             po::value<std::string>(&p_Options->m_MetallicityDistribution.typeString)->default_value(p_Options->m_MetallicityDistribution.typeString),                                                          
-            ("Metallicity distribution (" + AllowedOptionValuesFormatted("metallicity-distribution") + ", default = '" + p_Options->m_MetallicityDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Metallicity distribution (" + AllowedOptionValuesFormatted("metallicity-distribution") + ", default = '" + p_Options->m_MetallicityDistribution.typeString + "')").c_str())
         )
         (
             "mode",                                                 
             po::value<std::string>(&p_Options->m_EvolutionMode.typeString)->default_value(p_Options->m_EvolutionMode.typeString),                                                                              
-            ("Evolution mode (" + AllowedOptionValuesFormatted("mode") + ", default = '" + p_Options->m_EvolutionMode.typeString + "')").c_str()
+            DESCRIPTION(("Evolution mode (" + AllowedOptionValuesFormatted("mode") + ", default = '" + p_Options->m_EvolutionMode.typeString + "')").c_str())
         )
 
         (
             "neutrino-mass-loss-BH-formation",                             
             po::value<std::string>(&p_Options->m_NeutrinoMassLossAssumptionBH.typeString)->default_value(p_Options->m_NeutrinoMassLossAssumptionBH.typeString),                                                  
-            ("Assumption about neutrino mass loss during BH formation (" + AllowedOptionValuesFormatted("neutrino-mass-loss-BH-formation") + ", default = '" + p_Options->m_NeutrinoMassLossAssumptionBH.typeString + "')").c_str()
+            DESCRIPTION(("Assumption about neutrino mass loss during BH formation (" + AllowedOptionValuesFormatted("neutrino-mass-loss-BH-formation") + ", default = '" + p_Options->m_NeutrinoMassLossAssumptionBH.typeString + "')").c_str())
         )
         (
             "neutron-star-equation-of-state",                              
             po::value<std::string>(&p_Options->m_NeutronStarEquationOfState.typeString)->default_value(p_Options->m_NeutronStarEquationOfState.typeString),                                                      
-            ("Neutron star equation of state to use (" + AllowedOptionValuesFormatted("neutron-star-equation-of-state") + ", default = '" + p_Options->m_NeutronStarEquationOfState.typeString + "')").c_str()
+            DESCRIPTION(("Neutron star equation of state to use (" + AllowedOptionValuesFormatted("neutron-star-equation-of-state") + ", default = '" + p_Options->m_NeutronStarEquationOfState.typeString + "')").c_str())
         )
 
         (
             "orbital-period-distribution",                              
             po::value<std::string>(&p_Options->m_OrbitalPeriodDistribution.typeString)->default_value(p_Options->m_OrbitalPeriodDistribution.typeString),                                                        
-            ("Initial orbital period distribution (" + AllowedOptionValuesFormatted("orbital-period-distribution") + ", default = '" + p_Options->m_OrbitalPeriodDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Initial orbital period distribution (" + AllowedOptionValuesFormatted("orbital-period-distribution") + ", default = '" + p_Options->m_OrbitalPeriodDistribution.typeString + "')").c_str())
         )        
         (
             "output-container,c",                                          
             po::value<std::string>(&p_Options->m_OutputContainerName)->default_value(p_Options->m_OutputContainerName)->implicit_value(""),                                                            
-            ("Container (directory) name for output files (default = " + p_Options->m_OutputContainerName + ")").c_str()
+            DESCRIPTION(("Container (directory) name for output files (default = " + p_Options->m_OutputContainerName + ")").c_str())
         )
         (
             "output-path,o",                                                
             po::value<std::string>(&p_Options->m_OutputPathString)->default_value(p_Options->m_OutputPathString)->implicit_value(""),                                                                  
-            ("Directory for output (default = " + p_Options->m_OutputPathString + ")").c_str()
+            DESCRIPTION(("Directory for output (default = " + p_Options->m_OutputPathString + ")").c_str())
         )
 
         (
             "pulsar-birth-magnetic-field-distribution",                    
             po::value<std::string>(&p_Options->m_PulsarBirthMagneticFieldDistribution.typeString)->default_value(p_Options->m_PulsarBirthMagneticFieldDistribution.typeString),                                  
-            ("Pulsar Birth Magnetic Field distribution (" + AllowedOptionValuesFormatted("pulsar-birth-magnetic-field-distribution") + ", default = '" + p_Options->m_PulsarBirthMagneticFieldDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Pulsar Birth Magnetic Field distribution (" + AllowedOptionValuesFormatted("pulsar-birth-magnetic-field-distribution") + ", default = '" + p_Options->m_PulsarBirthMagneticFieldDistribution.typeString + "')").c_str())
         )
         (
             "pulsar-birth-spin-period-distribution",                       
             po::value<std::string>(&p_Options->m_PulsarBirthSpinPeriodDistribution.typeString)->default_value(p_Options->m_PulsarBirthSpinPeriodDistribution.typeString),                                        
-            ("Pulsar Birth Spin Period distribution (" + AllowedOptionValuesFormatted("pulsar-birth-spin-period-distribution") + ", default = '" + p_Options->m_PulsarBirthSpinPeriodDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Pulsar Birth Spin Period distribution (" + AllowedOptionValuesFormatted("pulsar-birth-spin-period-distribution") + ", default = '" + p_Options->m_PulsarBirthSpinPeriodDistribution.typeString + "')").c_str())
         )
         (
             "pulsational-pair-instability-prescription",                   
             po::value<std::string>(&p_Options->m_PulsationalPairInstabilityPrescription.typeString)->default_value(p_Options->m_PulsationalPairInstabilityPrescription.typeString),                              
-            ("Pulsational Pair Instability prescription (" + AllowedOptionValuesFormatted("pulsational-pair-instability-prescription") + ", default = '" + p_Options->m_PulsationalPairInstabilityPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Pulsational Pair Instability prescription (" + AllowedOptionValuesFormatted("pulsational-pair-instability-prescription") + ", default = '" + p_Options->m_PulsationalPairInstabilityPrescription.typeString + "')").c_str())
         )
 
         (
             "remnant-mass-prescription",                                   
             po::value<std::string>(&p_Options->m_RemnantMassPrescription.typeString)->default_value(p_Options->m_RemnantMassPrescription.typeString),                                                            
-            ("Choose remnant mass prescription (" + AllowedOptionValuesFormatted("remnant-mass-prescription") + ", default = '" + p_Options->m_RemnantMassPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Choose remnant mass prescription (" + AllowedOptionValuesFormatted("remnant-mass-prescription") + ", default = '" + p_Options->m_RemnantMassPrescription.typeString + "')").c_str())
         )
         (
             "rotational-velocity-distribution",                            
             po::value<std::string>(&p_Options->m_RotationalVelocityDistribution.typeString)->default_value(p_Options->m_RotationalVelocityDistribution.typeString),                                              
-            ("Initial rotational velocity distribution (" + AllowedOptionValuesFormatted("rotational-velocity-distribution") + ", default = '" + p_Options->m_RotationalVelocityDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Initial rotational velocity distribution (" + AllowedOptionValuesFormatted("rotational-velocity-distribution") + ", default = '" + p_Options->m_RotationalVelocityDistribution.typeString + "')").c_str())
         )
 
         (
             "semi-major-axis-distribution",                              
             po::value<std::string>(&p_Options->m_SemiMajorAxisDistribution.typeString)->default_value(p_Options->m_SemiMajorAxisDistribution.typeString),                                                        
-            ("Initial semi-major axis distribution (" + AllowedOptionValuesFormatted("semi-major-axis-distribution") + ", default = '" + p_Options->m_SemiMajorAxisDistribution.typeString + "')").c_str()
+            DESCRIPTION(("Initial semi-major axis distribution (" + AllowedOptionValuesFormatted("semi-major-axis-distribution") + ", default = '" + p_Options->m_SemiMajorAxisDistribution.typeString + "')").c_str())
         )        
         (
             "stellar-zeta-prescription",                                   
             po::value<std::string>(&p_Options->m_StellarZetaPrescription.typeString)->default_value(p_Options->m_StellarZetaPrescription.typeString),                                                            
-            ("Prescription for stellar zeta (" + AllowedOptionValuesFormatted("stellar-zeta-prescription") + ", default = '" + p_Options->m_StellarZetaPrescription.typeString + "')").c_str()
+            DESCRIPTION(("Prescription for stellar zeta (" + AllowedOptionValuesFormatted("stellar-zeta-prescription") + ", default = '" + p_Options->m_StellarZetaPrescription.typeString + "')").c_str())
         )
 
         (
             "YAML-template",                                   
             po::value<std::string>(&p_Options->m_YAMLtemplate)->default_value(p_Options->m_YAMLtemplate),                                                            
-            ("User-supplied YAML template filename (default = " + p_Options->m_YAMLtemplate + ")").c_str()
+            DESCRIPTION(("User-supplied YAML template filename (default = " + p_Options->m_YAMLtemplate + ")").c_str())
         )
 
 
@@ -1764,24 +1869,30 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
         (
             "debug-classes",                                               
             po::value<std::vector<std::string>>(&p_Options->m_DebugClasses)->multitoken()->default_value(p_Options->m_DebugClasses),                                                                        
-            ("Debug classes enabled (default = " + defaultDebugClasses + ")").c_str()
+            DESCRIPTION(("Debug classes enabled (default = " + defaultDebugClasses + ")").c_str())
         )
 
         (
             "log-classes",                                                 
             po::value<std::vector<std::string>>(&p_Options->m_LogClasses)->multitoken()->default_value(p_Options->m_LogClasses),                                                                            
-            ("Logging classes enabled (default = " + defaultLogClasses + ")").c_str()
+            DESCRIPTION(("Logging classes enabled (default = " + defaultLogClasses + ")").c_str())
         )
 
         (
             "notes",                                                 
             po::value<std::vector<std::string>>(&p_Options->m_Notes)->multitoken()->default_value(p_Options->m_Notes),                                                                            
-            ("User-specified annotations (default = " + defaultNotes + ")").c_str()
+            DESCRIPTION(("User-specified annotations (default = " + defaultNotes + ")").c_str())
         )
         (
             "notes-hdrs",                                                 
             po::value<std::vector<std::string>>(&p_Options->m_NotesHdrs)->multitoken()->default_value(p_Options->m_NotesHdrs),                                                                            
-            ("User-specified annotation header strings (default = " + defaultNotesHdrs + ")").c_str()
+            DESCRIPTION(("User-specified annotation header strings (default = " + defaultNotesHdrs + ")").c_str())
+        )
+
+        (
+            "population-summary",                                                 
+            po::value<std::vector<std::string>>(&p_Options->m_PopulationSummary)->multitoken()->default_value(p_Options->m_PopulationSummary),                                                              
+            DESCRIPTION(("Population summary reducers enabled (options: [CHIRP_MASS, DELAY_TIME, EVOLUTION_STATUS, FORMATION_CHANNEL, STELLAR_TYPES], default = " + defaultPopulationSummary + ")").c_str())
         )
     
         ;   // end the list of options to be added
@@ -1795,6 +1906,7 @@ bool Options::AddOptions(OptionValues *p_Options, po::options_description *p_Opt
     }
 
     return ok;
+#undef DESCRIPTION
 }
 
 
@@ -2015,6 +2127,11 @@ std::string Options::OptionValues::CheckAndSetOptions() {
             COMPLAIN_IF(!found, "Unknown Envelope State Prescription");
         }
 
+        if (!DEFAULTED("evolution-target")) {                                                                                       // evolution target
+            std::tie(found, m_EvolutionTarget.type) = utils::GetMapKey(m_EvolutionTarget.typeString, EVOLUTION_TARGET_LABEL, m_EvolutionTarget.type);
+            COMPLAIN_IF(!found, "Unknown Evolution Target");
+        }
+
         if (!DEFAULTED("eccentricity-distribution")) {                                                                              // eccentricity distribution
             std::tie(found, m_EccentricityDistribution.type) = utils::GetMapKey(m_EccentricityDistribution.typeString, ECCENTRICITY_DISTRIBUTION_LABEL, m_EccentricityDistribution.type);
             COMPLAIN_IF(!found, "Unknown Eccentricity Distribution");
@@ -2040,6 +2157,16 @@ std::string Options::OptionValues::CheckAndSetOptions() {
             COMPLAIN_IF(!found, "Unknown Kick Magnitude Distribution");
         }
 
+        if (!DEFAULTED("hdf5-compression")) {                                                                                       // HDF5 dataset compression
+            std::tie(found, m_HDF5Compression.type) = utils::GetMapKey(m_HDF5Compression.typeString, HDF5_COMPRESSION_LABEL, m_HDF5Compression.type);
+            COMPLAIN_IF(!found, "Unknown HDF5 Compression");
+        }
+
+        if (!DEFAULTED("logfile-flush")) {                                                                                          // logfile flush policy
+            std::tie(found, m_LogfileFlush.type) = utils::GetMapKey(m_LogfileFlush.typeString, LOGFILE_FLUSH_LABEL, m_LogfileFlush.type);
+            COMPLAIN_IF(!found, "Unknown Logfile Flush Policy");
+        }
+
         if (!DEFAULTED("logfile-type")) {                                                                                           // logfile type
             std::tie(found, m_LogfileType.type) = utils::GetMapKey(m_LogfileType.typeString, LOGFILETYPELabel, m_LogfileType.type);
             COMPLAIN_IF(!found, "Unknown Logfile Type");
@@ -2167,6 +2294,7 @@ std::string Options::OptionValues::CheckAndSetOptions() {
         COMPLAIN_IF(!DEFAULTED("grid-lines-to-process") && m_GridLinesToProcess < 1, "Grid file lines to process (--grid-lines-to-process) < 1");
 
         COMPLAIN_IF(m_HDF5BufferSize < 1, "HDF5 IO buffer size (--hdf5-buffer-size) must be >= 1");
+        COMPLAIN_IF(m_HDF5CompressionLevel < 1 || m_HDF5CompressionLevel > 9, "HDF5 compression level (--hdf5-compression-level) must be between 1 and 9");
         COMPLAIN_IF(m_HDF5ChunkSize < HDF5_MINIMUM_CHUNK_SIZE, "HDF5 file dataset chunk size (--hdf5-chunk-size) must be >= minimum chunk size of " + std::to_string(HDF5_MINIMUM_CHUNK_SIZE));
 
         COMPLAIN_IF(m_InitialMass < MINIMUM_INITIAL_MASS || m_InitialMass > MAXIMUM_INITIAL_MASS, "Initial mass (--initial-mass) must be between " + std::to_string(MINIMUM_INITIAL_MASS) + " and " + std::to_string(MAXIMUM_INITIAL_MASS) + " Msol");
@@ -2193,6 +2321,8 @@ std::string Options::OptionValues::CheckAndSetOptions() {
 
         COMPLAIN_IF(m_MaxEvolutionTime <= 0.0, "Maximum evolution time in Myr (--maxEvolutionTime) must be > 0");
 
+        COMPLAIN_IF(m_EvolutionTargetMinimumMass < 0.0, "Evolution target minimum mass (--evolution-target-minimum-mass) must be >= 0");
+
         COMPLAIN_IF(m_Metallicity < MINIMUM_METALLICITY || m_Metallicity > MAXIMUM_METALLICITY, "Metallicity (--metallicity) should be absolute metallicity and must be between " + std::to_string(MINIMUM_METALLICITY) + " and " + std::to_string(MAXIMUM_METALLICITY));
         COMPLAIN_IF(m_MetallicityDistributionMin < MINIMUM_METALLICITY || m_MetallicityDistributionMin > MAXIMUM_METALLICITY, "Minimum metallicity (--metallicity-min) must be between " + std::to_string(MINIMUM_METALLICITY) + " and " + std::to_string(MAXIMUM_METALLICITY));
         COMPLAIN_IF(m_MetallicityDistributionMax < MINIMUM_METALLICITY || m_MetallicityDistributionMax > MAXIMUM_METALLICITY, "Maximum metallicity (--metallicity-max) must be between " + std::to_string(MINIMUM_METALLICITY) + " and " + std::to_string(MAXIMUM_METALLICITY));
@@ -2206,6 +2336,27 @@ std::string Options::OptionValues::CheckAndSetOptions() {
         }
 
         COMPLAIN_IF(m_ObjectsToEvolve <= 0, (m_EvolutionMode.type == EVOLUTION_MODE::SSE ? "Number of stars requested <= 0" : "Number of binaries requested <= 0"));
+
+        COMPLAIN_IF(m_ForkVariations && m_EvolutionMode.type != EVOLUTION_MODE::BSE, "Fork variations (--fork-variations) is only available in BSE mode");
+        COMPLAIN_IF(m_ForkVariations && !m_GridFilename.empty(), "Fork variations (--fork-variations) cannot be used with a grid file (--grid)");
+
+        if (m_ImportanceSampling) {                                                                                                 // importance sampling?
+            COMPLAIN_IF(m_EvolutionMode.type != EVOLUTION_MODE::BSE, "Importance sampling (--importance-sampling) is only available in BSE mode");
+            COMPLAIN_IF(!m_GridFilename.empty(), "Importance sampling (--importance-sampling) cannot be used with a grid file (--grid)");
+            COMPLAIN_IF(m_ForkVariations, "Importance sampling (--importance-sampling) cannot be used with fork variations (--fork-variations)");
+            COMPLAIN_IF(m_EvolutionTarget.type == EVOLUTION_TARGET::ALL, "Importance sampling (--importance-sampling) requires an evolution target (--evolution-target) to define its hits");
+            COMPLAIN_IF(m_ImportanceSamplingBatchSize <= 0, "Importance sampling batch size (--importance-sampling-batch-size) <= 0");
+            COMPLAIN_IF(m_ImportanceSamplingExplorationFraction <= 0.0 || m_ImportanceSamplingExplorationFraction > 1.0, "Importance sampling exploration fraction (--importance-sampling-exploration-fraction) must be > 0 and <= 1");
+
+            // the proposal is fitted in, and the weights are calculated from, the prior distributions of
+            // the primary mass, mass ratio and semi-major axis - so those must be sampled, and from
+            // distributions for which the sampler knows the density
+            COMPLAIN_IF(!DEFAULTED("initial-mass-1") || !DEFAULTED("initial-mass-2") || !DEFAULTED("mass-ratio"), "Importance sampling (--importance-sampling) cannot be used with specified initial masses or mass ratio");
+            COMPLAIN_IF(!DEFAULTED("semi-major-axis") || !DEFAULTED("orbital-period"), "Importance sampling (--importance-sampling) cannot be used with a specified semi-major axis or orbital period");
+            COMPLAIN_IF(!DEFAULTED("orbital-period-distribution") && DEFAULTED("semi-major-axis-distribution"), "Importance sampling (--importance-sampling) cannot be used with an orbital period distribution (--orbital-period-distribution)");
+            COMPLAIN_IF(m_MassRatioDistribution.type != MASS_RATIO_DISTRIBUTION::FLAT, "Importance sampling (--importance-sampling) requires a FLAT mass ratio distribution (--mass-ratio-distribution)");
+            COMPLAIN_IF(m_SemiMajorAxisDistribution.type != SEMI_MAJOR_AXIS_DISTRIBUTION::FLATINLOG, "Importance sampling (--importance-sampling) requires a FLATINLOG semi-major axis distribution (--semi-major-axis-distribution)");
+        }
     
         if (m_NeutrinoMassLossAssumptionBH.type == NEUTRINO_MASS_LOSS_PRESCRIPTION::FIXED_FRACTION) {
             COMPLAIN_IF(m_NeutrinoMassLossValueBH < 0.0 || m_NeutrinoMassLossValueBH > 1.0, "Neutrino mass loss must be between 0 and 1");
@@ -2232,6 +2383,14 @@ std::string Options::OptionValues::CheckAndSetOptions() {
 
         COMPLAIN_IF(m_OverallWindMassLossMultiplier < 0.0, "Overall wind mass loss multiplier (--overall-wind-mass-loss-multiplier) < 0.0");
 
+        for (auto& reducer: m_PopulationSummary) {                                                                                  // check population summary reducers
+            bool found;
+            POPULATION_SUMMARY summary;
+            std::tie(found, summary) = utils::GetMapKey(reducer, POPULATION_SUMMARY_LABEL, POPULATION_SUMMARY::EVOLUTION_STATUS);
+            COMPLAIN_IF(!found, "Unknown population summary reducer (--population-summary): " + reducer);
+        }
+        COMPLAIN_IF(m_PopulationSummaryOnly && m_PopulationSummary.empty(), "Population summary only (--population-summary-only) specified without any population summary reducers (--population-summary)");
+
         COMPLAIN_IF(!DEFAULTED("pulsar-magnetic-field-decay-timescale") && m_PulsarMagneticFieldDecayTimescale <= 0.0, "Pulsar magnetic field decay timescale (--pulsar-magnetic-field-decay-timescale) <= 0");
         COMPLAIN_IF(!DEFAULTED("pulsar-magnetic-field-decay-massscale") && m_PulsarMagneticFieldDecayMassscale <= 0.0, "Pulsar Magnetic field decay massscale (--pulsar-magnetic-field-decay-massscale) <= 0");
 
@@ -2284,6 +2443,10 @@ std::string Options::OptionValues::CheckAndSetOptions() {
  * The map key is the option name string, and the value the default string as
  * stored by boost.
  * 
+ * Boost records the default value of each option in the option's parameter string -
+ * e.g. "arg (=0.5)", or "[=arg(=1)] (=0)" for options with implicit values - so we
+ * parse the parameter strings rather than format (and wrap) the full descriptions.
+ * 
  * void Options::BuildDefaultsMap(po::options_description *p_OptionsDescription)
  * 
  * 
@@ -2292,51 +2455,26 @@ std::string Options::OptionValues::CheckAndSetOptions() {
 
 void Options::BuildDefaultsMap(po::options_description *p_OptionsDescription) {
 
-    // parse option descriptions and extract default values
-    // build default values map
-    // descriptions formatted by boost, so can make some assumptions
-    std::stringstream ss;                                                                                   // to hold option descriptions
-    ss << *p_OptionsDescription;                                                                            // capture options descriptions ...
-    std::string descriptions = ss.str();                                                                    // ... as string
-
-    size_t pos  = 0;
-    size_t prev = 0;
-    while ((pos = descriptions.find('\n', prev)) != std::string::npos) {                                    // extract individual option descriptions (split at newline)
-        std::string rec = descriptions.substr(prev, pos - prev);                                            // this option description
-        rec  = utils::trim(rec);                                                                            // trim whitespace
-        prev = pos + 1;                                                                                     // set up for next option
-
-        // have option description - parse it
-        if (rec.substr(0, 2) == "--" || (rec[0] = '-' && rec.substr(3, 4) == "[ --")) {                     // option description?
-                                                                                                            // yes
-            // strip the preamble
-            if (rec.substr(0, 2) == "--") rec = rec.substr(2, rec.length() - 2);
-            else rec = rec.substr(7, rec.length() - 7);
-
-            // parse the option details
-            // get option string - skip if not found
-            // look for default string - use "" if not found
-            size_t p = rec.find(' ');                                                                       // find end of option name string
-            if (p != std::string::npos) {                                                                   // found?
-                if (p > 0) {                                                                                // yes non-empty option string?
-                    std::string optionStr = rec.substr(0, p);                                               // yes - capture option string
-                    std::string defaultStr = "";                                                            // default default string is empty string
-                    size_t p1 = rec.find("[=arg(=", p);                                                     // look for implicit value container ("[=arg(=")
-                    if (p1 != std::string::npos) p = p1 + 6;                                                // skip it if found
-                    p1 = rec.find("(=", p);                                                                 // look for default value container ("(=")
-                    if (p1 != std::string::npos) {                                                          // found?
-                        size_t p2 = rec.find(")", p1);                                                      // yes - look for container end container (")")
-                        if (p2 != std::string::npos) {                                                      // found?
-                            size_t len = p2 - p1 - 2;                                                       // yes - length of default value string
-                            if (len > 0) {                                                                  // non-empty string?
-                                defaultStr = rec.substr(p1 + 2, len);                                       // capture default string
-                            }
-                        }
-                    }
-                    m_optionDefaults.insert(std::pair<std::string, std::string>(optionStr, defaultStr));    // add to map
+    for (auto& option: p_OptionsDescription->options()) {                                                  // for each option
+
+        std::string parameterStr = option->format_parameter();                                              // parameter string (empty for switches)
+        std::string defaultStr   = "";                                                                      // default default string is empty string
+
+        // look for default string - use "" if not found
+        size_t p  = 0;
+        size_t p1 = parameterStr.find("[=arg(=");                                                           // look for implicit value container ("[=arg(=")
+        if (p1 != std::string::npos) p = p1 + 6;                                                            // skip it if found
+        p1 = parameterStr.find("(=", p);                                                                    // look for default value container ("(=")
+        if (p1 != std::string::npos) {                                                                      // found?
+            size_t p2 = parameterStr.find(")", p1);                                                         // yes - look for container end container (")")
+            if (p2 != std::string::npos) {                                                                  // found?
+                size_t len = p2 - p1 - 2;                                                                   // yes - length of default value string
+                if (len > 0) {                                                                              // non-empty string?
+                    defaultStr = parameterStr.substr(p1 + 2, len);                                          // capture default string
                 }
             }
         }
+        m_optionDefaults.insert(std::pair<std::string, std::string>(option->long_name(), defaultStr));      // add to map
     }
 }
 
@@ -2371,11 +2509,14 @@ std::vector<std::string> Options::AllowedOptionValues(const std::string p_Option
         case _("common-envelope-mass-accretion-prescription")       : POPULATE_RET(CE_ACCRETION_PRESCRIPTION_LABEL);                break;
         case _("critical-mass-ratio-prescription")                  : POPULATE_RET(QCRIT_PRESCRIPTION_LABEL);                       break;
         case _("envelope-state-prescription")                       : POPULATE_RET(ENVELOPE_STATE_PRESCRIPTION_LABEL);              break;
+        case _("evolution-target")                                  : POPULATE_RET(EVOLUTION_TARGET_LABEL);                         break;
         case _("eccentricity-distribution")                         : POPULATE_RET(ECCENTRICITY_DISTRIBUTION_LABEL);                break;
         case _("fryer-supernova-engine")                            : POPULATE_RET(SN_ENGINE_LABEL);                                break;
+        case _("hdf5-compression")                                  : POPULATE_RET(HDF5_COMPRESSION_LABEL);                         break;
         case _("initial-mass-function")                             : POPULATE_RET(INITIAL_MASS_FUNCTION_LABEL);                    break;
         case _("kick-direction")                                    : POPULATE_RET(KICK_DIRECTION_DISTRIBUTION_LABEL);              break;
         case _("kick-magnitude-distribution")                       : POPULATE_RET(KICK_MAGNITUDE_DISTRIBUTION_LABEL);              break;
+        case _("logfile-flush")                                     : POPULATE_RET(LOGFILE_FLUSH_LABEL);                            break;
         case _("logfile-type")                                      : POPULATE_RET(LOGFILETYPELabel);                               break;
         case _("luminous-blue-variable-prescription")               : POPULATE_RET(LBV_PRESCRIPTION_LABEL);                         break;
         case _("mass-loss-prescription")                            : POPULATE_RET(MASS_LOSS_PRESCRIPTION_LABEL);                   break;
@@ -2496,7 +2637,7 @@ int Options::OptionSpecified(const std::string p_OptionString) {
  *     - valueStr       STRING   the value of the option returned as a string (e.g. "2.3", "BSE" etc.)
  * 
  * 
- * Options::ATTR OptionAttributes(const po::variables_map p_VM, const po::variables_map::const_iterator p_IT)
+ * Options::ATTR OptionAttributes(const po::variables_map& p_VM, const po::variables_map::const_iterator p_IT)
  * 
  *
  * @param   [IN]    p_VM                        The boost variables map
@@ -2504,14 +2645,16 @@ int Options::OptionSpecified(const std::string p_OptionString) {
  *                                              for which the attributed are required to be retrieved
  * @return                                      Tuple (type ATTR) containing the option attributes
  */
-Options::ATTR Options::OptionAttributes(const po::variables_map p_VM, const po::variables_map::const_iterator p_IT) {
+Options::ATTR Options::OptionAttributes(const po::variables_map& p_VM, const po::variables_map::const_iterator p_IT) {
             
     TYPENAME    dataType  = TYPENAME::NONE;
     std::string typeStr   = "";
     bool        defaulted = false;
     std::string valueStr  = "";
 
-    if (((boost::any)p_IT->second.value()).empty()) return std::make_tuple(TYPENAME::NONE, true, "", "");   // empty option 
+    const boost::any& value = p_IT->second.value();                         // option value - by reference, so no copies
+
+    if (value.empty()) return std::make_tuple(TYPENAME::NONE, true, "", "");   // empty option 
 
     // determine if option value was supplied, or whether the default was used
 
@@ -2520,28 +2663,8 @@ Options::ATTR Options::OptionAttributes(const po::variables_map p_VM, const po::
     // find data type and format the option value into a string
     // handles most data types - add others if they cause problems
 
-    bool isCharPtr = false;
-    bool isStr     = false;
-
-    // (pre)check for data type = charPtr
-    try {
-        boost::any_cast<const char *>(p_IT->second.value());
-        isCharPtr = true;
-    }
-    catch (const boost::bad_any_cast &) {
-        isCharPtr = false;
-    }
-
-    if (!isCharPtr) {
-        // (pre)check for data type = string
-        try {
-            boost::any_cast<std::string>(p_IT->second.value());
-            isStr = true;
-        }
-        catch (const boost::bad_any_cast &) {
-            isStr = false;
-        }
-    }
+    bool isCharPtr = value.type() == typeid(const char *);                  // (pre)check for data type = charPtr
+    bool isStr     = !isCharPtr && value.type() == typeid(std::string);     // (pre)check for data type = string
 
     // find other data types
     // it's not pretty, but it works
@@ -2560,46 +2683,46 @@ Options::ATTR Options::OptionAttributes(const po::variables_map p_VM, const po::
         else              valueStr = "''";
     }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed                )) { dataType = TYPENAME::INT;          typeStr = "SIGNED";                 valueStr = std::to_string(p_VM[p_IT->first].as<signed                >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned              )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED";               valueStr = std::to_string(p_VM[p_IT->first].as<unsigned              >()); }
+    else if (value.type() == typeid(signed                )) { dataType = TYPENAME::INT;          typeStr = "SIGNED";                 valueStr = std::to_string(p_VM[p_IT->first].as<signed                >()); }
+    else if (value.type() == typeid(unsigned              )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED";               valueStr = std::to_string(p_VM[p_IT->first].as<unsigned              >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(short                 )) { dataType = TYPENAME::INT;          typeStr = "SHORT";                  valueStr = std::to_string(p_VM[p_IT->first].as<short                 >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed short          )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_SHORT";           valueStr = std::to_string(p_VM[p_IT->first].as<signed short          >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned short        )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_SHORT";         valueStr = std::to_string(p_VM[p_IT->first].as<unsigned short        >()); }
+    else if (value.type() == typeid(short                 )) { dataType = TYPENAME::INT;          typeStr = "SHORT";                  valueStr = std::to_string(p_VM[p_IT->first].as<short                 >()); }
+    else if (value.type() == typeid(signed short          )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_SHORT";           valueStr = std::to_string(p_VM[p_IT->first].as<signed short          >()); }
+    else if (value.type() == typeid(unsigned short        )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_SHORT";         valueStr = std::to_string(p_VM[p_IT->first].as<unsigned short        >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(short int             )) { dataType = TYPENAME::INT;          typeStr = "SHORT_INT";              valueStr = std::to_string(p_VM[p_IT->first].as<short int             >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed short int      )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_SHORT_INT";       valueStr = std::to_string(p_VM[p_IT->first].as<signed short int      >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned short int    )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_SHORT_INT";     valueStr = std::to_string(p_VM[p_IT->first].as<unsigned short int    >()); }
+    else if (value.type() == typeid(short int             )) { dataType = TYPENAME::INT;          typeStr = "SHORT_INT";              valueStr = std::to_string(p_VM[p_IT->first].as<short int             >()); }
+    else if (value.type() == typeid(signed short int      )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_SHORT_INT";       valueStr = std::to_string(p_VM[p_IT->first].as<signed short int      >()); }
+    else if (value.type() == typeid(unsigned short int    )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_SHORT_INT";     valueStr = std::to_string(p_VM[p_IT->first].as<unsigned short int    >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(int                   )) { dataType = TYPENAME::INT;          typeStr = "INT";                    valueStr = std::to_string(p_VM[p_IT->first].as<int                   >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed int            )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_INT";             valueStr = std::to_string(p_VM[p_IT->first].as<signed int            >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned int          )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_INT";           valueStr = std::to_string(p_VM[p_IT->first].as<unsigned int          >()); }
+    else if (value.type() == typeid(int                   )) { dataType = TYPENAME::INT;          typeStr = "INT";                    valueStr = std::to_string(p_VM[p_IT->first].as<int                   >()); }
+    else if (value.type() == typeid(signed int            )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_INT";             valueStr = std::to_string(p_VM[p_IT->first].as<signed int            >()); }
+    else if (value.type() == typeid(unsigned int          )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_INT";           valueStr = std::to_string(p_VM[p_IT->first].as<unsigned int          >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(long                  )) { dataType = TYPENAME::LONGINT;      typeStr = "LONG";                   valueStr = std::to_string(p_VM[p_IT->first].as<long                  >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed long           )) { dataType = TYPENAME::LONGINT;      typeStr = "SIGNED_LONG";            valueStr = std::to_string(p_VM[p_IT->first].as<signed long           >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned long         )) { dataType = TYPENAME::ULONGINT;     typeStr = "UNSIGNED_LONG";          valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long         >()); }
+    else if (value.type() == typeid(long                  )) { dataType = TYPENAME::LONGINT;      typeStr = "LONG";                   valueStr = std::to_string(p_VM[p_IT->first].as<long                  >()); }
+    else if (value.type() == typeid(signed long           )) { dataType = TYPENAME::LONGINT;      typeStr = "SIGNED_LONG";            valueStr = std::to_string(p_VM[p_IT->first].as<signed long           >()); }
+    else if (value.type() == typeid(unsigned long         )) { dataType = TYPENAME::ULONGINT;     typeStr = "UNSIGNED_LONG";          valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long         >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(long int              )) { dataType = TYPENAME::LONGINT;      typeStr = "LONG_INT";               valueStr = std::to_string(p_VM[p_IT->first].as<long int              >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed long int       )) { dataType = TYPENAME::LONGINT;      typeStr = "SIGNED_LONG_INT";        valueStr = std::to_string(p_VM[p_IT->first].as<signed long int       >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned long int     )) { dataType = TYPENAME::ULONGINT;     typeStr = "UNSIGNED_LONG_INT";      valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long int     >()); }
+    else if (value.type() == typeid(long int              )) { dataType = TYPENAME::LONGINT;      typeStr = "LONG_INT";               valueStr = std::to_string(p_VM[p_IT->first].as<long int              >()); }
+    else if (value.type() == typeid(signed long int       )) { dataType = TYPENAME::LONGINT;      typeStr = "SIGNED_LONG_INT";        valueStr = std::to_string(p_VM[p_IT->first].as<signed long int       >()); }
+    else if (value.type() == typeid(unsigned long int     )) { dataType = TYPENAME::ULONGINT;     typeStr = "UNSIGNED_LONG_INT";      valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long int     >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(long long             )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "LONG_LONG";              valueStr = std::to_string(p_VM[p_IT->first].as<long long             >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed long long      )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "SIGNED_LONG_LONG";       valueStr = std::to_string(p_VM[p_IT->first].as<signed long long      >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned long long    )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "UNSIGNED_LONG_LONG";     valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long long    >()); }
+    else if (value.type() == typeid(long long             )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "LONG_LONG";              valueStr = std::to_string(p_VM[p_IT->first].as<long long             >()); }
+    else if (value.type() == typeid(signed long long      )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "SIGNED_LONG_LONG";       valueStr = std::to_string(p_VM[p_IT->first].as<signed long long      >()); }
+    else if (value.type() == typeid(unsigned long long    )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "UNSIGNED_LONG_LONG";     valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long long    >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(long long int         )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "LONG_LONG_INT";          valueStr = std::to_string(p_VM[p_IT->first].as<long long int         >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed long long int  )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "SIGNED_LONG_LONG_INT";   valueStr = std::to_string(p_VM[p_IT->first].as<signed long long int  >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned long long int)) { dataType = TYPENAME::ULONGLONGINT; typeStr = "UNSIGNED_LONG_LONG_INT"; valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long long int>()); }
+    else if (value.type() == typeid(long long int         )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "LONG_LONG_INT";          valueStr = std::to_string(p_VM[p_IT->first].as<long long int         >()); }
+    else if (value.type() == typeid(signed long long int  )) { dataType = TYPENAME::LONGLONGINT;  typeStr = "SIGNED_LONG_LONG_INT";   valueStr = std::to_string(p_VM[p_IT->first].as<signed long long int  >()); }
+    else if (value.type() == typeid(unsigned long long int)) { dataType = TYPENAME::ULONGLONGINT; typeStr = "UNSIGNED_LONG_LONG_INT"; valueStr = std::to_string(p_VM[p_IT->first].as<unsigned long long int>()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(float                 )) { dataType = TYPENAME::FLOAT;        typeStr = "FLOAT";                  valueStr = std::to_string(p_VM[p_IT->first].as<float                 >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(double                )) { dataType = TYPENAME::DOUBLE;       typeStr = "DOUBLE";                 valueStr = std::to_string(p_VM[p_IT->first].as<double                >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(long double           )) { dataType = TYPENAME::LONGDOUBLE;   typeStr = "LONG_DOUBLE";            valueStr = std::to_string(p_VM[p_IT->first].as<long double           >()); }
+    else if (value.type() == typeid(float                 )) { dataType = TYPENAME::FLOAT;        typeStr = "FLOAT";                  valueStr = std::to_string(p_VM[p_IT->first].as<float                 >()); }
+    else if (value.type() == typeid(double                )) { dataType = TYPENAME::DOUBLE;       typeStr = "DOUBLE";                 valueStr = std::to_string(p_VM[p_IT->first].as<double                >()); }
+    else if (value.type() == typeid(long double           )) { dataType = TYPENAME::LONGDOUBLE;   typeStr = "LONG_DOUBLE";            valueStr = std::to_string(p_VM[p_IT->first].as<long double           >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(char                  )) { dataType = TYPENAME::INT;          typeStr = "CHAR";                   valueStr = std::to_string(p_VM[p_IT->first].as<char                  >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(signed char           )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_CHAR";            valueStr = std::to_string(p_VM[p_IT->first].as<signed char           >()); }
-    else if (((boost::any)p_IT->second.value()).type() == typeid(unsigned char         )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_CHAR";          valueStr = std::to_string(p_VM[p_IT->first].as<unsigned char         >()); }
+    else if (value.type() == typeid(char                  )) { dataType = TYPENAME::INT;          typeStr = "CHAR";                   valueStr = std::to_string(p_VM[p_IT->first].as<char                  >()); }
+    else if (value.type() == typeid(signed char           )) { dataType = TYPENAME::INT;          typeStr = "SIGNED_CHAR";            valueStr = std::to_string(p_VM[p_IT->first].as<signed char           >()); }
+    else if (value.type() == typeid(unsigned char         )) { dataType = TYPENAME::INT;          typeStr = "UNSIGNED_CHAR";          valueStr = std::to_string(p_VM[p_IT->first].as<unsigned char         >()); }
 
-    else if (((boost::any)p_IT->second.value()).type() == typeid(bool)) {
+    else if (value.type() == typeid(bool)) {
         dataType = TYPENAME::BOOL;
         typeStr  = "BOOL";
         valueStr = p_VM[p_IT->first].as<bool>() ? "TRUE" : "FALSE";
@@ -2624,6 +2747,7 @@ Options::ATTR Options::OptionAttributes(const po::variables_map p_VM, const po::
             //     log-classes
             //     notes
             //     notes-hdrs
+            //     population-summary
             // 
             // The vector of strings is just formatted as a string here - with braces
             // sourrounding comma-separated values.
@@ -2696,6 +2820,31 @@ std::vector<OptionDetailsT> Options::OptionDetails(const OptionsDescriptorT &p_O
 }
 
 
+/*
+ * Get the commandline option details for the Run_Details and YAML files
+ *
+ * The option details, and the option defaults map from which the default strings are taken, are only
+ * needed if the Run_Details file or a YAML file is written, so they are constructed on the first call
+ * rather than in Options::Initialise().  The first call is made (by Log::Start() or yaml::MakeYAMLfile())
+ * before any ranges or sets are played out, so the details are those of the options as specified by
+ * the user.
+ * 
+ * 
+ * std::vector<OptionDetailsT> Options::CmdLineOptionsDetails()
+ * 
+ * @return                                      Vector containing the option details for Run_Details
+ */
+std::vector<OptionDetailsT> Options::CmdLineOptionsDetails() {
+
+    if (m_CmdLineOptionsDetails.empty()) {                                                                  // details constructed yet?
+        BuildDefaultsMap(&m_CmdLine.optionDescriptions);                                                    // no - build option defaults map
+        m_CmdLineOptionsDetails = OptionDetails(m_CmdLine);                                                 // get Run_Details contents
+    }
+
+    return m_CmdLineOptionsDetails;
+}
+
+
 /*
  * Show available options
  * 
@@ -2710,11 +2859,20 @@ std::vector<OptionDetailsT> Options::OptionDetails(const OptionsDescriptorT &p_O
  */
 void Options::PrintOptionHelp(const bool p_Verbose) {
 
+    // the option descriptions are not constructed by Options::Initialise() - construct them here
+    // (the default values shown in the descriptions are those of a freshly initialised OptionValues object)
+
+    OptionValues            helpOptionValues;
+    po::options_description helpOptionDescriptions("Program Options", 128);
+
+    helpOptionValues.Initialise();
+    (void)AddOptions(&helpOptionValues, &helpOptionDescriptions, true);
+
     std::cout << "Options:" << std::endl;
 
     for (po::variables_map::const_iterator it = m_CmdLine.optionValues.m_VM.begin(); it != m_CmdLine.optionValues.m_VM.end(); it++) {
   
-        po::option_description const& opt = m_CmdLine.optionDescriptions.find(it->first, false, false, false); 
+        po::option_description const& opt = helpOptionDescriptions.find(it->first, false, false, false); 
 
         std::string optionLongName  = opt.canonical_display_name(cls::allow_long);                          // long name ('--') prefix
         if (optionLongName[0] == '-') optionLongName.erase(0, optionLongName.find_first_not_of("-"));       // remove the "-" or "--"
@@ -3619,6 +3777,7 @@ bool Options::Initialise(int p_ArgCount, char *p_ArgStrings[]) {
     for (size_t idx = 0; idx < m_BSEOnly.size();          idx++) m_BSEOnly[idx]          = utils::ToLower(utils::trim(m_BSEOnly[idx]));
     for (size_t idx = 0; idx < m_RangeExcluded.size();    idx++) m_RangeExcluded[idx]    = utils::ToLower(utils::trim(m_RangeExcluded[idx]));
     for (size_t idx = 0; idx < m_SetExcluded.size();      idx++) m_SetExcluded[idx]      = utils::ToLower(utils::trim(m_SetExcluded[idx]));
+    for (size_t idx = 0; idx < m_ForkVariationsAllowed.size(); idx++) m_ForkVariationsAllowed[idx] = utils::ToLower(utils::trim(m_ForkVariationsAllowed[idx]));
     for (size_t idx = 0; idx < m_ShorthandAllowed.size(); idx--) m_ShorthandAllowed[idx] = std::make_tuple(utils::ToLower(utils::trim(std::get<0>(m_ShorthandAllowed[idx]))), std::get<1>(m_ShorthandAllowed[idx]), std::get<2>(m_ShorthandAllowed[idx]));
 
     try {
@@ -3626,6 +3785,9 @@ bool Options::Initialise(int p_ArgCount, char *p_ArgStrings[]) {
         m_CmdLine.optionValues.Initialise();                                                                        // initialise option variables for program-level options
         m_GridLine.optionValues.Initialise();                                                                       // initialise option variables for evolving object-level options
 
+        // the option descriptions (help) are not constructed here - see Options::PrintOptionHelp() - and the
+        // option defaults map and Run_Details contents are constructed on demand - see Options::CmdLineOptionsDetails()
+
         po::options_description programLevelOptions("Program Options", 128);                                        // boost options descriptions object for program-level options
         ok = AddOptions(&m_CmdLine.optionValues, &programLevelOptions);                                             // ... add
         if (!ok) {                                                                                                  // ok?
@@ -3633,8 +3795,6 @@ bool Options::Initialise(int p_ArgCount, char *p_ArgStrings[]) {
         }
         else {                                                                                                      // yes, ok
             
-            BuildDefaultsMap(&programLevelOptions);                                                                 // build option defaults map
-
             m_CmdLine.optionDescriptions.add(programLevelOptions);                                                  // commandline options - stays static throughout the life of the program
     
             // we parse the option values before handing them over to boost
@@ -3652,7 +3812,14 @@ bool Options::Initialise(int p_ArgCount, char *p_ArgStrings[]) {
                 }
                 else {
 
-                    m_CmdLineOptionsDetails = OptionDetails(m_CmdLine);                                             // yes - get Run_Details contents
+                    if (m_CmdLine.optionValues.m_ForkVariations) {                                                  // fork variations?
+                        for (auto& complexOption: m_CmdLine.complexOptionValues) {                                  // yes - only options consulted after the fork point may be varied
+                            std::string optionName = utils::ToLower(std::get<0>(complexOption));
+                            COMPLAIN_IF(std::find(m_ForkVariationsAllowed.begin(), m_ForkVariationsAllowed.end(), optionName) == m_ForkVariationsAllowed.end(), "Option " + std::get<0>(complexOption) + " cannot be varied with fork variations (--fork-variations)"); // this throws an exception
+                        }
+                    }
+
+                    COMPLAIN_IF(m_CmdLine.optionValues.m_ImportanceSampling && CommandLineGrid(), "Importance sampling (--importance-sampling) cannot be used with ranges or sets"); // this throws an exception
 
                     // initialise evolving object-level options.  The values of options specified in a grid file
                     // take precedence over the values of the same options specified on the commandline, but only
@@ -3725,7 +3892,7 @@ bool Options::Initialise(int p_ArgCount, char *p_ArgStrings[]) {
  * @param   [IN]    p_OptionsDescriptor         Commandline or grid line options descriptor
  * @return                                      Int result:
  *                                                  -1: an error occurred
- *                                                   0: no more variations - all done
+ *                                                   0: no more variations - all done (option values are reset to the first variation)
  *                                                   1: new variation applied - option values are set
  */
 int Options::AdvanceOptionVariation(OptionsDescriptorT &p_OptionsDescriptor) {
@@ -3750,7 +3917,8 @@ int Options::AdvanceOptionVariation(OptionsDescriptorT &p_OptionsDescriptor) {
     // We traverse the complex options values in reverse order because the
     // fastest change is to the right...
 
-    bool stop  = false;                                                 // stop once we have all the values we need
+    bool stop    = false;                                               // stop once we have all the values we need
+    bool wrapped = false;                                               // outermost iterator wrapped?
     int idx = p_OptionsDescriptor.complexOptionValues.size() - 1;
     while (!stop && idx >= 0) {
 
@@ -3762,14 +3930,9 @@ int Options::AdvanceOptionVariation(OptionsDescriptorT &p_OptionsDescriptor) {
 
         if (details.type == COMPLEX_TYPE::SET) {                        // SET
             if (details.currPos >= int(details.parameters.size())) {    // currPos is set position - wrap?
-                if (idx == 0) {                                         // outermost iterator?
-                    retVal = 0;                                         // yes - we're done
-                    break;
-                }
-                else {                                                  // no - wrap
-                    details.currPos = 0;                                // ... back to zero
-                    stop = false;                                       // ... and don't stop at this iterator
-                }
+                wrapped         = idx == 0;                             // outermost iterator? - we're done (back to the first variation)
+                details.currPos = 0;                                    // ... back to zero
+                stop            = false;                                // ... and don't stop at this iterator
             }
             std::string optionValue = details.parameters[details.currPos];  // option value (as string)
 
@@ -3829,14 +3992,9 @@ int Options::AdvanceOptionVariation(OptionsDescriptorT &p_OptionsDescriptor) {
         else {                                                          // RANGE
 
             if (details.currPos >= details.rangeParms[1].iVal) {        // currPos is range count - wrap?
-                if (idx == 0) {                                         // outermost iterator?
-                    retVal = 0;                                         // yes - we're done
-                    break;
-                }
-                else {                                                  // no - wrap
-                    details.currPos = 0;                                // ... back to zero
-                    stop = false;                                       // ... and don't stop at this iterator
-                }
+                wrapped         = idx == 0;                             // outermost iterator? - we're done (back to the first variation)
+                details.currPos = 0;                                    // ... back to zero
+                stop            = false;                                // ... and don't stop at this iterator
             }
 
             switch (details.dataType) {                                 // which data type?
@@ -3905,7 +4063,7 @@ int Options::AdvanceOptionVariation(OptionsDescriptorT &p_OptionsDescriptor) {
 
         p_OptionsDescriptor.complexOptionValues[idx] = std::make_tuple(optionName, details); // reset values
 
-        retVal = 1;                                                     // set return value
+        retVal = wrapped ? 0 : 1;                                       // set return value
         idx--;                                                          // next (outer) iterator
     }
 
@@ -133,6 +133,9 @@ private:
     // m_RangeExcluded records option strings for which a range may not be specified
     // m_SetExcluded records option strings for which a set may not be specified
     //
+    // m_ForkVariationsAllowed records option strings that may be varied (ranges/sets)
+    // when --fork-variations is specified
+    //
     // Each of these is described in more detail below
 
 
@@ -165,7 +168,9 @@ private:
         { "log-classes",        false,              "" },                       // don't allow defaults - we don't know how many classes to specify
 
         { "notes",              true,               "" },                       // allow defaults - number of notes is 0..#notes-hdrs
-        { "notes-hdrs",         false,              "" }                        // don't allow defaults - we don't know how many headers to specify
+        { "notes-hdrs",         false,              "" },                       // don't allow defaults - we don't know how many headers to specify
+
+        { "population-summary", false,              "" }                        // don't allow defaults - we don't know how many reducers to specify
     };
 
 
@@ -194,19 +199,29 @@ private:
         "debug-classes",
         "debug-to-file",
         "detailed-output",
+        "detailed-output-compact",
 
         "enable-warnings",
         "errors-to-file",
 
+        "fork-variations",
+
         "grid",
         "grid-start-line",
         "grid-num-lines",
 
         "hdf5-buffer-size",
         "hdf5-chunk-size",
+        "hdf5-compression",
+        "hdf5-compression-level",
+        "hdf5-shuffle",
         "help", "h",
         "hmxr-binaries",
 
+        "importance-sampling",
+        "importance-sampling-batch-size",
+        "importance-sampling-exploration-fraction",
+
         "log-level", 
         "log-classes",
 
@@ -219,6 +234,7 @@ private:
         "logfile-detailed-output-record-types",
         "logfile-double-compact-objects",
         "logfile-double-compact-objects-record-types",
+        "logfile-flush",
         "logfile-name-prefix",
         "logfile-pulsar-evolution",
         "logfile-pulsar-evolution-record-types",
@@ -240,12 +256,15 @@ private:
         "outputPath", "o",
 
         "population-data-printing",
+        "population-summary",
+        "population-summary-only",
         "print-bool-as-string",
 
         "quiet", 
 
         "rlof-printing",
 
+        "startup-timing",
         "store-input-files",
         "switch-log",
 
@@ -331,9 +350,17 @@ private:
         "eccentricity-distribution",
         "eccentricity-max",
         "eccentricity-min",
+        "evolution-target",
+        "evolution-target-minimum-mass",
         "evolve-pulsars",
         "evolve-unbound-systems",
 
+        "fork-variations",
+
+        "importance-sampling",
+        "importance-sampling-batch-size",
+        "importance-sampling-exploration-fraction",
+
         "initial-mass-1",
         "initial-mass-2",
 
@@ -432,14 +459,17 @@ private:
         "debug-level",
         "debug-to-file",
         "detailed-output",
+        "detailed-output-compact",
 
         "eccentricity-distribution",
         "enable-warnings",
         "envelope-state-prescription",
         "errors-to-file",
+        "evolution-target",
         "evolve-pulsars",
         "evolve-unbound-systems",
 
+        "fork-variations",
         "fryer-supernova-engine",
 
         "grid",
@@ -448,9 +478,16 @@ private:
 
         "hdf5-buffer-size",
         "hdf5-chunk-size",
+        "hdf5-compression",
+        "hdf5-compression-level",
+        "hdf5-shuffle",
         "help", "h",
         "hmxr-binaries",
 
+        "importance-sampling",
+        "importance-sampling-batch-size",
+        "importance-sampling-exploration-fraction",
+
         "initial-mass-function", "i",
 
         "kick-direction",
@@ -468,6 +505,7 @@ private:
         "logfile-detailed-output",
         "logfile-double-compact-objects",
         "logfile-double-compact-objects-record-types",
+        "logfile-flush",
         "logfile-name-prefix",
         "logfile-pulsar-evolution",
         "logfile-pulsar-evolution-record-types",
@@ -502,6 +540,8 @@ private:
 
         "pair-instability-supernovae",
         "population-data-printing",
+        "population-summary",
+        "population-summary-only",
         "print-bool-as-string",
         "pulsar-birth-magnetic-field-distribution",
         "pulsar-birth-spin-period-distribution",
@@ -518,6 +558,7 @@ private:
 
         "semi-major-axis-distribution",
         "stellar-zeta-prescription",
+        "startup-timing",
         "store-input-files",
         "switch-log",
 
@@ -540,19 +581,29 @@ private:
         "debug-level",
         "debug-to-file",
         "detailed-output",
+        "detailed-output-compact",
 
         "enable-warnings",
         "errors-to-file",
 
+        "fork-variations",
+
         "grid",
         "grid-start-line",
         "grid-num-lines",
 
         "hdf5-buffer-size",
         "hdf5-chunk-size",
+        "hdf5-compression",
+        "hdf5-compression-level",
+        "hdf5-shuffle",
         "help", "h",
         "hmxr-binaries",
 
+        "importance-sampling",
+        "importance-sampling-batch-size",
+        "importance-sampling-exploration-fraction",
+
         "log-classes",
         "log-level", 
 
@@ -566,6 +617,7 @@ private:
         "logfile-detailed-output-record-types",
         "logfile-double-compact-objects",
         "logfile-double-compact-objects-record-types",
+        "logfile-flush",
         "logfile-name-prefix",
         "logfile-pulsar-evolution",
         "logfile-pulsar-evolution-record-types",
@@ -587,6 +639,8 @@ private:
         "outputPath", "o",
 
         "population-data-printing",
+        "population-summary",
+        "population-summary-only",
         "print-bool-as-string",
 
         "quiet",
@@ -594,6 +648,7 @@ private:
         "random-seed",
         "rlof-printing",
 
+        "startup-timing",
         "store-input-files",
         "switch-log",
 
@@ -603,6 +658,58 @@ private:
     };
 
 
+    // m_ForkVariationsAllowed records option strings that may be specified as ranges or
+    // sets when --fork-variations is specified
+    //
+    // With --fork-variations all command-line variations in a cycle share the initial
+    // conditions of the first variation, and variations after the first resume from a
+    // snapshot of the first variation's binary taken just before its first common envelope
+    // or supernova event (see BaseBinaryStar::Evolve()).  That is only valid if the options
+    // varied are not consulted before that point, so only options that are consulted at or
+    // after the first common envelope or supernova event are allowed here.  This vector is
+    // checked in Options::Initialise() once the commandline has been parsed - if any other
+    // option is specified as a range or set an error is issued and the program stops.
+
+    std::vector<std::string> m_ForkVariationsAllowed = {
+
+        // trying to keep entries alphabetical so easier to find specific entries
+
+        "black-hole-kicks",
+
+        "common-envelope-alpha",
+        "common-envelope-alpha-thermal",
+        "common-envelope-formalism",
+        "common-envelope-lambda",
+        "common-envelope-lambda-multiplier",
+        "common-envelope-lambda-nanjing-enhanced",
+        "common-envelope-lambda-nanjing-interpolate-in-mass",
+        "common-envelope-lambda-nanjing-interpolate-in-metallicity",
+        "common-envelope-lambda-nanjing-use-rejuvenated-mass",
+        "common-envelope-lambda-prescription",
+        "common-envelope-mass-accretion-constant",
+        "common-envelope-mass-accretion-max",
+        "common-envelope-mass-accretion-min",
+        "common-envelope-mass-accretion-prescription",
+        "common-envelope-slope-kruckow",
+
+        "fryer-supernova-engine",
+
+        "kick-magnitude-distribution",
+        "kick-magnitude-max",
+        "kick-magnitude-sigma-CCSN-BH",
+        "kick-magnitude-sigma-CCSN-NS",
+        "kick-magnitude-sigma-ECSN",
+        "kick-magnitude-sigma-USSN",
+        "kick-scaling-factor",
+
+        "muller-mandel-kick-multiplier-BH",
+        "muller-mandel-kick-multiplier-NS",
+        "muller-mandel-sigma-kick",
+
+        "remnant-mass-prescription"
+    };
+
+
 public:
     
     // The OptionsValues class holds the values for the options.  This allows the Options class
@@ -644,15 +751,25 @@ public:
             bool                                                m_HMXRBinaries;                                                 // Flag if we want to store HMXRBs in RLOF output file
             bool                                                m_EvolvePulsars;                                                // Whether to evolve pulsars or not
 	        bool                                                m_EvolveUnboundSystems;							                // Option to chose if unbound systems are evolved until death or the evolution stops after the system is unbound during a SN.
+            bool                                                m_ForkVariations;                                               // Share initial conditions across the command-line variations in a cycle and resume later variations from a fork point (BSE only)
+
+            bool                                                m_ImportanceSampling;                                           // Adaptively importance sample the initial mass, mass ratio and semi-major axis around binaries that reach the evolution target (BSE only)
+            int                                                 m_ImportanceSamplingBatchSize;                                  // Number of binaries evolved between refits of the importance sampling proposal
+            double                                              m_ImportanceSamplingExplorationFraction;                        // Fraction of binaries drawn from the prior once the importance sampling proposal has been fitted
 
             bool                                                m_DetailedOutput;                                               // Print detailed output details to file (default = false)
+            bool                                                m_DetailedOutputCompact;                                        // Write BSE detailed output as compact (run-length/delta encoded) per-binary blocks (default = false)
             bool                                                m_PopulationDataPrinting;                                       // Print certain data for small populations, but not for larger one
+            std::vector<std::string>                            m_PopulationSummary;                                            // Population summary reducers - accumulated in memory and written at the end of the run
+            bool                                                m_PopulationSummaryOnly;                                        // Skip per-system BSE logfiles when population summaries are being accumulated
             bool                                                m_PrintBoolAsString;                                            // flag used to indicate that boolean properties should be printed as "TRUE" or "FALSE" (default is 1 or 0)
             bool                                                m_Quiet;                                                        // suppress some output
             bool                                                m_RlofPrinting;                                                 // RLOF printing
 
             bool                                                m_ShortHelp;                                                    // Flag to indicate whether user wants short help ('-h', just option names) or long help ('--help', plus descriptions)
 
+            bool                                                m_StartupTiming;                                                // Report the time spent in each phase of program startup (default = false)
+
             bool                                                m_StoreInputFiles;                                              // Store input files in output container (default = true)
 
             bool                                                m_SwitchLog;                                                    // Print switch log details to file (default = false)
@@ -667,6 +784,8 @@ public:
             unsigned long int                                   m_RandomSeed;                                                   // Random seed to use
     
             double                                              m_MaxEvolutionTime;                                             // Maximum time to evolve a binary by
+            ENUM_OPT<EVOLUTION_TARGET>                          m_EvolutionTarget;                                              // Stop evolving binaries that can no longer reach this target (BSE)
+            double                                              m_EvolutionTargetMinimumMass;                                   // Stop evolving binaries once each star is a WD or less massive than this (Msol, BSE)
             int                                                 m_MaxNumberOfTimestepIterations;                                // Maximum number of timesteps to evolve binary for before giving up
             double                                              m_TimestepMultiplier;                                           // Multiplier for time step size (<1 -- shorter timesteps, >1 -- longer timesteps)
 
@@ -948,6 +1067,7 @@ public:
             std::string                                         m_LogfileDefinitionsFilename;                                   // Filename for the logfile record definitions
             std::string                                         m_LogfileNamePrefix;                                            // Prefix for log file names
             ENUM_OPT<LOGFILETYPE>                               m_LogfileType;                                                  // File type log files
+            ENUM_OPT<LOGFILE_FLUSH>                             m_LogfileFlush;                                                 // When to flush CSV, TSV and TXT log files
 
             std::string                                         m_LogfileSystemParameters;                                      // output file name: system parameters
             std::string                                         m_LogfileDetailedOutput;                                        // output file name: detailed output
@@ -972,6 +1092,9 @@ public:
 
             int                                                 m_HDF5BufferSize;                                               // HDF5 file IO buffer size (number of chunks)
             int                                                 m_HDF5ChunkSize;                                                // HDF5 file chunk size (number of dataset entries)
+            ENUM_OPT<HDF5_COMPRESSION>                          m_HDF5Compression;                                              // HDF5 dataset compression
+            int                                                 m_HDF5CompressionLevel;                                         // HDF5 dataset compression level (deflate)
+            bool                                                m_HDF5Shuffle;                                                  // Apply the HDF5 shuffle filter before compression
 
 
             // YAML file
@@ -1091,12 +1214,12 @@ private:
     OptionsDescriptorT          m_CmdLine = {OPTIONS_ORIGIN::CMDLINE, {}, {}, {}, {}};
     OptionsDescriptorT          m_GridLine = {OPTIONS_ORIGIN::GRIDFILE, {}, {}, {}, {}};
 
-    std::vector<OptionDetailsT> m_CmdLineOptionsDetails;                                                    // for Run_Details and YAML files
-    std::map<std::string, std::string> m_optionDefaults;                                                    // for Run_Details and YAML files
+    std::vector<OptionDetailsT> m_CmdLineOptionsDetails;                                                    // for Run_Details and YAML files - constructed on demand
+    std::map<std::string, std::string> m_optionDefaults;                                                    // for Run_Details and YAML files - constructed on demand
 
     // member functions
 
-    bool                        AddOptions(OptionValues *p_Options, po::options_description *p_OptionsDescription);
+    bool                        AddOptions(OptionValues *p_Options, po::options_description *p_OptionsDescription, const bool p_Descriptions = false);
     std::vector<std::string>    AllowedOptionValues(const std::string p_OptionString);
     std::string                 AllowedOptionValuesFormatted(const std::string p_OptionString);
     int                         AdvanceOptionVariation(OptionsDescriptorT &p_OptionsDescriptor);
@@ -1107,7 +1230,7 @@ private:
 
     bool                        IsSupportedNumericDataType(TYPENAME p_TypeName);
 
-    ATTR                        OptionAttributes(const po::variables_map p_VM, const po::variables_map::const_iterator p_IT);
+    ATTR                        OptionAttributes(const po::variables_map& p_VM, const po::variables_map::const_iterator p_IT);
 
     PROGRAM_STATUS              ParseCommandLineOptions(int argc, char * argv[]);
     std::string                 ParseOptionValues(int p_ArgCount, char *p_ArgStrings[], OptionsDescriptorT &p_OptionsDescriptor);
@@ -1168,7 +1291,7 @@ public:
 
     bool                                        CirculariseBinaryDuringMassTransfer() const                             { return OPT_VALUE("circularise-binary-during-mass-transfer", m_CirculariseBinaryDuringMassTransfer, true); }
 
-    std::vector<OptionDetailsT>                 CmdLineOptionsDetails() const                                           { return m_CmdLineOptionsDetails; }
+    std::vector<OptionDetailsT>                 CmdLineOptionsDetails();
 
     bool                                        CommandLineGrid() const                                                 { return m_CmdLine.complexOptionValues.size() != 0; }
     
@@ -1197,6 +1320,7 @@ public:
     int                                         DebugLevel() const                                                      { return m_CmdLine.optionValues.m_DebugLevel; }
     bool                                        DebugToFile() const                                                     { return m_CmdLine.optionValues.m_DebugToFile; }
     bool                                        DetailedOutput() const                                                  { return m_CmdLine.optionValues.m_DetailedOutput; }
+    bool                                        DetailedOutputCompact() const                                           { return m_CmdLine.optionValues.m_DetailedOutputCompact; }
 
     bool                                        EnableWarnings() const                                                  { return m_CmdLine.optionValues.m_EnableWarnings; }
     bool                                        ErrorsToFile() const                                                    { return m_CmdLine.optionValues.m_ErrorsToFile; }
@@ -1207,12 +1331,15 @@ public:
     double                                      EddingtonAccretionFactor() const                                        { return OPT_VALUE("eddington-accretion-factor", m_EddingtonAccretionFactor, true); }
     ENVELOPE_STATE_PRESCRIPTION                 EnvelopeStatePrescription() const                                       { return OPT_VALUE("envelope-state-prescription", m_EnvelopeStatePrescription.type, true); }
     EVOLUTION_MODE                              EvolutionMode() const                                                   { return m_CmdLine.optionValues.m_EvolutionMode.type; }
+    EVOLUTION_TARGET                            EvolutionTarget() const                                                 { return OPT_VALUE("evolution-target", m_EvolutionTarget.type, true); }
+    double                                      EvolutionTargetMinimumMass() const                                      { return OPT_VALUE("evolution-target-minimum-mass", m_EvolutionTargetMinimumMass, true); }
     bool                                        EvolvePulsars() const                                                   { return OPT_VALUE("evolve-pulsars", m_EvolvePulsars, true); }
     bool                                        EvolveUnboundSystems() const                                            { return OPT_VALUE("evolve-unbound-systems", m_EvolveUnboundSystems, true); }
 
     bool                                        FixedRandomSeedCmdLine() const                                          { return m_CmdLine.optionValues.m_FixedRandomSeed; }
     bool                                        FixedRandomSeedGridLine() const                                         { return m_GridLine.optionValues.m_FixedRandomSeed; }
     double                                      FixedUK() const                                                         { return m_GridLine.optionValues.m_UseFixedUK || m_CmdLine.optionValues.m_FixedUK; }
+    bool                                        ForkVariations() const                                                  { return m_CmdLine.optionValues.m_ForkVariations; }
     SN_ENGINE                                   FryerSupernovaEngine() const                                            { return OPT_VALUE("fryer-supernova-engine", m_FryerSupernovaEngine.type, true); }
     double                                      Fryer22fmix() const                                                     { return OPT_VALUE("fryer-22-fmix", m_Fryer22fmix, true); }
     double                                      Fryer22Mcrit() const                                                    { return OPT_VALUE("fryer-22-mcrit", m_Fryer22Mcrit, true); }
@@ -1223,8 +1350,15 @@ public:
 
     size_t                                      HDF5ChunkSize() const                                                   { return m_CmdLine.optionValues.m_HDF5ChunkSize; }
     size_t                                      HDF5BufferSize() const                                                  { return m_CmdLine.optionValues.m_HDF5BufferSize; }
+    HDF5_COMPRESSION                            HDF5Compression() const                                                 { return m_CmdLine.optionValues.m_HDF5Compression.type; }
+    int                                         HDF5CompressionLevel() const                                            { return m_CmdLine.optionValues.m_HDF5CompressionLevel; }
+    bool                                        HDF5Shuffle() const                                                     { return m_CmdLine.optionValues.m_HDF5Shuffle; }
     bool                                        HMXRBinaries() const                                                    { return OPT_VALUE("hmxr-binaries", m_HMXRBinaries, false); }
 
+    bool                                        ImportanceSampling() const                                              { return m_CmdLine.optionValues.m_ImportanceSampling; }
+    int                                         ImportanceSamplingBatchSize() const                                     { return m_CmdLine.optionValues.m_ImportanceSamplingBatchSize; }
+    double                                      ImportanceSamplingExplorationFraction() const                           { return m_CmdLine.optionValues.m_ImportanceSamplingExplorationFraction; }
+
     double                                      InitialMass() const                                                     { return OPT_VALUE("initial-mass", m_InitialMass, true); }
     double                                      InitialMass1() const                                                    { return OPT_VALUE("initial-mass-1", m_InitialMass1, true); }
     double                                      InitialMass2() const                                                    { return OPT_VALUE("initial-mass-2", m_InitialMass2, true); }
@@ -1298,6 +1432,7 @@ public:
                                                                                                                                       );
                                                                                                                         }
     int                                         LogfileSystemParametersRecordTypes() const                              { return m_CmdLine.optionValues.m_LogfileSystemParametersRecordTypes; }
+    LOGFILE_FLUSH                               LogfileFlush() const                                                    { return m_CmdLine.optionValues.m_LogfileFlush.type; }
     LOGFILETYPE                                 LogfileType() const                                                     { return m_CmdLine.optionValues.m_LogfileType.type; }
     std::string                                 LogfileTypeString() const                                               { return m_CmdLine.optionValues.m_LogfileType.typeString; }
     int                                         LogLevel() const                                                        { return m_CmdLine.optionValues.m_LogLevel; }
@@ -1382,6 +1517,8 @@ public:
     double                                      PairInstabilityUpperLimit() const                                       { return OPT_VALUE("PISN-upper-limit", m_PairInstabilityUpperLimit, true); }
 
     bool                                        PopulationDataPrinting() const                                          { return m_CmdLine.optionValues.m_PopulationDataPrinting; }
+    std::vector<std::string>                    PopulationSummary() const                                               { return m_CmdLine.optionValues.m_PopulationSummary; }
+    bool                                        PopulationSummaryOnly() const                                           { return m_CmdLine.optionValues.m_PopulationSummaryOnly; }
     bool                                        PrintBoolAsString() const                                               { return m_CmdLine.optionValues.m_PrintBoolAsString; }
 
     PULSAR_BIRTH_MAGNETIC_FIELD_DISTRIBUTION    PulsarBirthMagneticFieldDistribution() const                            { return OPT_VALUE("pulsar-birth-magnetic-field-distribution", m_PulsarBirthMagneticFieldDistribution.type, true); }
@@ -1438,6 +1575,7 @@ public:
     double                                      SN_Theta1() const                                                       { return OPT_VALUE("kick-theta-1", m_KickTheta1, false); }
     double                                      SN_Theta2() const                                                       { return OPT_VALUE("kick-theta-2", m_KickTheta2, false); }
 
+    bool                                        StartupTiming() const                                                   { return m_CmdLine.optionValues.m_StartupTiming; }
     bool                                        StoreInputFiles() const                                                 { return m_CmdLine.optionValues.m_StoreInputFiles; }
     bool                                        SwitchLog() const                                                       { return m_CmdLine.optionValues.m_SwitchLog; }
 
@@ -50,6 +50,7 @@ void Rand::Initialise() {
  */
 void Rand::Free() {
     gsl_rng_free(m_Rng);
+    if (m_SavedRng) gsl_rng_free(m_SavedRng);
 }
 
 
@@ -118,3 +119,38 @@ int Rand::RandomInt(const int p_Lower, const int p_Upper) {
 double Rand::RandomGaussian(const double p_Sigma) {
     return gsl_ran_gaussian(m_Rng, p_Sigma);
 }
+
+
+/*
+ * Save the current state of the random number generator
+ *
+ * Only one state is saved - saving the state overwrites any previously saved state.
+ * The saved state can be restored (any number of times) with RestoreState().
+ *
+ *
+ * void SaveState()
+ */
+void Rand::SaveState() {
+
+    if (!m_SavedRng) m_SavedRng = gsl_rng_clone(m_Rng);                                         // first save - allocate
+    else             gsl_rng_memcpy(m_SavedRng, m_Rng);                                         // copy state
+
+    m_SavedSeed = m_Seed;
+}
+
+
+/*
+ * Restore the state of the random number generator saved by SaveState()
+ *
+ * Does nothing if no state has been saved.
+ *
+ *
+ * void RestoreState()
+ */
+void Rand::RestoreState() {
+
+    if (!m_SavedRng) return;                                                                    // nothing saved
+
+    gsl_rng_memcpy(m_Rng, m_SavedRng);                                                          // copy state
+    m_Seed = m_SavedSeed;
+}
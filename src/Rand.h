@@ -19,15 +19,17 @@ class Rand {
 
 private:
 
-    Rand() { m_Rng = NULL; };
+    Rand() { m_Rng = NULL; m_SavedRng = NULL; };
     Rand(Rand const&) = delete;
     Rand& operator = (Rand const&) = delete;
 
     static Rand*      m_Instance;
 
     gsl_rng*          m_Rng;                                                                           // GSL random number generator
+    gsl_rng*          m_SavedRng;                                                                      // Saved state of the GSL random number generator - see SaveState()
 
     unsigned long int m_Seed;
+    unsigned long int m_SavedSeed;
 
 
 public:
@@ -46,6 +48,9 @@ public:
     int           RandomInt(const int p_Lower, const int p_Upper);
     int           RandomInt(const int p_Upper) { return p_Upper < 0 ? 0 : RandomInt(0, p_Upper); }
     double        RandomGaussian(const double p_Sigma);
+
+    void          RestoreState();
+    void          SaveState();
 };
 
 
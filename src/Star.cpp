@@ -1,14 +1,20 @@
 #include "Star.h"
 #include <algorithm>
-#include <csignal>
+#include <new>
 
 // Default constructor
-Star::Star() : m_Star(new BaseStar()) {
+Star::Star() {
 
     m_ObjectId   = globalObjectId++;                                                                // set object id
     m_ObjectType = OBJECT_TYPE::STAR;                                                               // set object type
 
-    m_SaveStar = nullptr;
+    m_Star         = new (Slot(0)) BaseStar();                                                      // construct underlying BaseStar object in place
+    m_StarSlot     = 0;
+
+    m_SaveStar     = nullptr;
+    m_SaveStarSlot = -1;
+
+    m_Observer     = nullptr;
 }
 
 
@@ -23,7 +29,13 @@ Star::Star(const unsigned long int p_RandomSeed,
     m_ObjectId   = globalObjectId++;                                                                                // set object id
     m_ObjectType = OBJECT_TYPE::STAR;                                                                               // set object type
 
-    m_Star = new BaseStar(p_RandomSeed, p_MZAMS, p_Metallicity, p_KickParameters, p_RotationalVelocity);            // create underlying BaseStar object
+    m_Star         = new (Slot(0)) BaseStar(p_RandomSeed, p_MZAMS, p_Metallicity, p_KickParameters, p_RotationalVelocity); // construct underlying BaseStar object in place
+    m_StarSlot     = 0;
+
+    m_SaveStar     = nullptr;
+    m_SaveStarSlot = -1;
+
+    m_Observer     = nullptr;
 
     // star begins life as a main sequence star, unless it is
     // spinning fast enough for it to be chemically homogeneous
@@ -37,42 +49,50 @@ Star::Star(const unsigned long int p_RandomSeed,
     else {
         (void)SwitchTo(STELLAR_TYPE::MS_GT_07, true);                                                               // MS > 0.7 Msol
     }
-
-    m_SaveStar = nullptr;
 }
 
 
 /*
  * Clone underlying BaseStar
  *
- * Instantiates new object of current underlying star class and initialises
- * it with the star object passed as p_Star
+ * Instantiates new object of current underlying star class, in place in the slot
+ * specified, as a copy of the star object passed as p_Star
+ *
+ * The copy is made with the copy constructor of the underlying star class so that
+ * member variables declared in the derived classes (e.g. the white dwarf and neutron
+ * star attributes) are copied along with those declared in BaseStar
+ *
  *
+ * BaseStar* Clone(const BaseStar& p_Star, const int p_Slot)
  *
- * BaseStar* Clone()
+ * @param   [IN]    p_Star                      The star object to be cloned
+ * @param   [IN]    p_Slot                      The (free) slot in which the clone should be constructed
+ * @return                                      Pointer to the clone (nullptr if the stellar type is unknown)
  */
-BaseStar* Star::Clone(const BaseStar& p_Star) {
+BaseStar* Star::Clone(const BaseStar& p_Star, const int p_Slot) {
+
+    void *slot = Slot(p_Slot);
 
     BaseStar *ptr = nullptr;
 
     switch (p_Star.StellarType()) {
-        case STELLAR_TYPE::MS_LTE_07                                : {ptr = new MS_lte_07(p_Star, false);} break;
-        case STELLAR_TYPE::MS_GT_07                                 : {ptr = new MS_gt_07(p_Star, false);} break;
-        case STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS                   : {ptr = new CH(p_Star, false);} break;
-        case STELLAR_TYPE::HERTZSPRUNG_GAP                          : {ptr = new HG(p_Star, false);} break;
-        case STELLAR_TYPE::FIRST_GIANT_BRANCH                       : {ptr = new FGB(p_Star, false);} break;
-        case STELLAR_TYPE::CORE_HELIUM_BURNING                      : {ptr = new CHeB(p_Star, false);} break;
-        case STELLAR_TYPE::EARLY_ASYMPTOTIC_GIANT_BRANCH            : {ptr = new EAGB(p_Star, false);} break;
-        case STELLAR_TYPE::THERMALLY_PULSING_ASYMPTOTIC_GIANT_BRANCH: {ptr = new TPAGB(p_Star, false);} break;
-        case STELLAR_TYPE::NAKED_HELIUM_STAR_MS                     : {ptr = new HeMS(p_Star, false);} break;
-        case STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP        : {ptr = new HeHG(p_Star, false);} break;
-        case STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH           : {ptr = new HeGB(p_Star, false);} break;
-        case STELLAR_TYPE::HELIUM_WHITE_DWARF                       : {ptr = new HeWD(p_Star, false);} break;
-        case STELLAR_TYPE::CARBON_OXYGEN_WHITE_DWARF                : {ptr = new COWD(p_Star, false);} break;
-        case STELLAR_TYPE::OXYGEN_NEON_WHITE_DWARF                  : {ptr = new ONeWD(p_Star, false);} break;
-        case STELLAR_TYPE::NEUTRON_STAR                             : {ptr = new NS(p_Star, false);} break;
-        case STELLAR_TYPE::BLACK_HOLE                               : {ptr = new BH(p_Star, false);} break;
-        case STELLAR_TYPE::MASSLESS_REMNANT                         : {ptr = new MR(p_Star, false);} break;
+        case STELLAR_TYPE::MS_LTE_07                                : {ptr = new (slot) MS_lte_07(dynamic_cast<const MS_lte_07&>(p_Star));} break;
+        case STELLAR_TYPE::MS_GT_07                                 : {ptr = new (slot) MS_gt_07(dynamic_cast<const MS_gt_07&>(p_Star));} break;
+        case STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS                   : {ptr = new (slot) CH(dynamic_cast<const CH&>(p_Star));} break;
+        case STELLAR_TYPE::HERTZSPRUNG_GAP                          : {ptr = new (slot) HG(dynamic_cast<const HG&>(p_Star));} break;
+        case STELLAR_TYPE::FIRST_GIANT_BRANCH                       : {ptr = new (slot) FGB(dynamic_cast<const FGB&>(p_Star));} break;
+        case STELLAR_TYPE::CORE_HELIUM_BURNING                      : {ptr = new (slot) CHeB(dynamic_cast<const CHeB&>(p_Star));} break;
+        case STELLAR_TYPE::EARLY_ASYMPTOTIC_GIANT_BRANCH            : {ptr = new (slot) EAGB(dynamic_cast<const EAGB&>(p_Star));} break;
+        case STELLAR_TYPE::THERMALLY_PULSING_ASYMPTOTIC_GIANT_BRANCH: {ptr = new (slot) TPAGB(dynamic_cast<const TPAGB&>(p_Star));} break;
+        case STELLAR_TYPE::NAKED_HELIUM_STAR_MS                     : {ptr = new (slot) HeMS(dynamic_cast<const HeMS&>(p_Star));} break;
+        case STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP        : {ptr = new (slot) HeHG(dynamic_cast<const HeHG&>(p_Star));} break;
+        case STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH           : {ptr = new (slot) HeGB(dynamic_cast<const HeGB&>(p_Star));} break;
+        case STELLAR_TYPE::HELIUM_WHITE_DWARF                       : {ptr = new (slot) HeWD(dynamic_cast<const HeWD&>(p_Star));} break;
+        case STELLAR_TYPE::CARBON_OXYGEN_WHITE_DWARF                : {ptr = new (slot) COWD(dynamic_cast<const COWD&>(p_Star));} break;
+        case STELLAR_TYPE::OXYGEN_NEON_WHITE_DWARF                  : {ptr = new (slot) ONeWD(dynamic_cast<const ONeWD&>(p_Star));} break;
+        case STELLAR_TYPE::NEUTRON_STAR                             : {ptr = new (slot) NS(dynamic_cast<const NS&>(p_Star));} break;
+        case STELLAR_TYPE::BLACK_HOLE                               : {ptr = new (slot) BH(dynamic_cast<const BH&>(p_Star));} break;
+        case STELLAR_TYPE::MASSLESS_REMNANT                         : {ptr = new (slot) MR(dynamic_cast<const MR&>(p_Star));} break;
         default: break;                                             // avoids compiler warning - this should never happen
     }
 
@@ -85,8 +105,21 @@ Star::Star(const Star& p_Star) {
     m_ObjectId   = globalObjectId++;                                                    // set object id
     m_ObjectType = OBJECT_TYPE::STAR;                                                   // set object type
 
-    m_Star     = p_Star.m_Star ? Clone(*(p_Star.m_Star)) : nullptr;                     // copy underlying BaseStar object
-    m_SaveStar = p_Star.m_SaveStar ? Clone(*(p_Star.m_Star)) : nullptr;                 // and the saved copy
+    m_Star         = nullptr;
+    m_StarSlot     = -1;
+    m_SaveStar     = nullptr;
+    m_SaveStarSlot = -1;
+
+    m_Observer     = nullptr;                                                           // the observer is not copied - the owner of the copy registers if required
+
+    if (p_Star.m_Star) {                                                                // copy underlying BaseStar object
+        m_StarSlot = FreeSlot();
+        m_Star     = Clone(*(p_Star.m_Star), m_StarSlot);
+    }
+    if (p_Star.m_SaveStar) {                                                            // and the saved copy
+        m_SaveStarSlot = FreeSlot();
+        m_SaveStar     = Clone(*(p_Star.m_Star), m_SaveStarSlot);
+    }
 }
 
 
@@ -97,12 +130,19 @@ Star& Star::operator = (const Star& p_Star) {
 
         m_ObjectId   = globalObjectId++;                                                // set object id
         m_ObjectType = OBJECT_TYPE::STAR;                                               // set object type
+                                                                                        // m_Observer unchanged - the observer belongs to the owner of this star, not to the source
 
-        delete m_Star;
-        m_Star = p_Star.m_Star ? Clone(*(p_Star.m_Star)) : nullptr;                     // copy underlying BaseStar object
+        DestroyStar(m_Star, m_StarSlot);
+        DestroyStar(m_SaveStar, m_SaveStarSlot);
 
-        delete m_SaveStar;
-        m_SaveStar = p_Star.m_SaveStar ? Clone(*(p_Star.m_SaveStar)) : nullptr;         // and the saved copy
+        if (p_Star.m_Star) {                                                            // copy underlying BaseStar object
+            m_StarSlot = FreeSlot();
+            m_Star     = Clone(*(p_Star.m_Star), m_StarSlot);
+        }
+        if (p_Star.m_SaveStar) {                                                        // and the saved copy
+            m_SaveStarSlot = FreeSlot();
+            m_SaveStar     = Clone(*(p_Star.m_SaveStar), m_SaveStarSlot);
+        }
     }
     return *this;
 }
@@ -111,8 +151,8 @@ Star& Star::operator = (const Star& p_Star) {
 /*
  * Switch to required star type
  *
- * Instantiates new object of required class, deletes existing pointer to star object and
- * replaces it with pointer to newly instantiated object
+ * Instantiates new object of required class in the free slot, destroys the existing star
+ * object (its slot becomes the free slot) and replaces it with the newly instantiated object
  *
  *
  * STELLAR_TYPE SwitchTo(const STELLAR_TYPE p_StellarType, bool p_SetInitialState)
@@ -130,46 +170,54 @@ STELLAR_TYPE Star::SwitchTo(const STELLAR_TYPE p_StellarType, bool p_SetInitialT
     // (the call to SwitchTo() in Star::EvolveOneTimestep() doesn't check - it relies on the check here)
 
     if (p_StellarType != m_Star->StellarType()) {
-        BaseStar *ptr = nullptr;
+        BaseStar *ptr  = nullptr;
+        int       free = FreeSlot();
+        void     *slot = Slot(free);
 
         switch (p_StellarType) {
-            case STELLAR_TYPE::MS_LTE_07                                : {ptr = new MS_lte_07(*m_Star);} break;
-            case STELLAR_TYPE::MS_GT_07                                 : {ptr = new MS_gt_07(*m_Star);} break;
-            case STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS                   : {ptr = new CH(*m_Star);} break;
-            case STELLAR_TYPE::HERTZSPRUNG_GAP                          : {ptr = new HG(*m_Star);} break;
-            case STELLAR_TYPE::FIRST_GIANT_BRANCH                       : {ptr = new FGB(*m_Star);} break;
-            case STELLAR_TYPE::CORE_HELIUM_BURNING                      : {ptr = new CHeB(*m_Star);} break;
-            case STELLAR_TYPE::EARLY_ASYMPTOTIC_GIANT_BRANCH            : {ptr = new EAGB(*m_Star);} break;
-            case STELLAR_TYPE::THERMALLY_PULSING_ASYMPTOTIC_GIANT_BRANCH: {ptr = new TPAGB(*m_Star);} break;
-            case STELLAR_TYPE::NAKED_HELIUM_STAR_MS                     : {ptr = new HeMS(*m_Star);} break;
-            case STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP        : {ptr = new HeHG(*m_Star);} break;
-            case STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH           : {ptr = new HeGB(*m_Star);} break;
-            case STELLAR_TYPE::HELIUM_WHITE_DWARF                       : {ptr = new HeWD(*m_Star);} break;
-            case STELLAR_TYPE::CARBON_OXYGEN_WHITE_DWARF                : {ptr = new COWD(*m_Star);} break;
-            case STELLAR_TYPE::OXYGEN_NEON_WHITE_DWARF                  : {ptr = new ONeWD(*m_Star);} break;
-            case STELLAR_TYPE::NEUTRON_STAR                             : {ptr = new NS(*m_Star);} break;
-            case STELLAR_TYPE::BLACK_HOLE                               : {ptr = new BH(*m_Star);} break;
-            case STELLAR_TYPE::MASSLESS_REMNANT                         : {ptr = new MR(*m_Star);} break;
+            case STELLAR_TYPE::MS_LTE_07                                : {ptr = new (slot) MS_lte_07(*m_Star);} break;
+            case STELLAR_TYPE::MS_GT_07                                 : {ptr = new (slot) MS_gt_07(*m_Star);} break;
+            case STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS                   : {ptr = new (slot) CH(*m_Star);} break;
+            case STELLAR_TYPE::HERTZSPRUNG_GAP                          : {ptr = new (slot) HG(*m_Star);} break;
+            case STELLAR_TYPE::FIRST_GIANT_BRANCH                       : {ptr = new (slot) FGB(*m_Star);} break;
+            case STELLAR_TYPE::CORE_HELIUM_BURNING                      : {ptr = new (slot) CHeB(*m_Star);} break;
+            case STELLAR_TYPE::EARLY_ASYMPTOTIC_GIANT_BRANCH            : {ptr = new (slot) EAGB(*m_Star);} break;
+            case STELLAR_TYPE::THERMALLY_PULSING_ASYMPTOTIC_GIANT_BRANCH: {ptr = new (slot) TPAGB(*m_Star);} break;
+            case STELLAR_TYPE::NAKED_HELIUM_STAR_MS                     : {ptr = new (slot) HeMS(*m_Star);} break;
+            case STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP        : {ptr = new (slot) HeHG(*m_Star);} break;
+            case STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH           : {ptr = new (slot) HeGB(*m_Star);} break;
+            case STELLAR_TYPE::HELIUM_WHITE_DWARF                       : {ptr = new (slot) HeWD(*m_Star);} break;
+            case STELLAR_TYPE::CARBON_OXYGEN_WHITE_DWARF                : {ptr = new (slot) COWD(*m_Star);} break;
+            case STELLAR_TYPE::OXYGEN_NEON_WHITE_DWARF                  : {ptr = new (slot) ONeWD(*m_Star);} break;
+            case STELLAR_TYPE::NEUTRON_STAR                             : {ptr = new (slot) NS(*m_Star);} break;
+            case STELLAR_TYPE::BLACK_HOLE                               : {ptr = new (slot) BH(*m_Star);} break;
+            case STELLAR_TYPE::MASSLESS_REMNANT                         : {ptr = new (slot) MR(*m_Star);} break;
             default: break;                                             // avoids compiler warning - this should never happen
         }
 
         if (ptr) {
-            delete m_Star;
-            m_Star = ptr;
+            DestroyStar(m_Star, m_StarSlot);
+            m_Star     = ptr;
+            m_StarSlot = free;
 
             if (p_SetInitialType) m_Star->SetInitialType(p_StellarType);
         }
 
-        // write to switch log file if required
+        // notify observer, or write to switch log file if required
 
-        if (utils::IsOneOf(stellarTypePrev, EVOLVABLE_TYPES) && OPTIONS->SwitchLog()) {     // star should be evolving from one of the evolvable types (We don't want the initial switch from Star->MS.  Not necessary for BSE (handled differently), but no harm)
-        
-            LOGGING->SetSwitchParameters(m_ObjectId, stellarTypePrev, p_StellarType);       // store switch details to LOGGING service
-            if (OPTIONS->EvolutionMode() == EVOLUTION_MODE::BSE) {                          // BSE?
-                raise(SIGUSR1);                                                             // signal to BSE that switch is occurring
+        if (utils::IsOneOf(stellarTypePrev, EVOLVABLE_TYPES)) {                             // star should be evolving from one of the evolvable types (we don't want the initial switch from Star->MS)
+
+            if (m_Observer) {                                                               // observed (e.g. BSE constituent star)?
+                m_Observer->StellarTypeSwitched(this, stellarTypePrev, p_StellarType);      // yes - the observer handles the switch log
+
+                SN_EVENT snEvent = m_Star->SN_Type();
+                if (snEvent != SN_EVENT::NONE && utils::IsOneOf(p_StellarType, StellarTypeMask(STELLAR_TYPE::NEUTRON_STAR, STELLAR_TYPE::BLACK_HOLE, STELLAR_TYPE::MASSLESS_REMNANT))) {
+                    m_Observer->SupernovaOccurred(this, snEvent);                           // switch to remnant because of supernova
+                }
             }
-            else {                                                                          // SSE
-                (void)m_Star->PrintSwitchLog();                                             // no need for the BSE signal shenanigans - just call the function
+            else if (OPTIONS->SwitchLog() && OPTIONS->EvolutionMode() == EVOLUTION_MODE::SSE) { // no - SSE switch log?
+                LOGGING->SetSwitchParameters(m_ObjectId, stellarTypePrev, p_StellarType);   // yes - store switch details to LOGGING service
+                (void)m_Star->PrintSwitchLog();                                             // print switch log record
             }
         }
     }
@@ -178,27 +226,44 @@ STELLAR_TYPE Star::SwitchTo(const STELLAR_TYPE p_StellarType, bool p_SetInitialT
 }
 
 
+/*
+ * Resolve envelope loss and switch to the resulting stellar type
+ *
+ * Notifies the observer (if any) of the envelope loss if the stellar type changed
+ *
+ *
+ * void ResolveEnvelopeLossAndSwitch()
+ */
+void Star::ResolveEnvelopeLossAndSwitch() {
+
+    STELLAR_TYPE stellarTypePrev = SwitchTo(m_Star->ResolveEnvelopeLoss(true));
+
+    if (m_Observer && m_Star->StellarType() != stellarTypePrev) m_Observer->EnvelopeLost(this, stellarTypePrev, m_Star->StellarType());
+}
+
+
 /*
  * Save current state of star
  *
- * Instantiates new object of current star class, deletes existing pointer to saved star
- * object (if it exists) and replaces it with pointer to newly instantiated object
+ * Destroys the existing saved star object (if it exists) and replaces it with a new
+ * object of the current star class, instantiated (in place) from the current star
  *
  *
  * void SaveState()
  */
 void Star::SaveState() {
 
-    delete m_SaveStar;
-    m_SaveStar = Clone(*m_Star);
+    DestroyStar(m_SaveStar, m_SaveStarSlot);
+    m_SaveStarSlot = FreeSlot();
+    m_SaveStar     = Clone(*m_Star, m_SaveStarSlot);
 }
 
 
 /*
  * Revert to the saved state of the star
  *
- * Changes the current star pointer (m_Star) to point to the save star object and
- * set the saved star pointer (m_SaveStar) to null.  Setting the saved state pointer
+ * Destroys the current star object, changes the current star pointer (m_Star) to point
+ * to the saved star object (in its slot) and sets the saved star pointer (m_SaveStar) to null.  Setting the saved state pointer
  * to null means there will be no saved state after calling this function - so state
  * needs to be saved if necessary (I don't do it here because we may not need to).
  *
@@ -211,10 +276,12 @@ bool Star::RevertState() {
     bool result = false;
 
     if (m_SaveStar) {
-        delete m_Star;
-        m_Star     = m_SaveStar;
-        m_SaveStar = nullptr;
-        result     = true;
+        DestroyStar(m_Star, m_StarSlot);
+        m_Star         = m_SaveStar;
+        m_StarSlot     = m_SaveStarSlot;
+        m_SaveStar     = nullptr;
+        m_SaveStarSlot = -1;
+        result         = true;
     }
 
     return result;
@@ -496,9 +563,9 @@ EVOLUTION_STATUS Star::Evolve(const long int p_Id) {
         else if (stepNum >= OPTIONS->MaxNumberOfTimestepIterations()) {
             status = EVOLUTION_STATUS::STEPS_UP;                                    // out of steps...
         }
-        else if (!m_Star->IsOneOf({ STELLAR_TYPE::MS_LTE_07, STELLAR_TYPE::MS_GT_07, STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS, STELLAR_TYPE::HERTZSPRUNG_GAP,
+        else if (!m_Star->IsOneOf(StellarTypeMask(STELLAR_TYPE::MS_LTE_07, STELLAR_TYPE::MS_GT_07, STELLAR_TYPE::CHEMICALLY_HOMOGENEOUS, STELLAR_TYPE::HERTZSPRUNG_GAP,
                                     STELLAR_TYPE::FIRST_GIANT_BRANCH, STELLAR_TYPE::CORE_HELIUM_BURNING, STELLAR_TYPE::EARLY_ASYMPTOTIC_GIANT_BRANCH, STELLAR_TYPE::THERMALLY_PULSING_ASYMPTOTIC_GIANT_BRANCH,
-                                    STELLAR_TYPE::NAKED_HELIUM_STAR_MS, STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP, STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH })) {
+                                    STELLAR_TYPE::NAKED_HELIUM_STAR_MS, STELLAR_TYPE::NAKED_HELIUM_STAR_HERTZSPRUNG_GAP, STELLAR_TYPE::NAKED_HELIUM_STAR_GIANT_BRANCH))) {
 
             status = EVOLUTION_STATUS::DONE;                                        // we're done
         }
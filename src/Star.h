@@ -2,11 +2,13 @@
 #define __Star_h__
 
 #include <fstream>
+#include <type_traits>
 
 #include "constants.h"
 #include "typedefs.h"
 #include "profiling.h"
 #include "utils.h"
+#include "ObjectPool.h"
 
 #include "BaseStar.h"
 #include "MS_lte_07.h"
@@ -47,6 +49,66 @@ class BH;
 class MR;
 
 
+/*
+ * Size and alignment of the largest of a list of types
+ *
+ * Used to size the in-place storage for the underlying star object (see Star below)
+ */
+template <typename T, typename... Ts>
+struct LargestOf {
+    static constexpr std::size_t size  = sizeof(T)  > LargestOf<Ts...>::size  ? sizeof(T)  : LargestOf<Ts...>::size;
+    static constexpr std::size_t align = alignof(T) > LargestOf<Ts...>::align ? alignof(T) : LargestOf<Ts...>::align;
+};
+
+template <typename T>
+struct LargestOf<T> {
+    static constexpr std::size_t size  = sizeof(T);
+    static constexpr std::size_t align = alignof(T);
+};
+
+
+class Star;
+
+/*
+ * StarObserver - receives notification of stellar events from a Star
+ *
+ * An object that needs to know when a star it owns switches stellar type, undergoes a supernova, or
+ * loses its envelope (e.g. BaseBinaryStar, for the BSE Switch Log) derives from this class, overrides
+ * the functions for the events it is interested in, and registers itself with the star (see
+ * Star::SetObserver()).  The star calls the observer directly, so notification is a virtual function
+ * call (previously the BSE Switch Log was driven by raising SIGUSR1 and catching it in main()).
+ *
+ * A star has at most one observer, and the observer is not copied when the star is copied - the
+ * owner of the copy must register with it if required.  Notifications are only sent for stars that
+ * are evolving (not for the initial switch from BaseStar to the ZAMS stellar type).
+ */
+class StarObserver {
+
+public:
+
+    virtual ~StarObserver() { }
+
+    virtual void StellarTypeSwitched(const Star* p_Star, const STELLAR_TYPE p_From, const STELLAR_TYPE p_To)    { }     // p_Star has switched from stellar type p_From to p_To
+    virtual void SupernovaOccurred(const Star* p_Star, const SN_EVENT p_SNEvent)                               { }     // p_Star has undergone a supernova of type p_SNEvent (after the switch to the remnant type)
+    virtual void EnvelopeLost(const Star* p_Star, const STELLAR_TYPE p_From, const STELLAR_TYPE p_To)          { }     // p_Star has lost its envelope (and switched from stellar type p_From to p_To)
+};
+
+
+/*
+ * Star - a single star, the stellar type of which changes as it evolves
+ *
+ * The underlying star object is an object of the class for the current stellar type (MS_lte_07, HG, ...
+ * BH, MR), and is replaced by an object of a different class when the star switches stellar type (see
+ * SwitchTo()).  A copy of the underlying star object is also kept so that the star can be reverted to
+ * its previous state (see SaveState() and RevertState()).
+ *
+ * The underlying star objects are not allocated on the heap: they are constructed in place (placement new)
+ * in fixed, suitably aligned, slots inside the Star object, and destroyed in place.  There are three slots:
+ * the current star, the saved star, and a free slot into which the new object is constructed (from the
+ * current star) when switching stellar type or saving state - after which the old object is destroyed and
+ * its slot becomes the free slot.  Switching stellar type and saving state therefore never allocate or free
+ * the star object itself (the star's coefficient and timescale vectors are still copied, as before).
+ */
 class Star {
 
 public:
@@ -63,7 +125,10 @@ public:
 
     Star& operator = (const Star& p_Star);
 
-    virtual ~Star() { delete m_Star; delete m_SaveStar; }
+    virtual ~Star() { DestroyStar(m_Star, m_StarSlot); DestroyStar(m_SaveStar, m_SaveStarSlot); }
+
+    // objects are allocated from a pool rather than the heap - see ObjectPool.h
+    POOLED_ALLOCATION(Star)
 
 
     // object identifiers - all classes have these
@@ -190,8 +255,6 @@ public:
 
     void            ClearCurrentSNEvent()                                                                           { m_Star->ClearCurrentSNEvent(); }
 
-    BaseStar*       Clone(const BaseStar& p_Star);
-
     ACCRETION_REGIME DetermineAccretionRegime(const bool p_HeRich,
                                               const double p_DonorThermalMassLossRate)                              { return m_Star->DetermineAccretionRegime(p_HeRich, p_DonorThermalMassLossRate); }  // Used in WDs
 
@@ -209,7 +272,7 @@ public:
     void            ResolveAccretionRegime(const ACCRETION_REGIME p_Regime,
                                            const double p_DonorThermalMassLossRate)                                 { m_Star->ResolveAccretionRegime(p_Regime, p_DonorThermalMassLossRate); }  // Used in WDs
 
-    void            ResolveEnvelopeLossAndSwitch()                                                                  { (void)SwitchTo(m_Star->ResolveEnvelopeLoss(true)); }
+    void            ResolveEnvelopeLossAndSwitch();
 
     void            ResolveShellChange(const double p_AccretedMass)                                                 { m_Star->ResolveShellChange(p_AccretedMass); }  // Used in WDs
 
@@ -217,6 +280,8 @@ public:
 
     void            SaveState();
 
+    void            SetObserver(StarObserver* p_Observer)                                                           { m_Observer = p_Observer; }
+
     void            SetSNCurrentEvent(const SN_EVENT p_SNEvent)                                                     { m_Star->SetSNCurrentEvent(p_SNEvent); }
     void            SetSNPastEvent(const SN_EVENT p_SNEvent)                                                        { m_Star->SetSNPastEvent(p_SNEvent); }
 
@@ -263,6 +328,25 @@ private:
     BaseStar   *m_Star;                                                                                         // pointer to current star
     BaseStar   *m_SaveStar;                                                                                     // pointer to saved star
 
+    StarObserver *m_Observer;                                                                                   // observer notified of stellar events (nullptr if none) - not owned
+
+    // in-place storage for the underlying star objects - see class description above
+    typedef LargestOf<BaseStar, MS_lte_07, MS_gt_07, CH, HG, FGB, CHeB, EAGB, TPAGB, HeMS, HeHG, HeGB, HeWD, COWD, ONeWD, NS, BH, MR> STAR_STORAGE;
+    typedef std::aligned_storage<STAR_STORAGE::size, STAR_STORAGE::align>::type StarSlotT;
+
+    static constexpr int STAR_SLOTS = 3;                                                                        // current, saved, and free
+
+    StarSlotT   m_Slots[STAR_SLOTS];                                                                            // storage for the underlying star objects
+    int         m_StarSlot;                                                                                     // slot occupied by current star (-1 if none)
+    int         m_SaveStarSlot;                                                                                 // slot occupied by saved star (-1 if none)
+
+
+    BaseStar*   Clone(const BaseStar& p_Star, const int p_Slot);
+
+    void        DestroyStar(BaseStar*& p_Star, int& p_Slot)                                                     { if (p_Star) p_Star->~BaseStar(); p_Star = nullptr; p_Slot = -1; }
+
+    int         FreeSlot() const                                                                                { int slot = 0; while (slot == m_StarSlot || slot == m_SaveStarSlot) slot++; return slot; }
+    void*       Slot(const int p_Slot)                                                                          { return static_cast<void*>(&m_Slots[p_Slot]); }
 };
 
 #endif // __Star_h__
@@ -0,0 +1,304 @@
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+#include "Summary.h"
+#include "BaseBinaryStar.h"
+
+Summary* Summary::m_Instance = nullptr;
+
+
+Summary* Summary::Instance() {
+
+    if (!m_Instance) {
+        m_Instance = new Summary();
+    }
+    return m_Instance;
+}
+
+
+Summary::~Summary() {
+    for (auto& reducer: m_Reducers) delete reducer;
+}
+
+
+/*
+ * Keyed count reducer
+ *
+ * Accumulates the binary under the key returned by the derived class (if the derived class
+ * returns false the binary is not counted).
+ *
+ *
+ * void Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight)
+ *
+ * @param   [IN]    p_Binary                    The binary that has completed its evolution
+ * @param   [IN]    p_Status                    The final evolution status of the binary
+ * @param   [IN]    p_Weight                    The weight to be accumulated for the binary
+ */
+void KeyedCountReducer::Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight) {
+    std::string key;
+    if (Key(p_Binary, p_Status, key)) m_Counts[key].Add(p_Weight);
+}
+
+
+/*
+ * Write the keyed counts to the stream provided
+ *
+ * One line per key: key, count, sum of weights, sum of squared weights
+ *
+ *
+ * void Write(std::ostream& p_Stream)
+ *
+ * @param   [IN]    p_Stream                    The stream to which the counts should be written
+ */
+void KeyedCountReducer::Write(std::ostream& p_Stream) const {
+    p_Stream << "# " << m_Name << "\n";
+    p_Stream << "Key,Count,Weight,Weight_Squared\n";
+    for (auto& entry: m_Counts) {
+        p_Stream << entry.first << "," << entry.second.count << "," << entry.second.weight << "," << entry.second.weightSq << "\n";
+    }
+    p_Stream << "\n";
+}
+
+
+HistogramReducer::HistogramReducer(const std::string p_Name, const std::string p_Units, const double p_Min, const double p_Max, const int p_Bins) : Reducer(p_Name) {
+    m_Units    = p_Units;
+    m_Min      = p_Min;
+    m_Max      = p_Max;
+    m_BinWidth = (p_Max - p_Min) / static_cast<double>(p_Bins);
+    m_Bins.assign(p_Bins + 2, { 0, 0.0, 0.0 });                                                             // includes underflow and overflow bins
+}
+
+
+/*
+ * Histogram reducer
+ *
+ * Accumulates the binary in the bin corresponding to the value returned by the derived
+ * class (if the derived class returns false the binary is not counted).  Values below the
+ * histogram minimum are accumulated in the underflow bin, and values at or above the
+ * histogram maximum are accumulated in the overflow bin.
+ *
+ *
+ * void Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight)
+ *
+ * @param   [IN]    p_Binary                    The binary that has completed its evolution
+ * @param   [IN]    p_Status                    The final evolution status of the binary
+ * @param   [IN]    p_Weight                    The weight to be accumulated for the binary
+ */
+void HistogramReducer::Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight) {
+
+    double value;
+    if (!Value(p_Binary, p_Status, value) || std::isnan(value)) return;
+
+    size_t bin;
+    if (value < m_Min)       bin = 0;                                                                       // underflow
+    else if (value >= m_Max) bin = m_Bins.size() - 1;                                                       // overflow
+    else                     bin = std::min(m_Bins.size() - 2, static_cast<size_t>((value - m_Min) / m_BinWidth) + 1);
+
+    m_Bins[bin].Add(p_Weight);
+}
+
+
+/*
+ * Write the histogram to the stream provided
+ *
+ * One line per bin: lower edge, upper edge, count, sum of weights, sum of squared weights
+ * (the underflow bin has lower edge -inf, and the overflow bin has upper edge inf)
+ *
+ *
+ * void Write(std::ostream& p_Stream)
+ *
+ * @param   [IN]    p_Stream                    The stream to which the histogram should be written
+ */
+void HistogramReducer::Write(std::ostream& p_Stream) const {
+    p_Stream << "# " << m_Name << " (" << m_Units << ")\n";
+    p_Stream << "Lower,Upper,Count,Weight,Weight_Squared\n";
+    for (size_t bin = 0; bin < m_Bins.size(); bin++) {
+        double lower = bin == 0                 ? -std::numeric_limits<double>::infinity() : m_Min + (bin - 1) * m_BinWidth;
+        double upper = bin == m_Bins.size() - 1 ?  std::numeric_limits<double>::infinity() : m_Min + bin * m_BinWidth;
+        p_Stream << lower << "," << upper << "," << m_Bins[bin].count << "," << m_Bins[bin].weight << "," << m_Bins[bin].weightSq << "\n";
+    }
+    p_Stream << "\n";
+}
+
+
+/*
+ * Built-in reducers
+ */
+
+// counts by final evolution status
+class EvolutionStatusReducer: public KeyedCountReducer {
+public:
+    EvolutionStatusReducer() : KeyedCountReducer(POPULATION_SUMMARY_LABEL.at(POPULATION_SUMMARY::EVOLUTION_STATUS)) { }
+protected:
+    bool Key(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, std::string& p_Key) const {
+        p_Key = EVOLUTION_STATUS_LABEL.at(p_Status);
+        return true;
+    }
+};
+
+
+// counts by final stellar types of the constituent stars (ordered so that the pair is independent of which star is which)
+class StellarTypesReducer: public KeyedCountReducer {
+public:
+    StellarTypesReducer() : KeyedCountReducer(POPULATION_SUMMARY_LABEL.at(POPULATION_SUMMARY::STELLAR_TYPES)) { }
+protected:
+    bool Key(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, std::string& p_Key) const {
+        STELLAR_TYPE st1 = std::min(p_Binary.StellarType1(), p_Binary.StellarType2());
+        STELLAR_TYPE st2 = std::max(p_Binary.StellarType1(), p_Binary.StellarType2());
+        p_Key = STELLAR_TYPE_LABEL.at(st1) + "+" + STELLAR_TYPE_LABEL.at(st2);
+        return true;
+    }
+};
+
+
+// counts of bound double compact objects by DCO type, mass transfer history, and whether they merge in a Hubble time
+class FormationChannelReducer: public KeyedCountReducer {
+public:
+    FormationChannelReducer() : KeyedCountReducer(POPULATION_SUMMARY_LABEL.at(POPULATION_SUMMARY::FORMATION_CHANNEL)) { }
+protected:
+    bool Key(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, std::string& p_Key) const {
+        if (!p_Binary.IsDCO() || p_Binary.IsUnbound()) return false;
+
+        p_Key  = p_Binary.IsBHandBH() ? "BHBH" : (p_Binary.IsNSandNS() ? "NSNS" : "BHNS");
+        p_Key += p_Binary.CEAtLeastOnce() ? "_CE" : (p_Binary.ExperiencedRLOF() ? "_STABLE_MT" : "_NO_MT");
+        p_Key += p_Binary.MergesInHubbleTime() ? "_MERGING" : "_NON_MERGING";
+        return true;
+    }
+};
+
+
+// chirp mass histogram of bound double compact objects that merge in a Hubble time
+class ChirpMassReducer: public HistogramReducer {
+public:
+    ChirpMassReducer() : HistogramReducer(POPULATION_SUMMARY_LABEL.at(POPULATION_SUMMARY::CHIRP_MASS), "Msol", POPULATION_SUMMARY_CHIRP_MASS_MIN, POPULATION_SUMMARY_CHIRP_MASS_MAX, POPULATION_SUMMARY_CHIRP_MASS_BINS) { }
+protected:
+    bool Value(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, double& p_Value) const {
+        if (!p_Binary.IsDCO() || p_Binary.IsUnbound() || !p_Binary.MergesInHubbleTime()) return false;
+
+        double m1 = p_Binary.Mass1();
+        double m2 = p_Binary.Mass2();
+        p_Value   = std::pow(m1 * m2, 3.0 / 5.0) / std::pow(m1 + m2, 1.0 / 5.0);
+        return true;
+    }
+};
+
+
+// log10 delay time (DCO formation time + time to coalescence) histogram of bound double compact objects that merge in a Hubble time
+class DelayTimeReducer: public HistogramReducer {
+public:
+    DelayTimeReducer() : HistogramReducer(POPULATION_SUMMARY_LABEL.at(POPULATION_SUMMARY::DELAY_TIME), "log10(Myr)", POPULATION_SUMMARY_LOG_DELAY_TIME_MIN, POPULATION_SUMMARY_LOG_DELAY_TIME_MAX, POPULATION_SUMMARY_LOG_DELAY_TIME_BINS) { }
+protected:
+    bool Value(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, double& p_Value) const {
+        if (!p_Binary.IsDCO() || p_Binary.IsUnbound() || !p_Binary.MergesInHubbleTime()) return false;
+
+        p_Value = std::log10(p_Binary.DCOFormationTime() + p_Binary.TimeToCoalescence());
+        return true;
+    }
+};
+
+
+/*
+ * Start the Summary service
+ *
+ * Registers the built-in reducers named in p_Reducers (names are expected to have been
+ * validated by the Options service - any unknown names are ignored here).  The service
+ * is enabled if at least one reducer is registered.
+ *
+ *
+ * void Start(const std::vector<std::string> p_Reducers)
+ *
+ * @param   [IN]    p_Reducers                  Names of the built-in reducers to be registered
+ */
+void Summary::Start(const std::vector<std::string> p_Reducers) {
+
+    m_BinariesAccumulated = 0;
+
+    for (auto& name: p_Reducers) {
+        bool found;
+        POPULATION_SUMMARY reducer;
+        std::tie(found, reducer) = utils::GetMapKey(name, POPULATION_SUMMARY_LABEL, POPULATION_SUMMARY::EVOLUTION_STATUS);
+        if (!found) continue;
+
+        switch (reducer) {
+            case POPULATION_SUMMARY::CHIRP_MASS       : Register(new ChirpMassReducer());        break;
+            case POPULATION_SUMMARY::DELAY_TIME       : Register(new DelayTimeReducer());        break;
+            case POPULATION_SUMMARY::EVOLUTION_STATUS : Register(new EvolutionStatusReducer());  break;
+            case POPULATION_SUMMARY::FORMATION_CHANNEL: Register(new FormationChannelReducer()); break;
+            case POPULATION_SUMMARY::STELLAR_TYPES    : Register(new StellarTypesReducer());     break;
+        }
+    }
+}
+
+
+/*
+ * Register a reducer with the Summary service
+ *
+ * The Summary service takes ownership of the reducer.  Reducers with the same name as
+ * an already registered reducer are not registered (and are deleted).
+ *
+ *
+ * void Register(Reducer* p_Reducer)
+ *
+ * @param   [IN]    p_Reducer                   The reducer to be registered
+ */
+void Summary::Register(Reducer* p_Reducer) {
+
+    for (auto& reducer: m_Reducers) {
+        if (reducer->Name() == p_Reducer->Name()) {                                                         // already registered?
+            delete p_Reducer;                                                                               // yes - don't need this one
+            return;
+        }
+    }
+
+    m_Reducers.push_back(p_Reducer);
+    m_Enabled = true;
+}
+
+
+/*
+ * Accumulate a binary that has completed its evolution in each of the registered reducers
+ *
+ *
+ * void Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight)
+ *
+ * @param   [IN]    p_Binary                    The binary that has completed its evolution
+ * @param   [IN]    p_Status                    The final evolution status of the binary
+ * @param   [IN]    p_Weight                    The weight to be accumulated for the binary (default = 1.0)
+ */
+void Summary::Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight) {
+    for (auto& reducer: m_Reducers) reducer->Accumulate(p_Binary, p_Status, p_Weight);
+    m_BinariesAccumulated++;
+}
+
+
+/*
+ * Write the population summary file
+ *
+ * Each registered reducer writes its own section, in the order in which the reducers
+ * were registered.
+ *
+ *
+ * bool Write(const std::string p_Filename)
+ *
+ * @param   [IN]    p_Filename                  The name (with path) of the file to be written
+ * @return                                      Boolean status (true = success, false = failure)
+ */
+bool Summary::Write(const std::string p_Filename) const {
+
+    if (!m_Enabled) return true;                                                                            // nothing to do
+
+    std::ofstream file(p_Filename);
+    if (!file.is_open()) return false;
+
+    file << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+
+    file << "# COMPAS population summary\n";
+    file << "# Binaries accumulated: " << m_BinariesAccumulated << "\n\n";
+
+    for (auto& reducer: m_Reducers) reducer->Write(file);
+
+    file.close();
+    return !file.fail();
+}
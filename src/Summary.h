@@ -0,0 +1,140 @@
+#ifndef __Summary_h__
+#define __Summary_h__
+
+#define SUMMARY Summary::Instance()
+
+#include "constants.h"
+#include "typedefs.h"
+
+#include <map>
+#include <ostream>
+
+
+class BaseBinaryStar;
+
+
+/*
+ * Population summary: streaming reduction of binary evolution results
+ *
+ * Much of the downstream use of the BSE_System_Parameters and BSE_Double_Compact_Objects
+ * files is aggregate (merger rates, chirp mass histograms, formation channel counts etc.),
+ * so rather than write every record and have the post-processing re-read everything, the
+ * Summary service allows a set of reducers to accumulate the quantities of interest in
+ * memory as each binary completes its evolution.  Only the compact summaries are written
+ * (to the population summary file in the output container) at the end of the run - and,
+ * if the user so chooses (--population-summary-only), the per-system BSE logfiles are not
+ * written at all.
+ *
+ * Reducers are pluggable: a reducer is any class derived from Reducer, and is registered
+ * with the Summary service via Register().  The built-in reducers are registered by Start()
+ * according to the --population-summary program option.
+ *
+ * Each binary is accumulated with a weight (its importance weight if --importance-sampling is
+ * specified - see ImportanceSampler.h - otherwise 1.0), and the reducers record the raw count,
+ * the sum of the weights, and the sum of the squared weights (so that the statistical uncertainty
+ * of a weighted count can be estimated).
+ */
+
+
+// weighted count - raw count, sum of weights, and sum of squared weights
+typedef struct WeightedCount {
+    unsigned long int count;
+    double            weight;
+    double            weightSq;
+
+    void Add(const double p_Weight) { count++; weight += p_Weight; weightSq += p_Weight * p_Weight; }
+} WeightedCountT;
+
+
+class Reducer {
+
+public:
+
+    Reducer(const std::string p_Name) : m_Name(p_Name) { }
+    virtual ~Reducer() { }
+
+    std::string  Name() const                                                                               { return m_Name; }
+
+    virtual void Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight) = 0;
+    virtual void Write(std::ostream& p_Stream) const = 0;
+
+protected:
+
+    std::string  m_Name;                                                                                    // reducer name - used as the section header in the summary file
+};
+
+
+// Counts by (string) key - derived classes decide the key for each binary (or to skip the binary)
+class KeyedCountReducer: public Reducer {
+
+public:
+
+    KeyedCountReducer(const std::string p_Name) : Reducer(p_Name) { }
+
+    void Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight);
+    void Write(std::ostream& p_Stream) const;
+
+protected:
+
+    virtual bool Key(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, std::string& p_Key) const = 0;
+
+    std::map<std::string, WeightedCountT> m_Counts;                                                         // ordered so the summary is written in a repeatable order
+};
+
+
+// Histogram with uniform bins in [min, max) plus underflow and overflow - derived classes decide
+// the value to be binned for each binary (or to skip the binary)
+class HistogramReducer: public Reducer {
+
+public:
+
+    HistogramReducer(const std::string p_Name, const std::string p_Units, const double p_Min, const double p_Max, const int p_Bins);
+
+    void Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight);
+    void Write(std::ostream& p_Stream) const;
+
+protected:
+
+    virtual bool Value(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, double& p_Value) const = 0;
+
+    std::string                 m_Units;                                                                    // units of binned value
+    double                      m_Min;                                                                      // lower edge of first bin
+    double                      m_Max;                                                                      // upper edge of last bin
+    double                      m_BinWidth;                                                                 // bin width
+
+    std::vector<WeightedCountT> m_Bins;                                                                     // bins - index 0 is underflow, last index is overflow
+};
+
+
+class Summary {
+
+private:
+
+    Summary() { m_Enabled = false; };
+    Summary(Summary const&) = delete;
+    Summary& operator = (Summary const&) = delete;
+    ~Summary();
+
+    static Summary*       m_Instance;
+
+    bool                  m_Enabled;                                                                        // true if any reducers are registered
+    std::vector<Reducer*> m_Reducers;                                                                       // registered reducers - owned by the Summary service
+
+    unsigned long int     m_BinariesAccumulated;                                                            // number of binaries accumulated
+
+public:
+
+    static Summary* Instance();
+
+    bool Enabled() const                                                                                    { return m_Enabled; }
+
+    void Start(const std::vector<std::string> p_Reducers);
+    void Register(Reducer* p_Reducer);
+
+    void Accumulate(const BaseBinaryStar& p_Binary, const EVOLUTION_STATUS p_Status, const double p_Weight = 1.0);
+
+    bool Write(const std::string p_Filename) const;
+};
+
+
+#endif // __Summary_h__
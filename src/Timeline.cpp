@@ -0,0 +1,320 @@
+#include <cstring>
+
+#include <boost/variant.hpp>
+
+#include "Timeline.h"
+
+
+/*
+ * Convert a boost::variant value to the representations used by the timeline encoder
+ *
+ * This is defined as a class for use with boost::apply_visitor().
+ * It is only ever used by the Timeline class, hence the reason it is defined here.
+ *
+ * Integer (including boolean and enumeration) values are returned as (two's complement) 64-bit
+ * integers, floating point values as doubles, and strings as strings (vectors of strings are
+ * returned as a single comma-separated string).
+ */
+class TimelineVariantValue: public boost::static_visitor<> {
+public:
+    TimelineVariantValue(int64_t& p_Integer, double& p_Float, std::string& p_String) : m_Integer(p_Integer), m_Float(p_Float), m_String(p_String) { }
+
+    void operator()(const bool                     v) const { m_Integer = v ? 1 : 0; }
+    void operator()(const short int                v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const int                      v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const long int                 v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const long long int            v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const unsigned short int       v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const unsigned int             v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const unsigned long int        v) const { m_Integer = static_cast<int64_t>(v); }   // also handles OBJECT_ID (typedef)
+    void operator()(const unsigned long long int   v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const float                    v) const { m_Float   = static_cast<double>(v); }
+    void operator()(const double                   v) const { m_Float   = v; }
+    void operator()(const long double              v) const { m_Float   = static_cast<double>(v); }
+    void operator()(const std::string&             v) const { m_String  = v; }
+    void operator()(const ERROR                    v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const STELLAR_TYPE             v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const MT_CASE                  v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const MT_TRACKING              v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const SN_EVENT                 v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const SN_STATE                 v) const { m_Integer = static_cast<int64_t>(v); }
+    void operator()(const std::vector<std::string>& v) const {
+                                                        m_String.clear();
+                                                        for (std::size_t idx = 0; idx < v.size(); idx++) m_String += (idx > 0 ? "," : "") + v[idx];
+                                                     }
+private:
+    int64_t&     m_Integer;
+    double&      m_Float;
+    std::string& m_String;
+};
+
+
+/*
+ * Append an unsigned LEB128 varint to the buffer provided
+ *
+ * Seven bits per byte, least significant group first, high bit set on all but the last byte.
+ *
+ *
+ * void PutVarint(std::string& p_Buffer, uint64_t p_Value)
+ *
+ * @param   [IN/OUT]    p_Buffer                The buffer to which the value should be appended
+ * @param   [IN]        p_Value                 The value to be appended
+ */
+void Timeline::PutVarint(std::string& p_Buffer, uint64_t p_Value) {
+    while (p_Value >= 0x80) {
+        p_Buffer.push_back(static_cast<char>((p_Value & 0x7F) | 0x80));
+        p_Value >>= 7;
+    }
+    p_Buffer.push_back(static_cast<char>(p_Value));
+}
+
+
+/*
+ * Append a string (length varint followed by the characters) to the buffer provided
+ *
+ *
+ * void PutString(std::string& p_Buffer, const std::string& p_Value)
+ *
+ * @param   [IN/OUT]    p_Buffer                The buffer to which the string should be appended
+ * @param   [IN]        p_Value                 The string to be appended
+ */
+void Timeline::PutString(std::string& p_Buffer, const std::string& p_Value) {
+    PutVarint(p_Buffer, p_Value.size());
+    p_Buffer += p_Value;
+}
+
+
+/*
+ * Open the compact detailed output file and write the file header
+ *
+ * The file header records the column specifications, so the reader doesn't need to know
+ * the logfile record specification used for the run.
+ *
+ *
+ * bool Open(const std::string p_Filename, const std::vector<TimelineColumnT>& p_Columns)
+ *
+ * @param   [IN]    p_Filename                  The name of the file to be created (with path)
+ * @param   [IN]    p_Columns                   The column specifications
+ * @return                                      Boolean status (true = success, false = failure)
+ */
+bool Timeline::Open(const std::string p_Filename, const std::vector<TimelineColumnT>& p_Columns) {
+
+    if (IsOpen()) return false;                                                                             // already open
+
+    m_Columns = p_Columns;
+    m_Kinds.clear();
+    for (auto& column: m_Columns) {
+        switch (column.dataType) {
+            case TYPENAME::FLOAT:
+            case TYPENAME::DOUBLE:
+            case TYPENAME::LONGDOUBLE   : m_Kinds.push_back(COLUMN_KIND::FLOAT); break;
+            case TYPENAME::STRING:
+            case TYPENAME::STRING_VECTOR: m_Kinds.push_back(COLUMN_KIND::STRING); break;
+            default                     : m_Kinds.push_back(COLUMN_KIND::INTEGER); break;                   // integers, booleans and enumerations
+        }
+    }
+
+    m_Numeric.assign(m_Columns.size(), {});
+    m_Strings.assign(m_Columns.size(), {});
+    m_Rows = 0;
+
+    m_File.open(p_Filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_File.is_open()) return false;
+
+    std::string header = DETAILED_OUTPUT_COMPACT_MAGIC;
+    PutVarint(header, DETAILED_OUTPUT_COMPACT_VERSION);
+    PutVarint(header, m_Columns.size());
+    for (std::size_t col = 0; col < m_Columns.size(); col++) {
+        header.push_back(static_cast<char>(m_Kinds[col]));
+        PutVarint(header, static_cast<uint64_t>(m_Columns[col].dataType));
+        PutString(header, m_Columns[col].header);
+        PutString(header, m_Columns[col].units);
+    }
+
+    m_File.write(header.data(), header.size());
+    return !m_File.fail();
+}
+
+
+/*
+ * Append a row (detailed output record) for the binary being recorded
+ *
+ * If the id of the binary differs from the id of the rows already recorded, the rows already
+ * recorded are flushed first (normally the caller flushes at the end of each binary).
+ *
+ *
+ * bool Append(const long int p_Id, const std::vector<COMPAS_VARIABLE_TYPE>& p_Values)
+ *
+ * @param   [IN]    p_Id                        The id of the binary
+ * @param   [IN]    p_Values                    The record values - one per column
+ * @return                                      Boolean status (true = success, false = failure)
+ */
+bool Timeline::Append(const long int p_Id, const std::vector<COMPAS_VARIABLE_TYPE>& p_Values) {
+
+    if (!IsOpen() || p_Values.size() != m_Columns.size()) return false;                                    // no file, or record doesn't match the columns
+
+    if (m_Rows > 0 && p_Id != m_Id && !Flush()) return false;                                               // new binary - flush the previous binary
+    m_Id = p_Id;
+
+    int64_t     integerValue;
+    double      floatValue;
+    std::string stringValue;
+
+    for (std::size_t col = 0; col < p_Values.size(); col++) {
+        integerValue = 0;
+        floatValue   = 0.0;
+        stringValue.clear();
+        boost::apply_visitor(TimelineVariantValue(integerValue, floatValue, stringValue), p_Values[col]);
+
+        switch (m_Kinds[col]) {
+            case COLUMN_KIND::INTEGER: m_Numeric[col].push_back(static_cast<uint64_t>(integerValue)); break;
+            case COLUMN_KIND::FLOAT  : {
+                uint64_t bits;
+                std::memcpy(&bits, &floatValue, sizeof(bits));
+                m_Numeric[col].push_back(bits);
+                } break;
+            case COLUMN_KIND::STRING : m_Strings[col].push_back(stringValue); break;
+        }
+    }
+    m_Rows++;
+
+    return true;
+}
+
+
+/*
+ * Encode a numeric column as (value, run length) pairs
+ *
+ * Integer columns are encoded as zigzagged differences from the previous row, floating point
+ * columns as the bit pattern XORed with the bit pattern of the previous row (the first row is
+ * differenced/XORed against 0).
+ *
+ *
+ * void EncodeNumericColumn(std::string& p_Buffer, const std::vector<uint64_t>& p_Values, const COLUMN_KIND p_Kind)
+ *
+ * @param   [IN/OUT]    p_Buffer                The buffer to which the encoded column should be appended
+ * @param   [IN]        p_Values                The column values
+ * @param   [IN]        p_Kind                  The column kind (INTEGER or FLOAT)
+ */
+void Timeline::EncodeNumericColumn(std::string& p_Buffer, const std::vector<uint64_t>& p_Values, const COLUMN_KIND p_Kind) const {
+
+    std::string runs;
+    uint64_t    nRuns    = 0;
+    uint64_t    previous = 0;
+    uint64_t    runValue = 0;
+    uint64_t    runLength = 0;
+
+    for (auto& value: p_Values) {
+        uint64_t encoded = p_Kind == COLUMN_KIND::INTEGER ? Zigzag(static_cast<int64_t>(value - previous)) : (value ^ previous);
+        previous = value;
+
+        if (runLength > 0 && encoded == runValue) {                                                         // extends current run?
+            runLength++;                                                                                    // yes
+        }
+        else {                                                                                              // no - new run
+            if (runLength > 0) {                                                                            // write current run
+                PutVarint(runs, runValue);
+                PutVarint(runs, runLength);
+                nRuns++;
+            }
+            runValue  = encoded;
+            runLength = 1;
+        }
+    }
+    if (runLength > 0) {                                                                                    // write last run
+        PutVarint(runs, runValue);
+        PutVarint(runs, runLength);
+        nRuns++;
+    }
+
+    PutVarint(p_Buffer, nRuns);
+    p_Buffer += runs;
+}
+
+
+/*
+ * Encode a string column as (string, run length) pairs
+ *
+ *
+ * void EncodeStringColumn(std::string& p_Buffer, const std::vector<std::string>& p_Values)
+ *
+ * @param   [IN/OUT]    p_Buffer                The buffer to which the encoded column should be appended
+ * @param   [IN]        p_Values                The column values
+ */
+void Timeline::EncodeStringColumn(std::string& p_Buffer, const std::vector<std::string>& p_Values) const {
+
+    std::string runs;
+    uint64_t    nRuns = 0;
+
+    std::size_t idx = 0;
+    while (idx < p_Values.size()) {
+        std::size_t end = idx + 1;
+        while (end < p_Values.size() && p_Values[end] == p_Values[idx]) end++;
+
+        PutString(runs, p_Values[idx]);
+        PutVarint(runs, end - idx);
+        nRuns++;
+
+        idx = end;
+    }
+
+    PutVarint(p_Buffer, nRuns);
+    p_Buffer += runs;
+}
+
+
+/*
+ * Encode the rows recorded for the current binary and write them to the file as a single block
+ *
+ * The recorded rows are cleared (whether or not the write succeeds).  Nothing is written if no
+ * rows have been recorded.
+ *
+ *
+ * bool Flush()
+ *
+ * @return                                      Boolean status (true = success, false = failure)
+ */
+bool Timeline::Flush() {
+
+    if (!IsOpen()) return false;
+    if (m_Rows == 0) return true;                                                                           // nothing to do
+
+    std::string payload;
+    for (std::size_t col = 0; col < m_Columns.size(); col++) {
+        if (m_Kinds[col] == COLUMN_KIND::STRING) EncodeStringColumn(payload, m_Strings[col]);
+        else                                     EncodeNumericColumn(payload, m_Numeric[col], m_Kinds[col]);
+
+        m_Numeric[col].clear();
+        m_Strings[col].clear();
+    }
+
+    std::string block;
+    PutVarint(block, Zigzag(static_cast<int64_t>(m_Id)));
+    PutVarint(block, m_Rows);
+    PutVarint(block, payload.size());
+
+    m_Rows = 0;
+
+    m_File.write(block.data(), block.size());
+    m_File.write(payload.data(), payload.size());
+    return !m_File.fail();
+}
+
+
+/*
+ * Flush any rows recorded and close the file
+ *
+ *
+ * bool Close()
+ *
+ * @return                                      Boolean status (true = success, false = failure)
+ */
+bool Timeline::Close() {
+
+    if (!IsOpen()) return true;                                                                             // nothing to do
+
+    bool ok = Flush();
+    m_File.close();
+
+    return ok && !m_File.fail();
+}
@@ -0,0 +1,91 @@
+#ifndef __Timeline_h__
+#define __Timeline_h__
+
+#include <cstdint>
+#include <fstream>
+
+#include "constants.h"
+#include "typedefs.h"
+
+
+/*
+ * Evolution timeline recorder: compact encoding of BSE detailed output
+ *
+ * The BSE detailed output file has a record written several times per timestep (after the
+ * stellar timestep, after the binary timestep, when the timestep completes, and at various
+ * events), and each record contains the full set of configured properties - most of which
+ * are unchanged from the previous record.  Writing one (text or HDF5) file per binary, one
+ * record at a time, makes detailed output too large (and too slow) to enable for more than
+ * a few thousand binaries.
+ *
+ * With --detailed-output-compact the detailed output records for a binary are instead
+ * accumulated in memory, column by column, and written when the evolution of the binary is
+ * complete as a single block in a single (binary) file for the whole run.  Each column is
+ * written as a sequence of (value, run length) pairs, where the value is:
+ *
+ *    - integer columns (including booleans and enumerations): the difference from the previous
+ *      row (so constant columns, and columns that increase by a constant amount, are a single run)
+ *    - floating point columns: the bit pattern XORed with the bit pattern of the previous row
+ *      (so unchanged values are 0, and are absorbed into runs)
+ *    - string columns: the string
+ *
+ * All integers are written as LEB128 varints (signed values zigzag encoded).  The file layout is:
+ *
+ *    magic ("COMPASTL"), format version, number of columns
+ *    for each column: kind ('i', 'f' or 's'), COMPAS datatype, header, units
+ *    for each binary: id (signed), number of rows, block length (bytes), then for each column the
+ *                     number of runs followed by the (value, run length) pairs
+ *
+ * Floating point values are stored as doubles (long doubles are narrowed).  The reader in
+ * compas_python_utils (compact_detailed_output.py) reconstructs the full records.
+ */
+
+
+// column specification - the column datatype, header and units
+typedef struct TimelineColumn {
+    TYPENAME    dataType;
+    std::string header;
+    std::string units;
+} TimelineColumnT;
+
+
+class Timeline {
+
+public:
+
+    Timeline() : m_Id(0), m_Rows(0) { }
+    ~Timeline() { Close(); }
+
+    bool IsOpen() const                                                                                     { return m_File.is_open(); }
+    std::size_t Rows() const                                                                                { return m_Rows; }
+
+    bool Open(const std::string p_Filename, const std::vector<TimelineColumnT>& p_Columns);
+    bool Append(const long int p_Id, const std::vector<COMPAS_VARIABLE_TYPE>& p_Values);
+    bool Flush();
+    bool Close();
+
+private:
+
+    enum class COLUMN_KIND: char { INTEGER = 'i', FLOAT = 'f', STRING = 's' };
+
+    std::ofstream                         m_File;                                                           // compact detailed output file
+
+    std::vector<TimelineColumnT>          m_Columns;                                                        // column specifications
+    std::vector<COLUMN_KIND>              m_Kinds;                                                          // encoding for each column
+
+    long int                              m_Id;                                                             // id of binary being recorded
+    std::size_t                           m_Rows;                                                           // number of rows recorded for the binary
+
+    std::vector<std::vector<uint64_t>>    m_Numeric;                                                        // per column: integer values (two's complement) or double bit patterns
+    std::vector<std::vector<std::string>> m_Strings;                                                        // per column: string values
+
+    static void PutVarint(std::string& p_Buffer, uint64_t p_Value);
+    static void PutString(std::string& p_Buffer, const std::string& p_Value);
+    static uint64_t Zigzag(const int64_t p_Value)                                                           { return (static_cast<uint64_t>(p_Value) << 1) ^ static_cast<uint64_t>(p_Value >> 63); }
+
+    void EncodeNumericColumn(std::string& p_Buffer, const std::vector<uint64_t>& p_Values, const COLUMN_KIND p_Kind) const;
+    void EncodeStringColumn(std::string& p_Buffer, const std::vector<std::string>& p_Values) const;
+};
+
+
+#endif // __Timeline_h__
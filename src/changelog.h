@@ -1003,7 +1003,110 @@
 // 02.37.01     JR - Mar 20, 2023     - Documentation:
 //                                      - Updated documentation for YAML files.
 //                                      - Modified YAML template to include notice regarding commented lines in default YAML file.
+// 02.37.02     SF - Oct 18, 2026    - Enhancement:
+//                                      - SAY/DBG/LOG macros now check (via Log::LogEnabled()/Log::DbgEnabled()) whether the statement is enabled before the message string is constructed
+//                                      - enabled log/debug classes are now registered at Log::Start() and held as bitmasks; Log::DoIt() checks level first, and only
+//                                        checks the class (a single AND) if classes are restricted - DoIt() no longer copies the enabled class vector on every call
+// 02.37.03     SF - Oct 18, 2026    - Enhancement:
+//                                      - utils::SolveKeplersEquation() now starts Newton-Raphson from the Markley (1995) starter (new function utils::KeplersEquationStarter()),
+//                                        which is accurate to ~1e-15 for 0 <= e < 1, so the iteration usually terminates immediately (previously started from E = M, slow for high e)
+//                                      - added batch version of utils::SolveKeplersEquation() taking vectors of mean anomalies and eccentricities (vectorisable first pass,
+//                                        scalar fallback for any element that does not converge)
+// 02.37.04     SF - Oct 18, 2026    - Enhancement:
+//                                      - added Summary service (Summary.h, Summary.cpp): pluggable streaming reduction of binary evolution results, called at the end of BaseBinaryStar::Evolve()
+//                                        reducers accumulate weighted counts and histograms in memory; summaries written to Population_Summary.txt in the output container at the end of the run
+//                                      - new program option --population-summary (vector): built-in reducers to enable (CHIRP_MASS, DELAY_TIME, EVOLUTION_STATUS, FORMATION_CHANNEL, STELLAR_TYPES)
+//                                      - new program option --population-summary-only: skip the per-system BSE logfiles (system parameters, DCOs, CEEs, SNe) when only summaries are needed
+// 02.37.05     SF - Oct 18, 2026    - Enhancement:
+//                                      - added COMPAS_CosmicIntegration (CosmicIntegration.h, CosmicIntegration.cpp): compiled, multithreaded port of the cosmic integration in
+//                                        compas_python_utils/cosmic_integration/FastCosmicIntegration.py - reads the BSE DCO, system parameters and CE datasets from the COMPAS HDF5 output
+//                                        in chunks and accumulates formation, merger and detection rates per redshift with a cache-blocked kernel (per-DCO rate arrays are not materialised)
+//                                      - new Makefile target cosmic-integration (also built by 'all'); does not need gsl
+// 02.37.06     SF - Oct 18, 2026    - Enhancement:
+//                                      - new program option --detailed-output-compact: BSE detailed output records are accumulated per binary (Timeline.h, Timeline.cpp) and written, when the binary has
+//                                        finished evolving, as a block of run-length encoded columns (integer deltas, XORed double bit patterns, strings) to a single file Detailed_Output/BSE_Detailed_Output.cdo
+//                                      - added compas_python_utils/compact_detailed_output.py: reader for compact detailed output - reconstructs the records and expands them to per-binary CSV files
+// 02.37.07     SF - Oct 18, 2026    - Enhancement:
+//                                      - Star phase objects (MS, HG, ... BH, MR) are now constructed in place in storage held by the Star object
+//                                        (three slots: current, saved, and the target of the next switch) rather than allocated on the heap,
+//                                        so Star::SwitchTo(), Star::SaveState() and Star::RevertState() no longer call new/delete
+//                                      - Star::Clone() is now private (it constructs into a Star slot)
+// 02.37.08     SF - Oct 18, 2026    - Enhancement:
+//                                      - BSE Switch Log no longer uses SIGUSR1: added StarObserver (Star.h), an interface for notification of stellar events
+//                                        (stellar type switch, supernova, envelope loss) of a Star.  BaseBinaryStar observes its constituent stars and writes
+//                                        the BSE Switch Log record directly (BaseBinaryStar::StellarTypeSwitched())
+//                                      - removed the SIGUSR1 signal handler and the global evolving binary pointer from main.cpp, and BinaryStar::PrintSwitchLog()
+// 02.37.09     SF - Oct 18, 2026    - Enhancement:
+//                                      - Nanjing lambda calculations (HG, CHeB, EAGB, TPAGB - enhanced and STARTRACK variants) no longer heap-allocate:
+//                                        the per-call coefficient sets (a, b, maxBG, lambdaBG) are fixed-size arrays (NANJING_COEFFS, NANJING_BG - typedefs.h),
+//                                        and the polynomials are evaluated by a single shared function, BaseStar::EvaluateLambdaNanjingPolynomials()
+//                                      - utils::binarySearch() now takes the array by reference and returns std::array<int, 2> (was a copy in, and std::vector<int> out)
+// 02.37.10     SF - Oct 18, 2026    - Enhancement:
+//                                      - Added BaseStar::CalculateGBParamsAndTimescales(): memoises m_GBParams and m_Timescales, keyed on (stellar type, Mass0, metallicity)
+//                                        GB parameters and timescales are now only recalculated when their inputs change (previously recalculated every timestep)
+//                                      - Added InvalidateGBParamsAndTimescales(), called where m_GBParams/m_Timescales are written directly (EAGB/CHeB::ResolveEnvelopeLoss())
+//                                      - Added memo hit/miss reporting to the profiling code (profiling.h)
+// 02.37.11     SF - Oct 18, 2026    - Defect repairs, enhancement:
+//                                      - Added program option '--fork-variations' (BSE only, not with grid files): each binary is evolved under every commandline variation (range/set) in turn,
+//                                        sharing its initial conditions.  The first variation leaves a snapshot of the binary (and of the random number generator) taken at the start of the
+//                                        timestep of its first CE or SN event; the remaining variations resume from the snapshot (BaseBinaryStar::EvolveFromForkPoint()) rather than from ZAMS.
+//                                        Only options consulted from that point on may be varied (Options.h: m_ForkVariationsAllowed)
+//                                      - Added Rand::SaveState() and Rand::RestoreState()
+//                                      - Options::AdvanceOptionVariation() now resets the options to the first variation when all variations are done (previously left part-advanced)
+//                                      - BaseBinaryStar copies now set the companions of the copied constituent stars; BaseBinaryStar::operator=() no longer leaks the constituent stars
+//                                      - Star::Clone() now copies the underlying star with the copy constructor of its class, so attributes declared in the derived classes (e.g. white
+//                                        dwarf and neutron star attributes) are no longer lost when a star is copied
+// 02.37.12     SF - Oct 18, 2026    - Enhancement:
+//                                      - Added Log::UpdateLoggedProperties() and Log::PropertyLogged(): at startup, after the logfile record specifications are final, records the set of properties
+//                                        written to the BSE logfiles that are active in this run (logging enabled, logfile enabled by its program options, at least one record type enabled)
+//                                      - BaseBinaryStar::CalculateEnergyAndAngularMomentum() is skipped when neither TOTAL_ENERGY nor TOTAL_ANGULAR_MOMENTUM is written to an active logfile
+//                                        (by default they appear only in BSE detailed output)
+// 02.37.13     SF - Oct 18, 2026    - Enhancement:
+//                                      - Added program options '--evolution-target' (ALL, DCO) and '--evolution-target-minimum-mass' (BSE): binaries that can no longer reach the target
+//                                        are stopped at the end of the timestep in which that becomes known, with new evolution status EVOLUTION_STATUS::TARGET_UNREACHABLE
+//                                        (BaseBinaryStar::EvolutionTargetUnreachable())
+//                                          - DCO: stop once the stars that are not yet NS or BH have less than MECS Msol each between them (every route to a NS or BH requires the mass of
+//                                            the star to exceed MECS, and the total mass of those stars can only decrease)
+//                                          - minimum mass: stop once each star is a WD or less massive than the specified mass
+// 02.37.14     SF - Oct 18, 2026    - Enhancement:
+//                                      - Added in-process adaptive importance sampling of binary initial conditions (BSE): new program options '--importance-sampling',
+//                                        '--importance-sampling-batch-size' and '--importance-sampling-exploration-fraction' (new ImportanceSampler service - ImportanceSampler.h/.cpp)
+//                                          - primary mass, mass ratio and semi-major axis are drawn from a mixture of gaussians centred on the binaries that reached the evolution target
+//                                            ('hits' - see '--evolution-target'), refitted at the end of each batch, or from the birth distributions
+//                                          - new binary property BINARY_PROPERTY::IMPORTANCE_WEIGHT, added to the BSE_System_Parameters file when importance sampling; the population summary
+//                                            accumulates the importance weights
+// 02.37.15     SF - Oct 18, 2026    - Enhancement, defect repairs:
+//                                      - Reduced the fixed startup cost of each COMPAS run:
+//                                          - Options::OptionAttributes() takes the boost variables map by reference (it was copied for every option when constructing the Run_Details contents)
+//                                            and determines option data types without throwing exceptions
+//                                          - the option descriptions (help) are only constructed if help is requested (Options::AddOptions(), Options::PrintOptionHelp())
+//                                          - the option defaults map is built from the boost parameter strings rather than the formatted option descriptions, and it and the Run_Details
+//                                            contents are constructed on demand (Options::CmdLineOptionsDetails())
+//                                          - the HDF5 container is created when the first HDF5 logfile is opened, and the HDF5 run details group when the run details are written (Log::Stop())
+//                                      - Added program option '--startup-timing' to report the time spent in each phase of program startup
+//                                      - Fixed leaked HDF5 identifiers (property list, attribute dataspace and datatype) in Log::CreateHDF5Dataset()
+// 02.37.16     SF - Oct 18, 2026    - Enhancement:
+//                                      - Pooled allocation of the objects constructed for every star/binary (ObjectPool.h): Star, BinaryStar, BaseBinaryStar and BinaryConstituentStar
+//                                        objects are allocated from per-class slab pools with free lists, so the blocks released by one binary are reused by the next
+// 02.37.17     SF - Oct 18, 2026    - Enhancement:
+//                                      - Text logfiles (CSV, TSV, TXT) are written through a 256KiB buffer per file and no longer flushed after every record
+//                                      - added option --logfile-flush {RECORD, OBJECT, CLOSE} (default OBJECT) to specify when text logfiles are flushed
+//                                      - standard log records are formatted by appending each value to a reserved record string instead of building temporaries
+//                                      - utils::vFormat() formats into a stack buffer, re-formatting only if the result does not fit
+// 02.37.18     SF - Oct 18, 2026    - Defect repair:
+//                                      - Giant branch parameters/timescales memo (02.37.10, CalculateGBParamsAndTimescales()) now also keys on the core mass for low-mass CHeB stars (and EAGB/TPAGB),
+//                                        whose helium burning lifetime depends on the core mass - stale timescales changed detailed output (timesteps) for some stars
+// 02.37.19     SF - Oct 18, 2026    - Enhancement:
+//                                      - HDF5 logfile datasets can be compressed: added options --hdf5-compression {NONE, DEFLATE} (default NONE), --hdf5-compression-level (1..9, default 1) and --hdf5-shuffle
+//                                      - Log::WriteHDF5_() now takes the current dataset size from the dataset extent rather than its storage size (which is smaller for compressed datasets)
+// 02.37.20     SF - Oct 18, 2026    - Enhancement:
+//                                      - Added COMPAS_H5Merge (src/H5Merge.cpp, make target h5merge), a compiled replacement for compas_python_utils/h5copy.py with the same options
+//                                      - Datasets whose layouts match are copied chunk by chunk as stored (no decompression/recompression), with the chunks read from the input files by --threads threads
+//                                      - New option --vds creates an index file of HDF5 virtual datasets that refer to the input files instead of copying them
+// 02.37.21     SF - Oct 18, 2026    - Enhancement:
+//                                      - utils::Compare(), utils::intPow(), utils::IsOneOf() and BaseStar::IsOneOf() now defined inline in utils.h/BaseStar.h so they can be inlined in every translation unit
+//                                      - Added makefile entry points 'lto' (-march=native -O3 -flto=auto) and 'pgo' (lto build trained on a fixed-seed SSE and BSE workload, g++ only)
 
-const std::string VERSION_STRING = "02.37.01";
+const std::string VERSION_STRING = "02.37.21";
 
 # endif // __changelog_h__
@@ -312,11 +312,24 @@ enum class LOGFILETYPE: int { NONE, HDF5, CSV, TSV, TXT };
 const LOGFILETYPE DEFAULT_LOGFILE_TYPE                  = LOGFILETYPE::HDF5;                                        // Default logfile type
 const std::string DEFAULT_OUTPUT_CONTAINER_NAME         = "COMPAS_Output";                                          // Default name for output container (directory)
 const std::string DETAILED_OUTPUT_DIRECTORY_NAME        = "Detailed_Output";                                        // Name for detailed output directory within output container
+constexpr size_t  TEXT_LOGFILE_BUFFER_SIZE              = 256 * 1024;                                               // IO buffer size for CSV, TSV and TXT logfiles (bytes)
+const std::string DETAILED_OUTPUT_COMPACT_FILE_EXT      = "cdo";                                                    // File extension for compact detailed output files (--detailed-output-compact)
+const std::string DETAILED_OUTPUT_COMPACT_MAGIC         = "COMPASTL";                                               // Identifier written at the start of compact detailed output files
+constexpr int     DETAILED_OUTPUT_COMPACT_VERSION       = 1;                                                        // Compact detailed output file format version
 const std::string RUN_DETAILS_FILE_NAME                 = "Run_Details";                                            // Name for run details output file within output container
+const std::string POPULATION_SUMMARY_FILE_NAME          = "Population_Summary";                                     // Name for population summary output file within output container
 
 constexpr int    HDF5_DEFAULT_CHUNK_SIZE                = 100000;                                                   // default HDF5 chunk size (number of dataset entries)
 constexpr int    HDF5_DEFAULT_IO_BUFFER_SIZE            = 1;                                                        // number of HDF5 chunks to buffer for IO (per open dataset)
 constexpr int    HDF5_MINIMUM_CHUNK_SIZE                = 1000;                                                     // minimum HDF5 chunk size (number of dataset entries)
+constexpr int    HDF5_DEFAULT_COMPRESSION_LEVEL         = 1;                                                        // default HDF5 deflate compression level (1 = fastest .. 9 = smallest)
+
+constexpr double POPULATION_SUMMARY_CHIRP_MASS_MIN      = 0.0;                                                      // Lower edge of population summary chirp mass histogram (Msol)
+constexpr double POPULATION_SUMMARY_CHIRP_MASS_MAX      = 100.0;                                                    // Upper edge of population summary chirp mass histogram (Msol)
+constexpr int    POPULATION_SUMMARY_CHIRP_MASS_BINS     = 100;                                                      // Number of bins in population summary chirp mass histogram
+constexpr double POPULATION_SUMMARY_LOG_DELAY_TIME_MIN  = 0.0;                                                      // Lower edge of population summary delay time histogram (log10(Myr))
+constexpr double POPULATION_SUMMARY_LOG_DELAY_TIME_MAX  = 5.0;                                                      // Upper edge of population summary delay time histogram (log10(Myr))
+constexpr int    POPULATION_SUMMARY_LOG_DELAY_TIME_BINS = 50;                                                       // Number of bins in population summary delay time histogram
 
 // Logfile record types
 // Note all enum classes for log record types start at 1 (and *must* start at 1)
@@ -775,6 +788,7 @@ enum class EVOLUTION_STATUS: int {
     STELLAR_MERGER_AT_BIRTH,
     UNBOUND,
     WD_WD,
+    TARGET_UNREACHABLE,
     TIMES_UP,
     STEPS_UP,
     STOPPED
@@ -793,6 +807,7 @@ const COMPASUnorderedMap<EVOLUTION_STATUS, std::string> EVOLUTION_STATUS_LABEL =
     { EVOLUTION_STATUS::STELLAR_MERGER_AT_BIRTH, "Stars merged at birth" },
     { EVOLUTION_STATUS::UNBOUND,                 "Unbound binary" },
     { EVOLUTION_STATUS::WD_WD,                   "Double White Dwarf" },
+    { EVOLUTION_STATUS::TARGET_UNREACHABLE,      "Evolution target unreachable" },
     { EVOLUTION_STATUS::TIMES_UP,                "Allowed time exceeded" },
     { EVOLUTION_STATUS::STEPS_UP,                "Allowed timesteps exceeded" },
     { EVOLUTION_STATUS::STOPPED,                 "Evolution stopped" }
@@ -807,6 +822,14 @@ const COMPASUnorderedMap<EVOLUTION_MODE, std::string> EVOLUTION_MODE_LABEL = {
 };
 
 
+// Evolution target (BSE) - binaries that can no longer reach the target stop evolving (EVOLUTION_STATUS::TARGET_UNREACHABLE)
+enum class EVOLUTION_TARGET: int { ALL, DCO };
+const COMPASUnorderedMap<EVOLUTION_TARGET, std::string> EVOLUTION_TARGET_LABEL = {
+    { EVOLUTION_TARGET::ALL, "ALL" },                       // no target - evolve all binaries to the end of their evolution
+    { EVOLUTION_TARGET::DCO, "DCO" }                        // double compact object (NS or BH + NS or BH)
+};
+
+
 // user specified distributions, assumptions etc.
 
 // Black Hole Kick Options
@@ -916,6 +939,23 @@ const COMPASUnorderedMap<LOGFILETYPE, std::string> LOGFILETYPEFileExt = {   // f
 };
 
 
+// Logfile flush policies (CSV, TSV and TXT logfiles)
+enum class LOGFILE_FLUSH: int { RECORD, OBJECT, CLOSE };
+const COMPASUnorderedMap<LOGFILE_FLUSH, std::string> LOGFILE_FLUSH_LABEL = {
+    { LOGFILE_FLUSH::RECORD, "RECORD" },                    // flush after every record
+    { LOGFILE_FLUSH::OBJECT, "OBJECT" },                    // flush when the evolution of each star/binary is complete
+    { LOGFILE_FLUSH::CLOSE,  "CLOSE" }                      // flush only when the IO buffer is full, and when the logfile is closed
+};
+
+
+// HDF5 dataset compression
+enum class HDF5_COMPRESSION: int { NONE, DEFLATE };
+const COMPASUnorderedMap<HDF5_COMPRESSION, std::string> HDF5_COMPRESSION_LABEL = {
+    { HDF5_COMPRESSION::NONE,    "NONE" },                  // no compression
+    { HDF5_COMPRESSION::DEFLATE, "DEFLATE" }                // deflate (gzip) - built in to every HDF5 library, so readable everywhere
+};
+
+
 // Logfile delimiters
 enum class DELIMITER: int { TAB, SPACE, COMMA };
 const COMPASUnorderedMap<DELIMITER, std::string> DELIMITERLabel = {         // labels
@@ -1137,6 +1177,17 @@ const COMPASUnorderedMap<ORBITAL_PERIOD_DISTRIBUTION, std::string> ORBITAL_PERIO
 };
 
 
+// Population summary reducers
+enum class POPULATION_SUMMARY: int { CHIRP_MASS, DELAY_TIME, EVOLUTION_STATUS, FORMATION_CHANNEL, STELLAR_TYPES };
+const COMPASUnorderedMap<POPULATION_SUMMARY, std::string> POPULATION_SUMMARY_LABEL = {
+    { POPULATION_SUMMARY::CHIRP_MASS,        "CHIRP_MASS" },            // histogram of chirp masses of DCOs merging in a Hubble time
+    { POPULATION_SUMMARY::DELAY_TIME,        "DELAY_TIME" },            // histogram of log10 delay times of DCOs merging in a Hubble time
+    { POPULATION_SUMMARY::EVOLUTION_STATUS,  "EVOLUTION_STATUS" },      // counts by final evolution status
+    { POPULATION_SUMMARY::FORMATION_CHANNEL, "FORMATION_CHANNEL" },     // DCO counts by DCO type, mass transfer history and merger flag
+    { POPULATION_SUMMARY::STELLAR_TYPES,     "STELLAR_TYPES" }          // counts by final stellar types of the constituent stars
+};
+
+
 // Pulsational Pair Instability Prescriptions
 enum class PPI_PRESCRIPTION: int { COMPAS, STARTRACK, MARCHANT, FARMER };
 const COMPASUnorderedMap<PPI_PRESCRIPTION, std::string> PPI_PRESCRIPTION_LABEL = {
@@ -2029,6 +2080,7 @@ enum class BINARY_PROPERTY: int {
     ERROR,
     ID,
     IMMEDIATE_RLOF_POST_COMMON_ENVELOPE,
+    IMPORTANCE_WEIGHT,
     MASS_1_POST_COMMON_ENVELOPE,
     MASS_1_PRE_COMMON_ENVELOPE,
     MASS_2_POST_COMMON_ENVELOPE,
@@ -2159,6 +2211,7 @@ const COMPASUnorderedMap<BINARY_PROPERTY, std::string> BINARY_PROPERTY_LABEL = {
     { BINARY_PROPERTY::ERROR,                                              "ERROR" },
     { BINARY_PROPERTY::ID,                                                 "ID" },
     { BINARY_PROPERTY::IMMEDIATE_RLOF_POST_COMMON_ENVELOPE,                "IMMEDIATE_RLOF_POST_COMMON_ENVELOPE" },
+    { BINARY_PROPERTY::IMPORTANCE_WEIGHT,                                  "IMPORTANCE_WEIGHT" },
     { BINARY_PROPERTY::MASS_1_POST_COMMON_ENVELOPE,                        "MASS_1_POST_COMMON_ENVELOPE" },
     { BINARY_PROPERTY::MASS_1_PRE_COMMON_ENVELOPE,                         "MASS_1_PRE_COMMON_ENVELOPE" },
     { BINARY_PROPERTY::MASS_2_POST_COMMON_ENVELOPE,                        "MASS_2_POST_COMMON_ENVELOPE" },
@@ -2877,6 +2930,7 @@ const std::map<BINARY_PROPERTY, PROPERTY_DETAILS> BINARY_PROPERTY_DETAIL = {
     { BINARY_PROPERTY::ERROR,                                               { TYPENAME::ERROR,          "Error",                "-",                 4, 1 }},
     { BINARY_PROPERTY::ID,                                                  { TYPENAME::OBJECT_ID,      "ID",                   "-",                12, 1 }},
     { BINARY_PROPERTY::IMMEDIATE_RLOF_POST_COMMON_ENVELOPE,                 { TYPENAME::BOOL,           "Immediate_RLOF>CE",    "Event",             0, 0 }},
+    { BINARY_PROPERTY::IMPORTANCE_WEIGHT,                                   { TYPENAME::DOUBLE,         "Importance_Weight",    "-",                14, 6 }},
     { BINARY_PROPERTY::MASS_1_POST_COMMON_ENVELOPE,                         { TYPENAME::DOUBLE,         "Mass(1)>CE",           "Msol",             14, 6 }},
     { BINARY_PROPERTY::MASS_1_PRE_COMMON_ENVELOPE,                          { TYPENAME::DOUBLE,         "Mass(1)<CE",           "Msol",             14, 6 }},
     { BINARY_PROPERTY::MASS_2_POST_COMMON_ENVELOPE,                         { TYPENAME::DOUBLE,         "Mass(2)>CE",           "Msol",             14, 6 }},
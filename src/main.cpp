@@ -8,7 +8,6 @@
 #include <fstream>
 #include <tuple>
 #include <vector>
-#include <csignal>
 #include <iostream>
 #include <iomanip>
 
@@ -22,6 +21,8 @@
 #include "Options.h"
 #include "Rand.h"
 #include "Log.h"
+#include "Summary.h"
+#include "ImportanceSampler.h"
 
 #include "Star.h"
 #include "BinaryStar.h"
@@ -38,64 +39,6 @@ OBJECT_TYPE  ObjectType()  { return OBJECT_TYPE::MAIN; }
 STELLAR_TYPE StellarType() { return STELLAR_TYPE::NONE; }
 
 
-// The following global variables support the BSE Switch Log file
-// Ideally, rather than be declared as globals, they would be in maybe the 
-// LOGGING service singleton, but the Log class knows nothing about the 
-// BinaryStar class...
-// (maybe we could put them in the new CONSTANTS service singleton if we 
-// implement it)
-
-BinaryStar* evolvingBinaryStar      = NULL;             // pointer to the currently evolving Binary Star
-bool        evolvingBinaryStarValid = false;            // flag to indicate whether the evolvingBinaryStar pointer is valid
-
-/*
- * Signal handler
- * 
- * Only handles SIGUSR1; all other signals are left to the system to handle.
- * 
- * SIGUSR1 is a user generated signal - the system should not generate this signal,
- * though it is possible to send the signal to a process via the Un*x kill command,
- * or some other user-developed program that sends signals.  This code does some 
- * rudimentary sanity checks, but it is possible that sending a SIGUSR1 signal to a
- * running COMPAS process via the Un*x kill command, or otherwise, might cause a 
- * spurious entry in the BSE Switch Log file - c'est la vie.
- * 
- * We use SIGUSR1 in the Star class to signal when a Star object switches stellar 
- * type. We use a signal because the Star class knows nothing about binary stars, 
- * so can't call a binary star function to log binary star variables to the BSE 
- * Switch Log file. By raising a signal in the Star class and catching it here we 
- * can call the appropriate binary star class function to write the binary star 
- * variables to the log file.
- * 
- * The signal is raised in the Star::SwitchTo() function if OPTIONS->BSESwitchLog() 
- * is true, so the signal will be received here for every stellar type switch of 
- * every star.
- * 
- * We only process the signal here if the global variable evolvingBinaryStarValid 
- * is true. The global variable evolvingBinaryStarValid is only set true after a 
- * binary star has been constructed and is ready to evolve - so if the signal is 
- * raised, it will be ignored for SSE switches, and it will be ignored for switches 
- * inside the constructor of the binary star (and so its constituent stars).
- * 
- * This signal handler is installed in EvolveBinaryStars(), so it is installed only
- * if we're evolving binaries - signals will be ignored (by our code - the system
- * will still receive and handle them) if we're evolving single stars.
- *
- * 
- * void sigHandler(int p_Sig)
- * 
- * @param   [IN]        p_Sig                   The signal intercepted
- * 
- */
-void sigHandler(int p_Sig) {   
-    if (p_Sig == SIGUSR1) {                                         // SIGUSR1?  Just silently ignore anything else...
-        if (evolvingBinaryStarValid && OPTIONS->SwitchLog()) {      // yes - do we have a valid binary star, and are we logging switches?
-            (void)evolvingBinaryStar->PrintSwitchLog();             // yes - assume SIGUSR1 is a binary constituent star switching...
-        }
-    }
-}
-
-
 /*
  * Evolve single stars
  *
@@ -294,6 +237,10 @@ std::tuple<int, int> EvolveSingleStars() {
                         evolutionStatus = EVOLUTION_STATUS::STOPPED;                                                // this will cause problems later - stop evolution
                     }
 
+                    if (!LOGGING->FlushTextFiles(LOGFILE_FLUSH::OBJECT)) {                                          // flush logfiles if necessary (--logfile-flush OBJECT)
+                        SHOW_WARN(ERROR::FILE_WRITE_ERROR);                                                         // flush failed - show warning
+                    }
+
                     ERRORS->Clean();                                                                                // clean the dynamic error catalog
 
                     index++;                                                                                        // next...
@@ -380,8 +327,6 @@ std::tuple<int, int> EvolveSingleStars() {
  */
 std::tuple<int, int> EvolveBinaryStars() {
 
-    signal(SIGUSR1, sigHandler);                                                                                // install signal handler
-
     EVOLUTION_STATUS evolutionStatus = EVOLUTION_STATUS::CONTINUE;
 
     auto wallStart = std::chrono::system_clock::now();                                                          // start wall timer
@@ -394,6 +339,20 @@ std::tuple<int, int> EvolveBinaryStars() {
     bool        usingGrid = !OPTIONS->GridFilename().empty();                                                   // using grid file?
     size_t      index     = 0;                                                                                  // which binary
 
+    // With --fork-variations (BSE only, no grid file) each binary of the population is evolved under
+    // every commandline variation in turn (a "cycle" of variations).  The first variation of a cycle is
+    // evolved from ZAMS and leaves a snapshot of the binary (and of the random number generator) taken
+    // at the start of the timestep of its first common envelope or supernova event (the fork point - see
+    // BaseBinaryStar::Evolve()).  The remaining variations of the cycle resume from the snapshot rather
+    // than repeating the shared evolution.  All variations of a cycle share the random seed of the first
+    // variation, which is derived from the cycle number rather than the binary index, so the population
+    // evolved under each variation is the same population as `-n` binaries evolved without ranges or sets.
+
+    bool            forkVariations   = OPTIONS->ForkVariations();                                               // fork commandline variations?
+    BaseBinaryStar* forkPoint        = nullptr;                                                                 // fork point snapshot of the first variation of the current cycle
+    int             cmdLineVariation = 0;                                                                       // commandline variation number within the current cycle
+    size_t          forkCycle        = 0;                                                                       // current cycle (population member) when forking
+
     // The options specified by the user at the commandline are set to their initial values.
     // OPTIONS->AdvanceCmdLineOptionValues(), called at the end of the loop, advances the
     // options specified by the user at the commandline to their next variation (if necessary,
@@ -408,9 +367,6 @@ std::tuple<int, int> EvolveBinaryStars() {
         bool processingGridLine = false;                                                                        // processing a gridfile line?
         while (!doneGridFile && evolutionStatus == EVOLUTION_STATUS::CONTINUE) {                                // for each binary to be evolved
 
-            evolvingBinaryStar      = NULL;                                                                     // unset global pointer to evolving binary (for BSE Switch Log)
-            evolvingBinaryStarValid = false;                                                                    // indicate that the global pointer is not (yet) valid (for BSE Switch log)
-
             bool doneGridLine = false;                                                                          // flags we're done with this grid file line (if using a grid file)
             if (usingGrid) {                                                                                    // using grid file?
                 gridLineVariation = 0;                                                                          // yes - first variation of this grid line
@@ -474,7 +430,8 @@ std::tuple<int, int> EvolveBinaryStars() {
                 // (i.e. the random seed specified is used as it)).  Note that in this scenario it is the 
                 // user's responsibility to ensure that there is no duplication of seeds.
              
-                unsigned long int thisId = index + gridLineVariation;                                           // set the id for the binary
+                unsigned long int thisId    = index + gridLineVariation;                                        // set the id for the binary
+                unsigned long int seedIndex = forkVariations ? forkCycle : index;                               // index used to offset the random seed
 
                 unsigned long int randomSeed = 0l;                                                              // random seed
                 OPTIONS_ORIGIN    optsOrigin = processingGridLine ? OPTIONS_ORIGIN::GRIDFILE : OPTIONS_ORIGIN::CMDLINE; // indicate which set of program options we're using
@@ -488,7 +445,7 @@ std::tuple<int, int> EvolveBinaryStars() {
                 }
                 else if (OPTIONS->FixedRandomSeedCmdLine()) {                                                   // no - user specified a random seed on the commandline?
                                                                                                                 // yes - use it (indexed)
-                    randomSeed = OPTIONS->RandomSeedCmdLine() + (unsigned long int)index + (unsigned long int)gridLineVariation; // random seed               
+                    randomSeed = OPTIONS->RandomSeedCmdLine() + seedIndex + (unsigned long int)gridLineVariation; // random seed               
                     if (OPTIONS->SetRandomSeed(randomSeed, optsOrigin) < 0) {                                   // ok?
                         SHOW_ERROR(ERROR::ERROR_PROCESSING_CMDLINE_OPTIONS);                                    // no - show error
                         evolutionStatus = EVOLUTION_STATUS::STOPPED;                                            // and stop evolution
@@ -496,7 +453,7 @@ std::tuple<int, int> EvolveBinaryStars() {
                 }
                 else {                                                                                          // no
                                                                                                                 // use default seed (based on system time) + id (index)
-                    randomSeed = RAND->DefaultSeed() + (unsigned long int)index + (unsigned long int)gridLineVariation; // random seed               
+                    randomSeed = RAND->DefaultSeed() + seedIndex + (unsigned long int)gridLineVariation;        // random seed               
                     if (OPTIONS->SetRandomSeed(randomSeed, optsOrigin) < 0) {                                   // ok?
                         SHOW_ERROR(ERROR::ERROR_PROCESSING_CMDLINE_OPTIONS);                                    // no - show error
                         evolutionStatus = EVOLUTION_STATUS::STOPPED;                                            // and stop evolution
@@ -509,12 +466,17 @@ std::tuple<int, int> EvolveBinaryStars() {
 
 
                     delete binary; binary = nullptr;                                                            // so we don't leak
-                    binary = new BinaryStar(randomSeed, thisId);                                                // generate binary according to the user options
 
-                    evolvingBinaryStar      = binary;                                                           // set global pointer to evolving binary (for BSE Switch Log)
-                    evolvingBinaryStarValid = true;                                                             // indicate that the global pointer is now valid (for BSE Switch Log)
-
-                    EVOLUTION_STATUS binaryStatus = binary->Evolve();                                           // evolve the binary
+                    EVOLUTION_STATUS binaryStatus;
+                    if (forkVariations && cmdLineVariation > 0 && forkPoint) {                                  // resume from the fork point?
+                        binary = new BinaryStar(*forkPoint);                                                    // yes - copy the fork point snapshot
+                        RAND->RestoreState();                                                                   // restore the random number generator to the fork point
+                        binaryStatus = binary->EvolveFromForkPoint(thisId);                                     // evolve the binary from the fork point
+                    }
+                    else {                                                                                      // no
+                        binary = new BinaryStar(randomSeed, thisId);                                            // generate binary according to the user options
+                        binaryStatus = binary->Evolve(forkVariations ? &forkPoint : nullptr);                   // evolve the binary (taking fork point snapshots if necessary)
+                    }
 
                     if (binaryStatus == EVOLUTION_STATUS::ERROR || binaryStatus == EVOLUTION_STATUS::SSE_ERROR) { // ok?
                         SHOW_ERROR(ERROR::BINARY_EVOLUTION_STOPPED, EVOLUTION_STATUS_LABEL.at(binaryStatus));   // no - show error
@@ -541,11 +503,19 @@ std::tuple<int, int> EvolveBinaryStars() {
                         }
                     }
 
+                    if (!LOGGING->FlushBSEDetailedTimeline()) {                                                 // write compact detailed output for this binary if necessary
+                        SHOW_WARN(ERROR::FILE_WRITE_ERROR);                                                     // write failed - show warning
+                    }
+
                     if (!LOGGING->CloseStandardFile(LOGFILE::BSE_DETAILED_OUTPUT)) {                            // close detailed output file if necessary
                         SHOW_WARN(ERROR::FILE_NOT_CLOSED);                                                      // close failed - show warning
                         evolutionStatus = EVOLUTION_STATUS::STOPPED;                                            // this will cause problems later - stop evolution
                     }
 
+                    if (!LOGGING->FlushTextFiles(LOGFILE_FLUSH::OBJECT)) {                                      // flush logfiles if necessary (--logfile-flush OBJECT)
+                        SHOW_WARN(ERROR::FILE_WRITE_ERROR);                                                     // flush failed - show warning
+                    }
+
                     ERRORS->Clean();                                                                            // clean the dynamic error catalog
 
                     if (usingGrid) {                                                                            // using grid file?
@@ -574,17 +544,30 @@ std::tuple<int, int> EvolveBinaryStars() {
                 SHOW_ERROR(ERROR::ERROR_PROCESSING_CMDLINE_OPTIONS);                                            // show error
             }
             else if (optionsStatus == 0) {                                                                      // end of options variations?
-                if (usingGrid || OPTIONS->CommandLineGrid() || (!usingGrid && index >= OPTIONS->nObjectsToEvolve())) { // created required number of stars?
+                if (forkVariations) {                                                                           // forking variations?
+                    delete forkPoint; forkPoint = nullptr;                                                      // yes - end of cycle - discard the fork point
+                    cmdLineVariation = 0;                                                                       // next cycle
+                    if (++forkCycle >= OPTIONS->nObjectsToEvolve()) {                                           // evolved required number of binaries under all variations?
+                        evolutionStatus = EVOLUTION_STATUS::DONE;                                               // yes - we're done
+                    }
+                }
+                else if (usingGrid || OPTIONS->CommandLineGrid() || (!usingGrid && index >= OPTIONS->nObjectsToEvolve())) { // created required number of stars?
                     evolutionStatus = EVOLUTION_STATUS::DONE;                                                   // yes - we're done
                 }
             }
+            else cmdLineVariation++;                                                                            // next variation of this cycle
         }
     }
+    delete forkPoint; forkPoint = nullptr;
     
     int nBinariesRequested = evolutionStatus == EVOLUTION_STATUS::DONE ? index : -1;
 
     SAY("\nGenerated " << std::to_string(index) << " of " << (nBinariesRequested < 0 ? "<INCOMPLETE GRID>" : std::to_string(nBinariesRequested)) << " binaries requested");
 
+    if (IMPORTANCE_SAMPLER->Enabled()) {                                                                        // importance sampling?
+        SAY("Importance sampling: " << IMPORTANCE_SAMPLER->Hits() << " binaries reached the evolution target - estimated fraction of the population " << IMPORTANCE_SAMPLER->HitFraction());
+    }
+
     // announce result
     if (!OPTIONS->Quiet()) {
         if (evolutionStatus != EVOLUTION_STATUS::CONTINUE) {                                                    // shouldn't be...
@@ -622,6 +605,31 @@ std::tuple<int, int> EvolveBinaryStars() {
 }
 
 
+/*
+ * Report the time spent in each phase of program startup (--startup-timing)
+ *
+ * The static initialisation time is the CPU time consumed before main() was entered - the
+ * construction of namespace-scope objects (mostly the maps in constants.h, of which each
+ * translation unit has its own copy).  The remaining phases are wall times.
+ *
+ *
+ * void ReportStartupTiming(const std::vector<std::pair<std::string, double>>& p_Phases)
+ *
+ * @param   [IN]    p_Phases                    Startup phases: <description, seconds>
+ */
+void ReportStartupTiming(const std::vector<std::pair<std::string, double>>& p_Phases) {
+
+    double totalSeconds = 0.0;
+
+    SAY("Startup timing:");
+    for (auto& phase: p_Phases) {
+        SAY("    " << std::left << std::setw(32) << phase.first << std::right << std::fixed << std::setprecision(6) << phase.second << " seconds");
+        totalSeconds += phase.second;
+    }
+    SAY("    " << std::left << std::setw(32) << "Total" << std::right << std::fixed << std::setprecision(6) << totalSeconds << " seconds\n");
+}
+
+
 /*
  * COMPAS main program
  *
@@ -636,12 +644,23 @@ std::tuple<int, int> EvolveBinaryStars() {
  */
 int main(int argc, char * argv[]) {
 
+    // startup phases, for --startup-timing - recorded regardless (the option hasn't been parsed yet)
+    std::vector<std::pair<std::string, double>> startupPhases = {{"Static initialisation (CPU)", clock() / (double)CLOCKS_PER_SEC}};
+    auto phaseStart = std::chrono::steady_clock::now();                                             // start of current startup phase
+    auto EndStartupPhase = [&startupPhases, &phaseStart](const std::string p_Phase) {               // record time spent in current startup phase
+        auto phaseEnd = std::chrono::steady_clock::now();
+        startupPhases.push_back({p_Phase, std::chrono::duration<double>(phaseEnd - phaseStart).count()});
+        phaseStart = phaseEnd;
+    };
+
     PROGRAM_STATUS programStatus = PROGRAM_STATUS::CONTINUE;                                        // status - initially ok
 
     RAND->Initialise();                                                                             // initialise the random number service
     RAND->Seed(0l);                                                                                 // set seed to 0 - ensures repeatable results
+    EndStartupPhase("Random number service");
 
     bool ok = OPTIONS->Initialise(argc, argv);                                                      // get the program options from the commandline
+    EndStartupPhase("Options service");
     if (!ok) {                                                                                      // have commandline options ok?
         programStatus = PROGRAM_STATUS::ERROR_IN_COMMAND_LINE;                                      // no - set status
     }
@@ -676,6 +695,7 @@ int main(int argc, char * argv[]) {
                            OPTIONS->DebugToFile(),                                                  // should debug statements also be written to logfile?
                            OPTIONS->ErrorsToFile(),                                                 // should error messages also be written to logfile?
                            OPTIONS->LogfileType());                                                 // log file type
+            EndStartupPhase("Logging service");
 
             (void)utils::SplashScreen();                                                            // announce ourselves
 
@@ -688,6 +708,11 @@ int main(int argc, char * argv[]) {
                         SHOW_ERROR(error, "Accessing grid file '" + OPTIONS->GridFilename() + "'"); // no - show error
                         programStatus = PROGRAM_STATUS::STOPPED;                                    // set status
                     }
+                    EndStartupPhase("Grid file");
+                }
+
+                if (programStatus == PROGRAM_STATUS::CONTINUE && OPTIONS->StartupTiming()) {        // report startup timing?
+                    ReportStartupTiming(startupPhases);                                             // yes
                 }
 
                 int objectsRequested = 0;                                                           // for logging
@@ -699,7 +724,14 @@ int main(int argc, char * argv[]) {
                         std::tie(objectsRequested, objectsCreated) = EvolveSingleStars();           // yes - evolve single stars
                     }
                     else {                                                                          // no - BSE
+                        SUMMARY->Start(OPTIONS->PopulationSummary());                               // start the population summary service (if requested)
+                        IMPORTANCE_SAMPLER->Start();                                                // start the importance sampling service (if requested)
+
                         std::tie(objectsRequested, objectsCreated) = EvolveBinaryStars();           // evolve binary stars
+
+                        if (!SUMMARY->Write(LOGGING->ContainerPath() + "/" + POPULATION_SUMMARY_FILE_NAME + ".txt")) {  // write population summary (if requested)
+                            SHOW_WARN(ERROR::FILE_WRITE_ERROR, "Writing population summary file");  // announce error
+                        }
                     }
 
                     if (!OPTIONS->GridFilename().empty()) {                                         // have grid filename?
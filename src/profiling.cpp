@@ -26,6 +26,9 @@ namespace profiling {
 
     int    m_PowCallCount   = 0;                // Total (accumulated) call count for std::pow()
 
+    long   m_MemoHits       = 0;                // GB parameter and timescale memo hits (recalculation skipped)
+    long   m_MemoMisses     = 0;                // GB parameter and timescale memo misses (recalculated)
+
 
     // member functions
 
@@ -41,6 +44,7 @@ namespace profiling {
      */
     void Initialise() {
         InitialisePow();
+        InitialiseMemo();
     } 
 
     /*
@@ -60,6 +64,7 @@ namespace profiling {
         std::cout << "\n";
 
         ReportPow();
+        ReportMemo();
         
         std::cout << "=========== END PROFILING OUTCOMES ===========\n";
     } 
@@ -244,6 +249,63 @@ namespace profiling {
         std::cout << "\n";
     }
 
+
+
+    /*
+     * Initialises variables used for profiling GB parameter and timescale memoisation
+     * 
+     * 
+     * void InitialiseMemo()
+     * 
+     */
+    void InitialiseMemo() {
+        m_MemoHits   = 0;                       // GB parameter and timescale memo hits
+        m_MemoMisses = 0;                       // GB parameter and timescale memo misses
+    }
+
+
+    /*
+     * Record a GB parameter and timescale memo lookup
+     * 
+     * Called from BaseStar::CalculateGBParamsAndTimescales()
+     * 
+     * 
+     * void Memo(const bool p_Hit)
+     *
+     * @param   [IN]    p_Hit                       true if the memoised values were used, false if they were recalculated
+     *  
+     */
+    void Memo(const bool p_Hit) {
+        if (p_Hit) m_MemoHits++;
+        else       m_MemoMisses++;
+    }
+
+
+    /*
+     * Report profiling statistics for GB parameter and timescale memoisation
+     * 
+     * Same format as ReportPow()
+     *      
+     * 
+     * void ReportMemo()
+     * 
+     */
+    void ReportMemo() {
+
+        long lookups = m_MemoHits + m_MemoMisses;
+
+        std::cout << "Begin profiling outcomes for GB parameter and timescale memoisation\n";
+        std::cout << "-------------------------------------------------------------------\n";
+        std::cout << "Total lookups               : " << lookups << "\n";
+        std::cout << "Hits (recalculation skipped): " << m_MemoHits << "\n";
+        std::cout << "Misses (recalculated)       : " << m_MemoMisses << "\n";
+        std::cout << "Hit rate                    : " << (lookups > 0 ? static_cast<double>(m_MemoHits) / static_cast<double>(lookups) : 0.0) << "\n";
+        std::cout << "\n";
+        std::cout << "End profiling outcomes for GB parameter and timescale memoisation\n";
+        std::cout << "-------------------------------------------------------------------\n";
+        std::cout << "\n";
+    }
+
 }
 
 #endif // DOPROFILING
@@ -30,6 +30,9 @@
 #define PPOW(base, exponent)        profiling::pow(base, exponent)                                  // no
 #endif
 
+// define profiler calls for GB parameter and timescale memoisation (see BaseStar::CalculateGBParamsAndTimescales())
+#define PMEMO(hit)                  profiling::Memo(hit)                                            // record memo hit/miss
+
 
 namespace profiling {
 
@@ -60,6 +63,12 @@ namespace profiling {
     double pow(const double p_Base, const double p_Exponent);                                       // no
     #endif
 
+    // GB parameter and timescale memoisation related functions
+    void   InitialiseMemo();                                                                        // initialisation function for memoisation profiling
+    void   ReportMemo();                                                                            // reporting function for memoisation profiling
+
+    void   Memo(const bool p_Hit);                                                                  // records a memo hit (p_Hit = true) or miss (p_Hit = false)
+
 }
 
 #else                               // no - profiling not enabled
@@ -68,6 +77,7 @@ namespace profiling {
 #define ReportProfiling             {}                                                              // report profiling outcomes
 
 #define PPOW(base, exponent)        std::pow(base, exponent)                                        // not profiling calls to pow()
+#define PMEMO(hit)                  {}                                                              // not profiling memoisation
 
 #endif // DOPROFILING
 
@@ -1,6 +1,9 @@
 #ifndef __typedefs_h__
 #define __typedefs_h__
 
+#include <array>
+#include <limits>
+
 #include "constants.h"
 
 // JR: todo: clean this up and document it better
@@ -12,6 +15,13 @@ typedef std::initializer_list<SN_EVENT>        SN_EVENT_LIST;
 typedef std::vector<STELLAR_TYPE>              STYPE_VECTOR;
 
 
+// Nanjing lambda (Xu & Li 2010) fits - fixed size, so the per-call coefficient sets are not heap-allocated
+typedef std::array<double, 2>                  NANJING_BG;          // [0] = lambda_b (or max lambda_b), [1] = lambda_g (or max lambda_g)
+typedef std::array<double, 6>                  NANJING_COEFFS;      // polynomial coefficients 0..5
+
+const NANJING_BG NANJING_BG_NONE = {{ std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN() }};   // lambda b & g not (yet) calculated
+
+
 // Option details
 typedef struct OptionDetails {
     std::string              optionStr;                     // name string
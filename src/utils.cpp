@@ -21,32 +21,32 @@ namespace utils {
      * For a given number x and a sorted array arr, return the lower and upper bin edges of x in arr.
      *
      *
-     * std::vector<int> binarySearch(const std::vector<double> p_Arr, const double p_x)
+     * std::array<int, 2> binarySearch(const std::vector<double> &p_Arr, const double p_x)
      *
      * @param   [IN]    p_Array             Sorted array to search over
      * @param   [IN]    p_x                 Value to search for
 
-     * @return                              Vector containing indices of the lower and upper
+     * @return                              Array containing indices of the lower and upper
                                             bin edges containing x. If x < min(Arr), return
                                             {-1, 0}. If x > max(Arr), return {0, -1}. If x
                                             is equal to an array element, return index of that
                                             element.
      */
-    std::vector<int> binarySearch(const std::vector<double> p_Arr, const double p_x) {
+    std::array<int, 2> binarySearch(const std::vector<double> &p_Arr, const double p_x) {
         int low = 0;
         int up = p_Arr.size() - 1;
         int mid = 0;
 
         // If x is not within array limits...
-        if      (p_x < p_Arr[low]) { return {-1, 0}; }
-        else if (p_x > p_Arr[up])  { return {0, -1}; }
+        if      (p_x < p_Arr[low]) { return {{-1, 0}}; }
+        else if (p_x > p_Arr[up])  { return {{0, -1}}; }
 
         while(1) {
             mid = roundl( 0.5*(up + low) );
-            if (std::abs(low - up) == 1) { return {low, low+1}; }    // arr(low) < x < arr(up), so return low
-            else if (p_x == p_Arr[low])  { return {low, low}; }      // arr(low) = x. In this case, return low = up
-            else if (p_x == p_Arr[up])   { return {up, up}; }        // arr(up) = x. In this case, return low = up
-            else if (p_x == p_Arr[mid])  { return {mid, mid}; }      // arr(mid) = x. In this case, return low = up = mid
+            if (std::abs(low - up) == 1) { return {{low, low+1}}; }  // arr(low) < x < arr(up), so return low
+            else if (p_x == p_Arr[low])  { return {{low, low}}; }    // arr(low) = x. In this case, return low = up
+            else if (p_x == p_Arr[up])   { return {{up, up}}; }      // arr(up) = x. In this case, return low = up
+            else if (p_x == p_Arr[mid])  { return {{mid, mid}}; }    // arr(mid) = x. In this case, return low = up = mid
             else if (p_x < p_Arr[mid])   { up = mid; }               // Bring down upper bound
             else                         { low = mid; }              // Bring up lower bound
         }
@@ -165,33 +165,6 @@ namespace utils {
     }
 
 
-    /*
-     * Compare floating-point numbers with tolerance
-     *
-     * Absolute and relative tolerance can be different - see constants.h
-     * Set relative tolerance = 0.0 to always use absolute
-     * Set absolute tolerance = 0.0 to always use relative
-     * Set both to zero for no tolerance - or #undef COMPARE_WITH_TOLERANCE for performance
-     *
-     *
-     * int Compare(const double p_X, const double p_Y)
-     *
-     * @param   [IN]    p_X                 Floating-point value to be compared
-     * @param   [IN]    p_Y                 Floating-point value to be compared
-     * @return                              Integer indicating result of comparison:
-     *                                         -1 indicates p_X is less than p_Y
-     *                                          0 indicates equality
-     *                                          1 indicates p_X is greater than p_Y
-     */
-    int Compare(const double p_X, const double p_Y) {
-    #ifdef COMPARE_WITH_TOLERANCE
-        return (std::abs(p_X - p_Y) <= std::max(FLOAT_TOLERANCE_ABSOLUTE, FLOAT_TOLERANCE_RELATIVE * std::max(std::abs(p_X), fabs(p_Y)))) ? 0 : (p_X < p_Y ? -1 : 1);
-    #else
-        return (p_X == p_Y) ? 0 : (p_X < p_Y ? -1 : 1);
-    #endif
-    }
-
-
     /*
      * Convert a period in days to a semi-major axis in AU
      *
@@ -342,31 +315,6 @@ namespace utils {
     }
 
 
-    /*
-     * Calculate x^y where x is double and y is an integer
-     *
-     * faster than pow() for integer exponent
-     *
-     *
-     * double intPow(const double p_Base, const int p_Exponent)
-     *
-     * @param   [IN]    p_Base              Base - number to be raised to integer power
-     * @param   [IN]    p_Exponent          Exponent - integer to wich base should be raised
-     * @return                              Base ^ Exponent
-     */
-    double intPow(const double p_Base, const int p_Exponent) {
-
-        double result = 1.0;                                            // for exponent = 0
-
-        if (p_Exponent != 0) {                                          // exponent not zero
-            int times = abs(p_Exponent);                                // number of times to multiply
-            for (int i = 0; i < times; i++) result *= p_Base;           // multiply
-        }
-
-        return p_Exponent < 0 ? 1.0 / result : result;                  // invert if negative exponent
-    }
-
-
     /*
      * Draw sample from a power law distribution p(x) ~ x^(n) between p_Xmin and p_Xmax
      *
@@ -685,19 +633,62 @@ namespace utils {
     }
 
     /*
-     * Determines if the stellar type passed is one of a list of stellar types passed
+     * Starting value for the solution of Kepler's Equation, E - e sin(E) = M
      *
+     * Uses the starter from Markley (1995, Celestial Mechanics and Dynamical Astronomy, 63, 101): 
+     * the solution of a cubic approximation to Kepler's Equation, followed by a single fifth-order 
+     * (generalised Newton) correction.  The result is accurate to ~1e-15 for all eccentricities 
+     * 0 <= e < 1 (including e -> 1, where starting at E = M converges very slowly), so the 
+     * Newton-Raphson iteration in SolveKeplersEquation() usually terminates without iterating.
      *
-     * bool IsOneOf(const STELLAR_TYPE p_StellarType, const std::initializer_list<ST> p_List)
+     * The mean anomaly is reduced to [0, pi] using the symmetry E(2pi - M) = 2pi - E(M), and
+     * multiples of 2pi are added back, so any value of the mean anomaly can be passed.
      *
-     * @param   [IN]    p_StellarType               Stellar type to check
-     * @param   [IN]    p_List                      List of stellar types
-     * @return                                      Boolean - true if p_StellarType is in list, false if not
+     * There are no branches on the data other than the symmetry selects, so loops calling this
+     * function (e.g. the batch version of SolveKeplersEquation()) can be vectorised by the compiler.
+     *
+     *
+     * double KeplersEquationStarter(const double p_MeanAnomaly, const double p_Eccentricity)
+     *
+     * @param   [IN]    p_MeanAnomaly               The mean anomaly
+     * @param   [IN]    p_Eccentricity              Eccentricity of the orbit (0 <= e < 1)
+     * @return                                      Estimate of the eccentric anomaly
      */
-    bool IsOneOf(const STELLAR_TYPE p_StellarType, const STELLAR_TYPE_LIST p_List) {
-        for (auto elem: p_List)
-            if (p_StellarType == elem) return true;
-        return false;
+    double KeplersEquationStarter(const double p_MeanAnomaly, const double p_Eccentricity) {
+
+        constexpr double PI_SQUARED = M_PI * M_PI;
+
+        double e     = p_Eccentricity;
+        double turns = std::floor(p_MeanAnomaly / _2_PI);                                                                               // whole orbits
+        double M     = p_MeanAnomaly - (turns * _2_PI);                                                                                 // M in [0, 2pi)
+        bool   upper = M > M_PI;                                                                                                        // use symmetry?
+        M            = upper ? _2_PI - M : M;                                                                                           // M in [0, pi]
+
+        // cubic starter - Markley (1995) equations (20) - (26)
+        double alpha = (3.0 * PI_SQUARED + 1.6 * M_PI * (M_PI - M) / (1.0 + e)) / (PI_SQUARED - 6.0);
+        double d     = 3.0 * (1.0 - e) + alpha * e;
+        double q     = 2.0 * alpha * d * (1.0 - e) - M * M;
+        double r     = 3.0 * alpha * d * (d - 1.0 + e) * M + M * M * M;
+        double w     = std::cbrt(std::abs(r) + std::sqrt(q * q * q + r * r));
+        w           *= w;
+        double E     = (2.0 * r * w / (w * w + w * q + q * q) + M) / d;
+
+        // fifth-order correction - Markley (1995) equations (27) - (30)
+        double eSinE = e * sin(E);
+        double eCosE = e * cos(E);
+        double f0    = E - eSinE - M;
+        double f1    = 1.0 - eCosE;
+        double f2    = eSinE;
+        double f3    = eCosE;
+        double f4    = -eSinE;
+        double d3    = -f0 / (f1 - 0.5 * f0 * f2 / f1);
+        double d4    = -f0 / (f1 + 0.5 * d3 * f2 + d3 * d3 * f3 / 6.0);
+        double d5    = -f0 / (f1 + 0.5 * d4 * f2 + d4 * d4 * f3 / 6.0 + d4 * d4 * d4 * f4 / 24.0);
+        E           += d5;
+
+        E = upper ? _2_PI - E : E;                                                                                                      // undo symmetry
+
+        return E + (turns * _2_PI);
     }
 
 
@@ -831,19 +822,27 @@ namespace utils {
         va_list vaArgs;
         va_start(vaArgs, p_zcFormat);
 
-        // reliably acquire the size from a copy of the variable argument array
-        // and a functionally reliable call to mock the formatting
+        // keep a copy of the variable argument array in case the formatted
+        // string doesn't fit in the buffer and we need a second pass
         va_list vaArgsCopy;
         va_copy(vaArgsCopy, vaArgs);
-        const int iLen = std::vsnprintf(NULL, 0, p_zcFormat, vaArgsCopy);
-        va_end(vaArgsCopy);
 
-        // return a formatted string without risking memory mismanagement
-        // and without assuming any compiler or platform specific behavior
-        std::vector<char> zc(iLen + 1);
-        std::vsnprintf(zc.data(), zc.size(), p_zcFormat, vaArgs);
+        // format into a buffer on the stack - almost all formatted values fit,
+        // so usually there is a single pass and no intermediate heap allocation
+        char zcBuf[256];
+        const int iLen = std::vsnprintf(zcBuf, sizeof(zcBuf), p_zcFormat, vaArgs);
         va_end(vaArgs);
 
+        if (iLen < 0 || iLen < static_cast<int>(sizeof(zcBuf))) {                                  // formatted (or failed) in one pass
+            va_end(vaArgsCopy);
+            return iLen < 0 ? std::string() : std::string(zcBuf, iLen);
+        }
+
+        // too long for the buffer - format again into a buffer of the right size
+        std::vector<char> zc(iLen + 1);
+        std::vsnprintf(zc.data(), zc.size(), p_zcFormat, vaArgsCopy);
+        va_end(vaArgsCopy);
+
         return std::string(zc.data(), iLen);
     }
 
@@ -1300,7 +1299,8 @@ namespace utils {
 
 
     /*
-     * Solve Kepler's Equation using root finding techniques. Here we use Newton-Raphson.
+     * Solve Kepler's Equation using root finding techniques. Here we use Newton-Raphson, starting
+     * from the estimate returned by KeplersEquationStarter().
      *
      * For a definition of all the anomalies see here:
      *
@@ -1327,7 +1327,8 @@ namespace utils {
 
         double e = p_Eccentricity;
         double M = p_MeanAnomaly;
-        double E = p_MeanAnomaly;                                                                                                       // initial guess at E is M - correct for e = 0
+        double E = KeplersEquationStarter(M, e);                                                                                        // initial guess at E
+        if (!std::isfinite(E)) E = M;                                                                                                   // starter failed (e.g. e = 1, M = 0) - use E = M (correct for e = 0)
 
         double kepler = E - (e * sin(E)) - M;                                                                                           // let f(E) = 0.  Equation (92) in my "A simple toy model" document
 
@@ -1349,6 +1350,67 @@ namespace utils {
     }
 
 
+    /*
+     * Solve Kepler's Equation for a batch of (mean anomaly, eccentricity) pairs
+     *
+     * Intended for sampling studies that need many anomalies (e.g. kick distributions, orbital phases).
+     * The first pass evaluates KeplersEquationStarter() and the true anomaly for every element with no 
+     * data-dependent branches, so the compiler can vectorise it.  The second pass checks the residual 
+     * of each element, and any element not within NEWTON_RAPHSON_EPSILON (which should not happen for
+     * 0 <= e < 1) is re-solved with the scalar SolveKeplersEquation().
+     *
+     * The vectors of mean anomalies and eccentricities must be the same length.
+     *
+     *
+     * std::tuple<ERROR, DBL_VECTOR, DBL_VECTOR> SolveKeplersEquation(const DBL_VECTOR &p_MeanAnomalies, const DBL_VECTOR &p_Eccentricities)
+     *
+     * @param   [IN]    p_MeanAnomalies             The mean anomalies
+     * @param   [IN]    p_Eccentricities            Eccentricities of the orbits
+     * @return                                      Tuple containing (in order): error value, eccentric anomalies, true anomalies
+     *                                              The error value returned will be:
+     *                                                  ERROR::NONE if no error occurred
+     *                                                  ERROR::NO_CONVERGENCE if any element did not converge
+     *                                                  ERROR::OUT_OF_BOUNDS if any eccentric anomaly returned is < 0 or > 2pi
+     *                                              (NO_CONVERGENCE takes precedence over OUT_OF_BOUNDS)
+     *                                              If the error returned is not ERROR:NONE, use the eccentric anomalies and 
+     *                                              true anomalies returned at your own risk
+     */
+    std::tuple<ERROR, DBL_VECTOR, DBL_VECTOR> SolveKeplersEquation(const DBL_VECTOR &p_MeanAnomalies, const DBL_VECTOR &p_Eccentricities) {
+
+        ERROR  error = ERROR::NONE;                                                                                                     // error
+
+        size_t     n = std::min(p_MeanAnomalies.size(), p_Eccentricities.size());
+        DBL_VECTOR eccentricAnomalies(n);
+        DBL_VECTOR trueAnomalies(n);
+
+        const double *M  = p_MeanAnomalies.data();
+        const double *e  = p_Eccentricities.data();
+        double       *E  = eccentricAnomalies.data();
+        double       *nu = trueAnomalies.data();
+
+        for (size_t i = 0; i < n; i++) {                                                                                                // vectorisable pass
+            E[i]   = KeplersEquationStarter(M[i], e[i]);
+            nu[i]  = 2.0 * atan((std::sqrt((1.0 + e[i]) / (1.0 - e[i]))) * tan(0.5 * E[i]));
+            nu[i] += (E[i] >= M_PI && E[i] <= _2_PI) ? _2_PI : 0.0;                                                                     // add 2PI if necessary
+        }
+
+        for (size_t i = 0; i < n; i++) {                                                                                                // check pass
+            if (std::abs(E[i] - (e[i] * sin(E[i])) - M[i]) < NEWTON_RAPHSON_EPSILON) {                                                  // converged?
+                if (E[i] < 0.0 || E[i] > _2_PI) {                                                                                       // yes - out of bounds?
+                    if (error == ERROR::NONE) error = ERROR::OUT_OF_BOUNDS;                                                             // yes - set error
+                }
+            }
+            else {                                                                                                                      // no - fall back to scalar solver
+                ERROR thisError;
+                std::tie(thisError, E[i], nu[i]) = SolveKeplersEquation(M[i], e[i]);
+                if (thisError == ERROR::NO_CONVERGENCE || (thisError != ERROR::NONE && error == ERROR::NONE)) error = thisError;
+            }
+        }
+
+        return std::make_tuple(error, eccentricAnomalies, trueAnomalies);
+    }
+
+
     /*
      * Solve quadratic Ax^2 + Bx + C
      *
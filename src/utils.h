@@ -13,16 +13,86 @@ namespace utils {
     inline STELLAR_TYPE StellarType() { return STELLAR_TYPE::NONE; }                       // stellar type for utils - always "NONE"
 
 
+    // hot-path functions - defined here (rather than in utils.cpp) so they can be inlined by the
+    // compiler in every translation unit that calls them
+
+    /*
+     * Compare floating-point numbers with tolerance
+     *
+     * Absolute and relative tolerance can be different - see constants.h
+     * Set relative tolerance = 0.0 to always use absolute
+     * Set absolute tolerance = 0.0 to always use relative
+     * Set both to zero for no tolerance - or #undef COMPARE_WITH_TOLERANCE for performance
+     *
+     *
+     * int Compare(const double p_X, const double p_Y)
+     *
+     * @param   [IN]    p_X                 Floating-point value to be compared
+     * @param   [IN]    p_Y                 Floating-point value to be compared
+     * @return                              Integer indicating result of comparison:
+     *                                         -1 indicates p_X is less than p_Y
+     *                                          0 indicates equality
+     *                                          1 indicates p_X is greater than p_Y
+     */
+    inline int Compare(const double p_X, const double p_Y) {
+    #ifdef COMPARE_WITH_TOLERANCE
+        return (std::abs(p_X - p_Y) <= std::max(FLOAT_TOLERANCE_ABSOLUTE, FLOAT_TOLERANCE_RELATIVE * std::max(std::abs(p_X), fabs(p_Y)))) ? 0 : (p_X < p_Y ? -1 : 1);
+    #else
+        return (p_X == p_Y) ? 0 : (p_X < p_Y ? -1 : 1);
+    #endif
+    }
+
+
+    /*
+     * Calculate x^y where x is double and y is an integer
+     *
+     * faster than pow() for integer exponent
+     *
+     *
+     * double intPow(const double p_Base, const int p_Exponent)
+     *
+     * @param   [IN]    p_Base              Base - number to be raised to integer power
+     * @param   [IN]    p_Exponent          Exponent - integer to wich base should be raised
+     * @return                              Base ^ Exponent
+     */
+    inline double intPow(const double p_Base, const int p_Exponent) {
+
+        double result = 1.0;                                            // for exponent = 0
+
+        if (p_Exponent != 0) {                                          // exponent not zero
+            int times = abs(p_Exponent);                                // number of times to multiply
+            for (int i = 0; i < times; i++) result *= p_Base;           // multiply
+        }
+
+        return p_Exponent < 0 ? 1.0 / result : result;                  // invert if negative exponent
+    }
+
+
+    /*
+     * Determines if the stellar type passed is one of a list of stellar types passed
+     *
+     *
+     * bool IsOneOf(const STELLAR_TYPE p_StellarType, const STELLAR_TYPE_LIST p_List)
+     *
+     * @param   [IN]    p_StellarType               Stellar type to check
+     * @param   [IN]    p_List                      List of stellar types
+     * @return                                      Boolean - true if p_StellarType is in list, false if not
+     */
+    inline bool IsOneOf(const STELLAR_TYPE p_StellarType, const STELLAR_TYPE_LIST p_List) {
+        for (auto elem: p_List)
+            if (p_StellarType == elem) return true;
+        return false;
+    }
+
+
     // namespace functions - alphabetical (sort of)
 
-    std::vector<int>                    binarySearch(const std::vector<double> p_Arr, const double p_x);
+    std::array<int, 2>                  binarySearch(const std::vector<double> &p_Arr, const double p_x);
 
     double                              CalculateCDFKroupa(const double p_Mass, const double p_Max, const double p_Min);
 
     std::string                         CentreJustify(const std::string p_Str, std::size_t p_Width);
 
-    int                                 Compare(const double p_X, const double p_Y);
-
     double                              ConvertPeriodInDaysToSemiMajorAxisInAU(const double p_Mass1, const double p_Mass2, const double p_Period);
 
     DBL_DBL                             DrawKickDirection(const KICK_DIRECTION_DISTRIBUTION p_KickDirectionDistribution, const double p_KickDirectionPower);
@@ -86,8 +156,6 @@ namespace utils {
         return std::make_tuple(false, p_Default);
     }
 
-    double                              intPow(const double p_Base, const int p_Exponent);
-
     double                              InverseSampleFromPowerLaw(const double p_Power, const double p_Xmax, const double p_Xmin);
     double                              InverseSampleFromTabulatedCDF(const double p_Y, const std::map<double, double> p_Table);
 
@@ -99,7 +167,7 @@ namespace utils {
     bool                                IsLONGINT(const std::string p_Str);
     bool                                IsULONGINT(const std::string p_Str);
 
-    bool                                IsOneOf(const STELLAR_TYPE p_StellarType, const STELLAR_TYPE_LIST p_List);
+    double                              KeplersEquationStarter(const double p_MeanAnomaly, const double p_Eccentricity);
 
 
     std::string                         PadLeadingZeros(const std::string p_Str, const std::size_t p_MaxLength);
@@ -133,6 +201,7 @@ namespace utils {
     SN_EVENT                            SNEventType(const SN_EVENT p_SNEvent);
 
     std::tuple<ERROR, double, double>   SolveKeplersEquation(const double p_MeanAnomaly, const double p_Eccentricity);
+    std::tuple<ERROR, DBL_VECTOR, DBL_VECTOR> SolveKeplersEquation(const DBL_VECTOR &p_MeanAnomalies, const DBL_VECTOR &p_Eccentricities);
 
     std::tuple<ERROR, double>           SolveQuadratic(const double p_A, const double p_B, double p_C);
 
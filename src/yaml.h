@@ -74,13 +74,19 @@ namespace yaml {
             "    ### LOGISTICS",
             "    --debug-to-file",
             "    --detailed-output                                               # WARNING! this creates a data heavy file",
+            "    --detailed-output-compact",
             "    --enable-warnings                                               # option to enable/disable warning messages",
             "    --errors-to-file",
             "    --evolve-unbound-systems",
+            "    --fork-variations",
+            "    --hdf5-shuffle",
+            "    --importance-sampling                                           # adaptively concentrate binaries around those that reach --evolution-target",
             "    --population-data-printing",
+            "    --population-summary-only",
             "    --print-bool-as-string",
             "    --quiet",
             "    --rlof-printing",
+            "    --startup-timing",
             "    --store-input-files",
             "    --switch-log",
             "",
@@ -122,6 +128,7 @@ namespace yaml {
             "",
             "    ### LOGISTICS",
             "    --debug-level",
+            "    --evolution-target-minimum-mass                                 # stop evolving a binary once each star is a WD or less massive than this [Msol]",
             "    --logfile-common-envelopes-record-types",
             "    --logfile-detailed-output-record-types",
             "    --logfile-double-compact-objects-record-types",
@@ -133,6 +140,9 @@ namespace yaml {
             "    --grid-start-line",
             "    --hdf5-chunk-size",
             "    --hdf5-buffer-size",
+            "    --hdf5-compression-level",
+            "    --importance-sampling-batch-size",
+            "    --importance-sampling-exploration-fraction",
             "    --log-level",
             "    --maximum-evolution-time                                        # maximum physical time a system can be evolved [Myr]",
             "    --maximum-number-timestep-iterations",
@@ -260,6 +270,7 @@ namespace yaml {
             "",
             "    ### LOGISTICS",
             "    --add-options-to-sysparms",
+            "    --evolution-target                                              # stop evolving binaries that can no longer reach this target (e.g. DCO)",
             "    --grid                                                          # grid file name (e.g. 'mygrid.txt')",
             "    --mode                                                          # evolving single (SSE) or binary stars (BSE)",
             "    --notes",
@@ -310,6 +321,8 @@ namespace yaml {
             "    ### LOGFILES AND OUTPUTS ",
             "    --logfile-type",
             "    --logfile-name-prefix",
+            "    --logfile-flush",
+            "    --hdf5-compression",
             "    --logfile-definitions",
             "    --logfile-common-envelopes",
             "    --logfile-detailed-output",
@@ -326,6 +339,7 @@ namespace yaml {
             "",
             "    --log-classes",
             "    --debug-classes",
+            "    --population-summary",
         };
     }
 